@@ -0,0 +1,93 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <array>
+#include <vector>
+
+/**
+ * @brief The most recent samples of a channel pair, for replaying them later
+ *
+ * While the processor runs one stereo side alone (MONO DETECTION), the other side's
+ * oversampler stops seeing input. Everything the running side was fed is kept here,
+ * at the base rate (into the up filters) and at the oversampled rate (into the down
+ * filters), so the idle side can be replayed back into step when stereo resumes.
+ * Only the last getCapacity() samples are kept; older ones have left every filter.
+ */
+class ChannelHistory
+{
+public:
+    static constexpr int numChannels = 2;
+
+    /** Allocate the ring (message thread only) */
+    void prepare(int capacitySamples)
+    {
+        capacity = std::max(capacitySamples, 1);
+        for (auto& line : history)
+            line.assign(static_cast<size_t>(capacity), 0.0);
+
+        reset();
+    }
+
+    /** Forget everything stored (safe on the audio thread) */
+    void reset()
+    {
+        writePos = 0;
+        numStored = 0;
+    }
+
+    int getCapacity() const { return capacity; }
+
+    /** Samples available to copy(): everything pushed since reset(), up to the capacity */
+    int getNumStored() const { return numStored; }
+
+    /** Append one block to both channels */
+    template<typename SampleType>
+    void push(const SampleType* const* channels, int numSamples)
+    {
+        jassert(numSamples <= capacity);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto* line = history[static_cast<size_t>(ch)].data();
+            const auto* input = channels[ch];
+            const int first = std::min(numSamples, capacity - writePos);
+
+            for (int i = 0; i < first; ++i)
+                line[writePos + i] = static_cast<double>(input[i]);
+            for (int i = first; i < numSamples; ++i)
+                line[i - first] = static_cast<double>(input[i]);
+        }
+
+        writePos = (writePos + numSamples) % capacity;
+        numStored = std::min(numStored + numSamples, capacity);
+    }
+
+    /**
+     * @brief Copy part of one channel's history
+     * @param samplesAgo How far before the end of the most recent push the copy starts
+     */
+    template<typename SampleType>
+    void copy(int channel, SampleType* output, int samplesAgo, int numSamples) const
+    {
+        jassert(samplesAgo <= numStored && numSamples <= samplesAgo);
+
+        const auto* line = history[static_cast<size_t>(channel)].data();
+        int pos = writePos - samplesAgo;
+        if (pos < 0)
+            pos += capacity;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            output[i] = static_cast<SampleType>(line[pos]);
+            if (++pos == capacity)
+                pos = 0;
+        }
+    }
+
+private:
+    std::array<std::vector<double>, numChannels> history;
+    int capacity = 1;
+    int writePos = 0;
+    int numStored = 0;
+};
@@ -0,0 +1,119 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <memory>
+
+/**
+ * @brief Non-owning view of one channel's delay line inside DelayMemory
+ *
+ * Replaces the per-channel std::vector<double> lookahead buffers: the state
+ * structs keep only this pointer/length pair next to their write position, so
+ * the hot per-sample state stays small and the sample memory lives elsewhere.
+ */
+struct DelayLine
+{
+    double* data = nullptr;
+    int length = 0;
+
+    double& operator[](int index) noexcept
+    {
+        jassert(index >= 0 && index < length);
+        return data[index];
+    }
+
+    int size() const noexcept { return length; }
+
+    /** Zero the first numSamples samples (all of them by default) */
+    void clear(int numSamples = -1) noexcept
+    {
+        const int count = (numSamples < 0) ? length : std::min(numSamples, length);
+        if (data != nullptr && count > 0)
+            std::fill(data, data + count, 0.0);
+    }
+};
+
+/**
+ * @brief Single aligned allocation for every lookahead and delay line
+ *
+ * Each processor's lines are laid out back to back, one per bus channel, with every
+ * line starting on a 64-byte boundary. prepare() runs on the message thread; the
+ * audio thread only reads the views handed out by getLine().
+ */
+class DelayMemory
+{
+public:
+    static constexpr size_t alignment = 64;
+    static constexpr int maxChannels = 16;  // Up to 9.1.6
+
+    /** Delay lines owned by the processor, in processing order */
+    enum Line
+    {
+        HardClipLookahead,
+        SoftClipLookahead,
+        SlowLimitLookahead,
+        FastLimitLookahead,
+        DryDelay,           // Dry path delay matching the XY lookahead (OS domain)
+        TPLLookahead,
+        HardClipAlign,      // Per-path padding up to the slowest path's resampling latency
+        SoftClipAlign,
+        SlowLimitAlign,
+        FastLimitAlign,
+        numLines
+    };
+
+    using Lengths = std::array<int, numLines>;
+
+    /**
+     * @brief Allocate every line at its maximum length (message thread only)
+     * @param newLengths Maximum samples per channel for each line
+     * @param channels Bus channels, one line each (at most maxChannels)
+     */
+    void prepare(const Lengths& newLengths, int channels)
+    {
+        lengths = newLengths;
+        numChannels = juce::jlimit(1, maxChannels, channels);
+
+        size_t totalBytes = 0;
+        for (int length : lengths)
+            totalBytes += static_cast<size_t>(numChannels) * lineStride(length);
+
+        // Value-initialised, so every line starts out silent
+        storage.reset(new char[totalBytes + alignment]());
+        const auto base = reinterpret_cast<std::uintptr_t>(storage.get());
+        auto* aligned = reinterpret_cast<char*>((base + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1));
+
+        size_t offset = 0;
+        for (size_t line = 0; line < lengths.size(); ++line)
+        {
+            for (int ch = 0; ch < numChannels; ++ch, offset += lineStride(lengths[line]))
+                lines[line][static_cast<size_t>(ch)] = { reinterpret_cast<double*>(aligned + offset), lengths[line] };
+        }
+
+        allocatedBytes = totalBytes;
+    }
+
+    /** View of one channel's line (valid until the next prepare()) */
+    DelayLine getLine(Line line, int channel) const noexcept
+    {
+        jassert(channel >= 0 && channel < numChannels);
+        return lines[static_cast<size_t>(line)][static_cast<size_t>(channel)];
+    }
+
+    size_t getAllocatedBytes() const { return allocatedBytes; }
+
+private:
+    static size_t lineStride(int length)
+    {
+        const size_t bytes = static_cast<size_t>(std::max(length, 0)) * sizeof(double);
+        return (bytes + alignment - 1) & ~(alignment - 1);
+    }
+
+    std::unique_ptr<char[]> storage;
+    std::array<std::array<DelayLine, maxChannels>, numLines> lines{};
+    Lengths lengths{};
+    int numChannels = 0;
+    size_t allocatedBytes = 0;
+};
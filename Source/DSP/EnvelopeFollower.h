@@ -70,6 +70,18 @@ public:
         return envelope;
     }
 
+    /**
+     * @brief Process a block of samples
+     * @param input Input audio samples
+     * @param output Envelope level per sample (may be the same array as input)
+     * @param numSamples Number of samples to process
+     */
+    void process(const float* input, float* output, int numSamples)
+    {
+        for (int i = 0; i < numSamples; ++i)
+            output[i] = process(input[i]);
+    }
+
     /**
      * @brief Get current envelope level without processing
      * @return Current envelope level
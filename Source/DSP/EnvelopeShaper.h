@@ -1,6 +1,6 @@
 #pragma once
 
-#include "EnvelopeFollower.h"
+#include "TransientDetector.h"
 #include <juce_audio_processors/juce_audio_processors.h>
 
 /**
@@ -9,20 +9,15 @@
  * Uses dual envelope followers (fast and slow) to detect transientness,
  * then applies dynamic gain based on user-specified attack and sustain emphasis.
  * This allows independent control over transient vs sustain drive intensity.
+ *
+ * processEnvelope() runs the shaper's own TransientDetector. Shapers listening to the
+ * same signal can instead share one detector and only map its transientness to their
+ * gain with processTransientness() or the block process().
  */
 class EnvelopeShaper
 {
 public:
-    EnvelopeShaper()
-    {
-        // Configure fast envelope for transient detection
-        fastEnvelope.setAttackTime(0.5f);   // 0.5ms - catches transients
-        fastEnvelope.setReleaseTime(20.0f); // 20ms - quick release
-
-        // Configure slow envelope for sustain tracking
-        slowEnvelope.setAttackTime(10.0f);   // 10ms - averages transients
-        slowEnvelope.setReleaseTime(100.0f); // 100ms - tracks sustain
-    }
+    EnvelopeShaper() = default;
 
     /**
      * @brief Prepare the shaper for playback
@@ -31,8 +26,7 @@ public:
     void prepare(double sampleRate)
     {
         currentSampleRate = sampleRate;
-        fastEnvelope.setSampleRate(sampleRate);
-        slowEnvelope.setSampleRate(sampleRate);
+        detector.setSampleRate(sampleRate);
 
         // Setup parameter smoothing (10-20ms to prevent zipper noise)
         const float smoothingTimeMs = 15.0f;
@@ -51,8 +45,7 @@ public:
      */
     void reset()
     {
-        fastEnvelope.reset();
-        slowEnvelope.reset();
+        detector.reset();
         attackGainSmoothed.setCurrentAndTargetValue(1.0f);
         sustainGainSmoothed.setCurrentAndTargetValue(1.0f);
     }
@@ -86,19 +79,16 @@ public:
      */
     float processEnvelope(float inputSample)
     {
-        // Track fast and slow envelopes
-        const float fastEnv = fastEnvelope.process(inputSample);
-        const float slowEnv = slowEnvelope.process(inputSample);
-
-        // Calculate transientness: 0.0 = pure sustain, 1.0 = pure transient
-        // Formula: (fast - slow) / (fast + slow + epsilon)
-        // This normalizes the difference to [0, 1] range
-        constexpr float epsilon = 1e-6f;
-        float transientness = (fastEnv - slowEnv) / (fastEnv + slowEnv + epsilon);
-
-        // Clamp to valid range [0, 1]
-        transientness = juce::jlimit(0.0f, 1.0f, transientness);
+        return processTransientness(detector.process(inputSample));
+    }
 
+    /**
+     * @brief Map transientness from a (shared) TransientDetector to this shaper's gain
+     * @param transientness 0.0 (sustain) to 1.0 (transient)
+     * @return Gain multiplier to apply before drive processing (0.25 to 4.0)
+     */
+    float processTransientness(float transientness)
+    {
         // Store for UI metering
         currentTransientness = transientness;
 
@@ -114,6 +104,33 @@ public:
         return outputGain;
     }
 
+    /**
+     * @brief Map a block of transientness values to gains
+     * @param transientness 0.0 (sustain) to 1.0 (transient) per sample
+     * @param gains Gain multiplier per sample (may be the same array as transientness)
+     * @param numSamples Number of samples to process
+     */
+    void process(const float* transientness, float* gains, int numSamples)
+    {
+        if (numSamples <= 0)
+            return;
+
+        if (attackGainSmoothed.isSmoothing() || sustainGainSmoothed.isSmoothing())
+        {
+            for (int i = 0; i < numSamples; ++i)
+                gains[i] = processTransientness(transientness[i]);
+            return;
+        }
+
+        // Settled emphasis: a plain interpolation the compiler can vectorise
+        const float attackGain = attackGainSmoothed.getTargetValue();
+        const float sustainGain = sustainGainSmoothed.getTargetValue();
+        for (int i = 0; i < numSamples; ++i)
+            gains[i] = juce::jmap(transientness[i], sustainGain, attackGain);
+
+        currentTransientness = transientness[numSamples - 1];
+    }
+
     /**
      * @brief Get current transientness amount for UI metering
      * @return Transientness value from 0.0 (sustain) to 1.0 (transient)
@@ -140,8 +157,7 @@ public:
     }
 
 private:
-    EnvelopeFollower fastEnvelope;  // Fast envelope (transient detection)
-    EnvelopeFollower slowEnvelope;  // Slow envelope (sustain tracking)
+    TransientDetector detector;  // Used by processEnvelope() only
 
     double currentSampleRate{44100.0};
 
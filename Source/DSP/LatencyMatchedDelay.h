@@ -0,0 +1,177 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <vector>
+
+/**
+ * @brief Base-rate stand-in for the oversampled XY chain while it is linear
+ *
+ * ADAPTIVE_OS lets the oversampled engines idle at the base rate while every XY path
+ * is in its linear region. The chain then reduces to a gain and a delay, and the delay
+ * has to match the oversampled one exactly (filter latency plus XY lookahead, which is
+ * fractional for most engine/factor/sample-rate combinations) so nothing shifts when
+ * the chain switches in and out and the latency reported to the host never changes.
+ * The wet and dry channels each get one (their oversampled delays differ slightly).
+ *
+ * Whole-sample delays are a plain ring read; fractional ones go through a short
+ * Blackman-windowed sinc. The ring also keeps enough history for the processor to
+ * pre-roll the oversampled chain from before it re-engages.
+ */
+class LatencyMatchedDelay
+{
+public:
+    static constexpr int numTaps = 32;  // Fractional interpolator length
+
+    /**
+     * @brief Allocate the history (message thread only)
+     * @param maxDelaySamples Longest delay setDelay() will be asked for
+     * @param maxHistorySamples Most samples copyHistory() will reach back, beyond the delay
+     * @param channels Channels delayed together (one per bus channel)
+     */
+    void prepare(int maxDelaySamples, int maxHistorySamples, int channels = 2)
+    {
+        const int required = maxDelaySamples + numTaps + maxHistorySamples;
+        int capacity = 1;
+        while (capacity < required)
+            capacity <<= 1;
+
+        mask = capacity - 1;
+        history.assign(static_cast<size_t>(std::max(channels, 1)), std::vector<double>(static_cast<size_t>(capacity), 0.0));
+
+        maxDelay = maxDelaySamples;
+        reset();
+    }
+
+    /** Clear the history (safe on the audio thread) */
+    void reset()
+    {
+        for (auto& line : history)
+            std::fill(line.begin(), line.end(), 0.0);
+        writePos = 0;
+    }
+
+    /**
+     * @brief Set the delay in (fractional) samples; recomputes the interpolator only on change
+     *
+     * Safe on the audio thread. Fractional delays shorter than half the interpolator
+     * are rounded to whole samples (the oversampled engines never get close).
+     */
+    void setDelay(double delaySamples)
+    {
+        delaySamples = juce::jlimit(0.0, static_cast<double>(maxDelay), delaySamples);
+        if (delaySamples == delay)
+            return;
+
+        delay = delaySamples;
+        integerDelay = static_cast<int>(std::floor(delay));
+        const double fraction = delay - integerDelay;
+
+        constexpr int centre = numTaps / 2 - 1;
+        fractional = fraction > 1.0e-9 && integerDelay >= centre;
+        if (!fractional)
+        {
+            integerDelay = static_cast<int>(std::lround(delay));
+            return;
+        }
+
+        // Tap k reads input integerDelay - centre + k samples back; centred on the delay
+        firstTapDelay = integerDelay - centre;
+        double sum = 0.0;
+        for (int k = 0; k < numTaps; ++k)
+        {
+            const double t = static_cast<double>(k - centre) - fraction;  // Distance from the ideal read point
+            const double sinc = std::abs(t) < 1.0e-12 ? 1.0 : std::sin(juce::MathConstants<double>::pi * t)
+                                                                 / (juce::MathConstants<double>::pi * t);
+            const double phase = juce::MathConstants<double>::twoPi * (t / numTaps + 0.5);
+            const double window = 0.42 - 0.5 * std::cos(phase) + 0.08 * std::cos(2.0 * phase);
+            taps[static_cast<size_t>(k)] = sinc * window;
+            sum += taps[static_cast<size_t>(k)];
+        }
+
+        for (auto& tap : taps)
+            tap /= sum;  // Unity DC gain
+    }
+
+    double getDelay() const { return delay; }
+
+    int getNumChannels() const { return static_cast<int>(history.size()); }
+
+    /** Append one block to the history of every channel */
+    template<typename SampleType>
+    void push(const SampleType* const* channels, int numSamples)
+    {
+        for (size_t ch = 0; ch < history.size(); ++ch)
+        {
+            auto* line = history[ch].data();
+            const auto* input = channels[ch];
+            int pos = writePos;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                line[pos] = static_cast<double>(input[i]);
+                pos = (pos + 1) & mask;
+            }
+        }
+
+        writePos = (writePos + numSamples) & mask;
+    }
+
+    /** Delayed version of the most recently pushed numSamples of one channel, scaled by gain */
+    template<typename SampleType>
+    void read(int channel, SampleType* output, int numSamples, double gain = 1.0) const
+    {
+        const auto* line = history[static_cast<size_t>(channel)].data();
+        const int blockStart = writePos - numSamples;
+
+        if (!fractional)
+        {
+            int pos = (blockStart - integerDelay) & mask;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                output[i] = static_cast<SampleType>(gain * line[pos]);
+                pos = (pos + 1) & mask;
+            }
+            return;
+        }
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const int newest = blockStart + i - firstTapDelay;
+            double sum = 0.0;
+            for (int k = 0; k < numTaps; ++k)
+                sum += taps[static_cast<size_t>(k)] * line[(newest - k) & mask];
+
+            output[i] = static_cast<SampleType>(gain * sum);
+        }
+    }
+
+    /**
+     * @brief Copy raw (undelayed) history for pre-rolling
+     * @param samplesAgo How far before the end of the most recent push the copy starts
+     */
+    template<typename SampleType>
+    void copyHistory(int channel, SampleType* output, int samplesAgo, int numSamples) const
+    {
+        const auto* line = history[static_cast<size_t>(channel)].data();
+        int pos = (writePos - samplesAgo) & mask;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            output[i] = static_cast<SampleType>(line[pos]);
+            pos = (pos + 1) & mask;
+        }
+    }
+
+private:
+    std::vector<std::vector<double>> history;  // Per channel
+    std::array<double, numTaps> taps{};
+    int mask = 0;
+    int writePos = 0;
+    int maxDelay = 0;
+
+    double delay = -1.0;      // Forces the first setDelay() to take effect
+    int integerDelay = 0;
+    int firstTapDelay = 0;
+    bool fractional = false;
+};
@@ -0,0 +1,238 @@
+#pragma once
+
+#include "SharedDSPResources.h"
+#include <juce_dsp/juce_dsp.h>
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <vector>
+
+/**
+ * @brief Runs one XY path below the common oversampled rate
+ *
+ * The XY blend oversamples all four paths to one common rate, but they do not all
+ * need it: the clippers bend the waveform hard and want every bit of headroom above
+ * the audio band, while the limiters only apply a smooth gain and alias far less.
+ * decimate() brings a path's buffer down to its own rate in place, the path is
+ * processed on the shorter block, and interpolate() brings it back up in place.
+ *
+ * Both directions are cascades of linear-phase halfband FIR stages. Stage j converts
+ * between 2^(j+1)x and 2^j x the base rate, so a path at 2^p x under a common rate of
+ * 2^c x uses stages p..c-1 and the same filters serve every engine/factor pair: the
+ * audio thread only ever changes which stages run, never allocates.
+ *
+ * The round trip is a pure delay of getLatency() common-rate samples (an integer,
+ * since every halfband has odd length); the processor pads the other paths and the
+ * dry signal to match.
+ *
+ * The halfband designs are the same for every resampler, so they come from
+ * SharedDSPResources: the whole process designs each stage once.
+ */
+class PathResampler
+{
+public:
+    static constexpr int maxStages = 5;      // 32x down to 1x
+
+    /**
+     * @brief Design the stages and allocate their state (message thread only)
+     * @param maxCommonBlockSize Most common-rate samples per channel in one call
+     * @param channels Channels with their own filter history
+     */
+    void prepare(int maxCommonBlockSize, int channels = 2)
+    {
+        numChannels = std::max(channels, 1);
+
+        for (int j = 0; j < maxStages; ++j)
+        {
+            auto& stage = stages[static_cast<size_t>(j)];
+
+            // Stage 0 has the base-rate Nyquist right above the audio band, so it gets
+            // the steep first-stage design juce::dsp::Oversampling uses at max quality.
+            // Higher stages keep the audio band below a quarter of their rate and can
+            // afford wide transitions.
+            const int factor = 2 << j;
+            stage.down = SharedDSPResources::get<std::vector<double>>(
+                { SharedDSPResources::Type::HalfbandDecimator, factor, 0.0, sizeof(double) },
+                [j] { return design(j == 0 ? 0.06 : 0.20, j == 0 ? -75.0 : -60.0); });
+            stage.up = SharedDSPResources::get<std::vector<double>>(
+                { SharedDSPResources::Type::HalfbandInterpolator, factor, 0.0, sizeof(double) },
+                [j] { return design(j == 0 ? 0.05 : 0.20, j == 0 ? -90.0 : -70.0); });
+
+            stage.downHistory.assign(static_cast<size_t>(numChannels), std::vector<double>(stage.down->size() - 1, 0.0));
+            stage.upHistory.assign(static_cast<size_t>(numChannels), std::vector<double>(stage.up->size() / 2, 0.0));
+        }
+
+        size_t longestFilter = 0;
+        for (const auto& stage : stages)
+            longestFilter = std::max({ longestFilter, stage.down->size(), stage.up->size() });
+
+        // One channel is filtered at a time, so they share the work buffer
+        work.assign(static_cast<size_t>(std::max(maxCommonBlockSize, 1)) + longestFilter, 0.0);
+
+        reset();
+    }
+
+    /** Clear the filter history (safe on the audio thread) */
+    void reset()
+    {
+        for (auto& stage : stages)
+        {
+            for (auto& history : stage.downHistory)
+                std::fill(history.begin(), history.end(), 0.0);
+            for (auto& history : stage.upHistory)
+                std::fill(history.begin(), history.end(), 0.0);
+        }
+    }
+
+    /** Give one channel the other's filter history (safe on the audio thread) */
+    void copyChannel(int source, int destination)
+    {
+        for (auto& stage : stages)
+        {
+            stage.downHistory[static_cast<size_t>(destination)] = stage.downHistory[static_cast<size_t>(source)];
+            stage.upHistory[static_cast<size_t>(destination)] = stage.upHistory[static_cast<size_t>(source)];
+        }
+    }
+
+    /**
+     * @brief Round-trip delay of decimate() + interpolate()
+     * @return Delay in samples at the common rate (0 when the path runs at the common rate)
+     */
+    int getLatency(int commonFactorIndex, int pathFactorIndex) const
+    {
+        int latency = 0;
+        for (int j = pathFactorIndex; j < commonFactorIndex; ++j)
+        {
+            const auto& stage = stages[static_cast<size_t>(j)];
+            const int centreDown = static_cast<int>(stage.down->size()) / 2;
+            const int centreUp = static_cast<int>(stage.up->size()) / 2;
+
+            // Each stage delays by its two group delays (less the one-sample decimation phase)
+            // at its own high rate, which spans 2^(c-1-j) common-rate samples
+            latency += (centreDown + centreUp - 1) << (commonFactorIndex - 1 - j);
+        }
+        return latency;
+    }
+
+    /**
+     * @brief Halve the rate stage by stage, in place
+     *
+     * The first numSamples >> (commonFactorIndex - pathFactorIndex) samples of each
+     * channel hold the path-rate signal afterwards.
+     *
+     * @return Samples per channel at the path rate
+     */
+    template<typename SampleType>
+    int decimate(juce::AudioBuffer<SampleType>& buffer, int numSamples, int commonFactorIndex, int pathFactorIndex)
+    {
+        const int channels = std::min(buffer.getNumChannels(), numChannels);
+        for (int j = commonFactorIndex - 1; j >= pathFactorIndex; --j)
+        {
+            numSamples /= 2;
+            for (int ch = 0; ch < channels; ++ch)
+                decimateStage(stages[static_cast<size_t>(j)], ch, buffer.getWritePointer(ch), numSamples);
+        }
+        return numSamples;
+    }
+
+    /**
+     * @brief Double the rate stage by stage, in place (inverse of decimate())
+     * @param numPathSamples Samples per channel at the path rate, as returned by decimate()
+     */
+    template<typename SampleType>
+    void interpolate(juce::AudioBuffer<SampleType>& buffer, int numPathSamples, int commonFactorIndex, int pathFactorIndex)
+    {
+        const int channels = std::min(buffer.getNumChannels(), numChannels);
+        for (int j = pathFactorIndex; j < commonFactorIndex; ++j)
+        {
+            for (int ch = 0; ch < channels; ++ch)
+                interpolateStage(stages[static_cast<size_t>(j)], ch, buffer.getWritePointer(ch), numPathSamples);
+            numPathSamples *= 2;
+        }
+    }
+
+private:
+    struct Stage
+    {
+        // Halfband coefficients (odd length, symmetric), shared with every other resampler
+        std::shared_ptr<const std::vector<double>> down, up;
+
+        // Inputs carried over from the previous block (filter length - 1 for the
+        // decimator, half the filter for the interpolator's polyphase branch)
+        std::vector<std::vector<double>> downHistory, upHistory;  // Per channel
+    };
+
+    static std::vector<double> design(double transitionWidth, double stopbandDB)
+    {
+        auto coefficients = juce::dsp::FilterDesign<double>::designFIRLowpassHalfBandEquirippleMethod(
+            transitionWidth, stopbandDB);
+
+        const auto* raw = coefficients->getRawCoefficients();
+        std::vector<double> taps(raw, raw + coefficients->getFilterOrder() + 1);
+
+        // Polyphase loops below rely on odd length with the centre tap on an odd index
+        jassert(taps.size() % 2 == 1 && (taps.size() / 2) % 2 == 1);
+        return taps;
+    }
+
+    // out[m] = sum h[k] x[2m + 1 - k]; only the even taps and the centre are non-zero
+    template<typename SampleType>
+    void decimateStage(Stage& stage, int ch, SampleType* data, int numOutputSamples)
+    {
+        const double* h = stage.down->data();
+        const int N = static_cast<int>(stage.down->size());
+        const int centre = N / 2;
+        auto& history = stage.downHistory[static_cast<size_t>(ch)];
+
+        // [N - 1 samples of history | this block], so every window is contiguous
+        double* x = work.data();
+        std::copy(history.begin(), history.end(), x);
+        for (int i = 0; i < 2 * numOutputSamples; ++i)
+            x[N - 1 + i] = static_cast<double>(data[i]);
+
+        for (int m = 0; m < numOutputSamples; ++m)
+        {
+            const double* w = x + 2 * m + 1;  // Oldest first, ends at input 2m + 1
+            double out = h[centre] * w[centre];
+            for (int k = 0; k < centre; k += 2)
+                out += h[k] * (w[k] + w[N - 1 - k]);
+
+            data[m] = static_cast<SampleType>(out);
+        }
+
+        std::copy(x + 2 * numOutputSamples, x + 2 * numOutputSamples + N - 1, history.begin());
+    }
+
+    // Zero-stuffed input filtered by 2h: even outputs use the even taps, odd outputs the centre
+    template<typename SampleType>
+    void interpolateStage(Stage& stage, int ch, SampleType* data, int numInputSamples)
+    {
+        const double* h = stage.up->data();
+        const int centre = static_cast<int>(stage.up->size()) / 2;
+        auto& history = stage.upHistory[static_cast<size_t>(ch)];
+
+        // [centre samples of history | this block]; outputs land on indices >= their
+        // input, so the copy also keeps the input intact
+        double* x = work.data();
+        std::copy(history.begin(), history.end(), x);
+        for (int m = 0; m < numInputSamples; ++m)
+            x[centre + m] = static_cast<double>(data[m]);
+
+        for (int m = 0; m < numInputSamples; ++m)
+        {
+            const double* w = x + m;  // w[i] = x[m - centre + i]
+            double even = 0.0;
+            for (int k = 0; k < centre; k += 2)
+                even += h[k] * (w[centre - k / 2] + w[k / 2]);
+
+            data[2 * m] = static_cast<SampleType>(2.0 * even);
+            data[2 * m + 1] = static_cast<SampleType>(2.0 * h[centre] * w[(centre + 1) / 2]);
+        }
+
+        std::copy(x + numInputSamples, x + numInputSamples + centre, history.begin());
+    }
+
+    std::array<Stage, maxStages> stages;
+    std::vector<double> work;  // History + block, contiguous
+    int numChannels = 0;
+};
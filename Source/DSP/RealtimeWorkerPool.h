@@ -0,0 +1,354 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <atomic>
+#include <climits>
+#include <cstdint>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#if JUCE_INTEL
+ #include <immintrin.h>
+#endif
+
+#if JUCE_LINUX || JUCE_ANDROID
+ #include <linux/futex.h>
+ #include <sys/syscall.h>
+ #include <unistd.h>
+#elif JUCE_MAC || JUCE_IOS
+ #include <mach/mach.h>
+#elif JUCE_WINDOWS
+ #ifndef WIN32_LEAN_AND_MEAN
+  #define WIN32_LEAN_AND_MEAN
+ #endif
+ #ifndef NOMINMAX
+  #define NOMINMAX
+ #endif
+ #include <windows.h>
+#else
+ #include <condition_variable>
+ #include <mutex>
+#endif
+
+/**
+ * @brief A few real-time worker threads that share independent jobs with the audio thread
+ *
+ * run() publishes a batch of jobs and then works through it alongside the workers: every
+ * thread, the caller included, claims the next unclaimed index from one atomic word until
+ * none are left, and the caller spins until the last claimed job has finished. Nothing on
+ * the audio thread locks, allocates or signals, and a job never depends on a worker being
+ * awake - with no workers (or all of them asleep) the caller simply runs the whole batch.
+ * runAlongside() is the same with some work of the caller's own in front, for work that
+ * must stay on the audio thread: the batch is only offered to the workers until then.
+ *
+ * After a batch a worker spins for a few tens of microseconds in case the next one follows
+ * at once, then parks on a semaphore. run() only posts to it when a worker is parked (one
+ * atomic load otherwise), and the post is a single kernel call that never blocks. Workers
+ * run with flush-to-zero set like the audio thread, so a job produces the same bits
+ * whichever thread claims it.
+ */
+class RealtimeWorkerPool
+{
+public:
+    using Job = void (*)(void* context, int index);
+
+    static constexpr int maxWorkers = 3;
+    static constexpr int maxJobs = 0xffff;
+
+    RealtimeWorkerPool() = default;
+    ~RealtimeWorkerPool() { stop(); }
+
+    /**
+     * Start up to numWorkers threads (message thread only)
+     *
+     * Capped at maxWorkers and at one less than the number of cores. The threads need
+     * real-time scheduling for the given audio period: the audio thread waits for the jobs
+     * they claim, so a worker the system refuses it to is not kept (the pool then has fewer
+     * workers, possibly none, and run() does the rest itself).
+     */
+    void start(int numWorkers, int blockSize, double sampleRate)
+    {
+        stop();
+
+        numWorkers = juce::jlimit(0, maxWorkers, juce::jmin(numWorkers, juce::SystemStats::getNumCpus() - 1));
+        const auto options = juce::Thread::RealtimeOptions{}
+                                 .withPriority(10)
+                                 .withApproximateAudioProcessingTime(juce::jmax(blockSize, 1), sampleRate);
+
+        for (int i = 0; i < numWorkers; ++i)
+        {
+            auto worker = std::make_unique<Worker>(*this, i);
+            if (!worker->startRealtimeThread(options))
+                break;
+            workers.push_back(std::move(worker));
+        }
+    }
+
+    /** Stop and join every worker (message thread only) */
+    void stop()
+    {
+        for (auto& worker : workers)
+            worker->signalThreadShouldExit();
+        wakeUp.post(static_cast<int>(workers.size()));
+        for (auto& worker : workers)
+            worker->stopThread(1000);
+        workers.clear();
+    }
+
+    int getNumWorkers() const { return static_cast<int>(workers.size()); }
+
+    /**
+     * Run job(context, 0 .. numJobs - 1) across the workers and this thread, returning once
+     * every job has finished. Jobs must not touch each other's state; the order in which
+     * they run is unspecified. Not reentrant: call from one thread (the audio thread) only.
+     */
+    void run(int numJobs, Job job, void* context)
+    {
+        // Wake workers for the jobs this thread will not get to first
+        publish(numJobs, job, context, numJobs - 1);
+        finish();
+    }
+
+    /** run() for any callable taking the job index */
+    template<typename Function>
+    void run(int numJobs, Function& function)
+    {
+        run(numJobs, [](void* context, int index) { (*static_cast<Function*>(context))(index); }, &function);
+    }
+
+    /**
+     * Offer job(context, 0 .. numJobs - 1) to the workers, run callerWork() on this thread,
+     * then run whichever jobs no worker has claimed yet and wait for the rest. For work
+     * that has to stay on the calling thread next to jobs that may run anywhere; with no
+     * worker awake it is callerWork() followed by the jobs in turn. Same rules as run().
+     */
+    template<typename CallerWork, typename Function>
+    void runAlongside(CallerWork&& callerWork, int numJobs, Function& function)
+    {
+        // This thread is busy first, so every job may need a worker
+        publish(numJobs, [](void* context, int index) { (*static_cast<Function*>(context))(index); }, &function, numJobs);
+        callerWork();
+        finish();
+    }
+
+private:
+    // Hand a batch over to whoever claims it, waking up to numToWake parked workers
+    void publish(int numJobs, Job job, void* context, int numToWake)
+    {
+        jassert(numJobs >= 0 && numJobs <= maxJobs);
+
+        currentJob = job;
+        currentContext = context;
+        pendingJobs.store(numJobs, std::memory_order_relaxed);
+
+        // Publishing the new generation hands the batch over (release pairs with the claim)
+        generation = (generation + 1) & 0xffffffffu;
+        const uint64_t batch = (generation << 32) | (static_cast<uint64_t>(numJobs) << 16);
+        claimState.store(batch, std::memory_order_seq_cst);
+
+        // Sequentially consistent with the store above and with Worker::park(): either the
+        // worker sees the new generation before it sleeps, or this sees it parked
+        const int parked = numParked.load(std::memory_order_seq_cst);
+        if (parked > 0 && numToWake > 0)
+            wakeUp.post(juce::jmin(parked, numToWake));
+    }
+
+    // Run what is left of the batch on this thread, then wait for jobs other threads claimed
+    void finish()
+    {
+        work(generation);
+
+        while (pendingJobs.load(std::memory_order_acquire) > 0)
+            pause();
+    }
+
+    // Claim and run jobs of one generation until none are left. The claim word packs
+    // [generation:32][numJobs:16][next index:16], so a thread that is late for a batch
+    // can never claim an index of the next one.
+    void work(uint64_t batchGeneration)
+    {
+        uint64_t state = claimState.load(std::memory_order_acquire);
+        for (;;)
+        {
+            const int index = static_cast<int>(state & 0xffff);
+            if ((state >> 32) != batchGeneration || index >= static_cast<int>((state >> 16) & 0xffff))
+                return;
+
+            if (!claimState.compare_exchange_weak(state, state + 1, std::memory_order_acq_rel, std::memory_order_acquire))
+                continue;
+
+            currentJob(currentContext, index);
+            pendingJobs.fetch_sub(1, std::memory_order_release);
+            state = claimState.load(std::memory_order_acquire);
+        }
+    }
+
+    static void pause()
+    {
+       #if JUCE_INTEL
+        _mm_pause();
+       #elif JUCE_ARM && (defined(__aarch64__) || defined(_M_ARM64))
+        #if JUCE_MSVC
+         __yield();
+        #else
+         asm volatile ("yield");
+        #endif
+       #else
+        std::this_thread::yield();
+       #endif
+    }
+
+    // Counting semaphore for parked workers: post() never blocks and only enters the
+    // kernel to wake a waiter
+    class Semaphore
+    {
+    public:
+       #if JUCE_LINUX || JUCE_ANDROID
+        void post(int count)
+        {
+            tokens.fetch_add(count, std::memory_order_release);
+            syscall(SYS_futex, reinterpret_cast<int*>(&tokens), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+        }
+
+        void wait()
+        {
+            for (;;)
+            {
+                int available = tokens.load(std::memory_order_acquire);
+                while (available > 0)
+                    if (tokens.compare_exchange_weak(available, available - 1, std::memory_order_acquire))
+                        return;
+
+                syscall(SYS_futex, reinterpret_cast<int*>(&tokens), FUTEX_WAIT_PRIVATE, 0, nullptr, nullptr, 0);
+            }
+        }
+
+    private:
+        static_assert(sizeof(std::atomic<int>) == sizeof(int) && std::atomic<int>::is_always_lock_free);
+        std::atomic<int> tokens{0};
+
+       #elif JUCE_MAC || JUCE_IOS
+        Semaphore()  { semaphore_create(mach_task_self(), &semaphore, SYNC_POLICY_FIFO, 0); }
+        ~Semaphore() { semaphore_destroy(mach_task_self(), semaphore); }
+
+        void post(int count)
+        {
+            for (int i = 0; i < count; ++i)
+                semaphore_signal(semaphore);
+        }
+
+        void wait()
+        {
+            while (semaphore_wait(semaphore) != KERN_SUCCESS) {}
+        }
+
+    private:
+        semaphore_t semaphore{};
+
+       #elif JUCE_WINDOWS
+        Semaphore()  : semaphore(CreateSemaphoreW(nullptr, 0, LONG_MAX, nullptr)) {}
+        ~Semaphore() { CloseHandle(semaphore); }
+
+        void post(int count) { ReleaseSemaphore(semaphore, count, nullptr); }
+        void wait()          { WaitForSingleObject(semaphore, INFINITE); }
+
+    private:
+        HANDLE semaphore;
+
+       #else
+        // No lock-free wake on this platform: post() takes a short, uncontended lock
+        void post(int count)
+        {
+            {
+                const std::lock_guard<std::mutex> lock(mutex);
+                tokens += count;
+            }
+            condition.notify_all();
+        }
+
+        void wait()
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            condition.wait(lock, [this] { return tokens > 0; });
+            --tokens;
+        }
+
+    private:
+        std::mutex mutex;
+        std::condition_variable condition;
+        int tokens = 0;
+       #endif
+    };
+
+    class Worker : public juce::Thread
+    {
+    public:
+        Worker(RealtimeWorkerPool& p, int index)
+            : juce::Thread("Emulsion XY Worker " + juce::String(index + 1)), pool(p) {}
+
+        void run() override
+        {
+            // Same denormal handling as the audio thread, for bit-identical results
+            juce::ScopedNoDenormals noDenormals;
+            uint64_t seenGeneration = pool.claimState.load(std::memory_order_acquire) >> 32;
+            auto spinUntil = juce::Time::getHighResolutionTicks() + spinTicks();
+
+            while (!threadShouldExit())
+            {
+                const uint64_t latest = pool.claimState.load(std::memory_order_acquire) >> 32;
+                if (latest != seenGeneration)
+                {
+                    seenGeneration = latest;
+                    pool.work(latest);
+                    spinUntil = juce::Time::getHighResolutionTicks() + spinTicks();
+                    continue;
+                }
+
+                // Spin briefly in case the next batch follows at once, then sleep until run() posts
+                if (juce::Time::getHighResolutionTicks() < spinUntil)
+                {
+                    pause();
+                    continue;
+                }
+
+                park(seenGeneration);
+                spinUntil = juce::Time::getHighResolutionTicks() + spinTicks();
+            }
+        }
+
+    private:
+        static constexpr double spinWindowSeconds = 50.0e-6;
+
+        static juce::int64 spinTicks()
+        {
+            return juce::Time::secondsToHighResolutionTicks(spinWindowSeconds);
+        }
+
+        void park(uint64_t seenGeneration)
+        {
+            // Register before the final check, so run() either wakes this worker or it
+            // sees the new batch itself. A post it did not need leaves a token behind,
+            // which only costs one extra spin later.
+            pool.numParked.fetch_add(1, std::memory_order_seq_cst);
+            if ((pool.claimState.load(std::memory_order_seq_cst) >> 32) == seenGeneration && !threadShouldExit())
+                pool.wakeUp.wait();
+            pool.numParked.fetch_sub(1, std::memory_order_relaxed);
+        }
+
+        RealtimeWorkerPool& pool;
+    };
+
+    std::vector<std::unique_ptr<Worker>> workers;
+
+    // Batch in flight: written by run() before the generation is published, read by a
+    // thread only after it has claimed an index of that generation
+    Job currentJob = nullptr;
+    void* currentContext = nullptr;
+    uint64_t generation = 0;  // Owned by the calling thread
+
+    std::atomic<uint64_t> claimState{0};
+    std::atomic<int> pendingJobs{0};
+    std::atomic<int> numParked{0};
+    Semaphore wakeUp;
+};
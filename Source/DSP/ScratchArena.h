@@ -0,0 +1,179 @@
+#pragma once
+
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <juce_dsp/juce_dsp.h>
+#include <array>
+#include <cstdint>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+/**
+ * @brief Single aligned scratch allocation for all per-block audio buffers
+ *
+ * Every intermediate buffer the processor needs (dry copy, XY blend paths,
+ * limiter references) is carved out of one heap
+ * block allocated in prepare(). Each channel starts on a 64-byte boundary so
+ * SIMD loads never straddle cache lines, and only the precision the host is
+ * actually using gets allocated.
+ *
+ * On the audio thread the arena only hands out non-owning views: nothing here
+ * allocates, resizes or frees after prepare().
+ */
+class ScratchArena
+{
+public:
+    static constexpr size_t alignment = 64;
+
+    /** Fixed scratch regions, one per processing stage */
+    enum Slot
+    {
+        NormalizedInput,  // Host input after normalization, before input gain
+        Dry,              // Pristine input / dry path (oversampled alongside wet)
+        LimiterReference, // Pre-limiter copy for delta modes
+        XYHardClip,       // XY blend paths (OS domain)
+        XYSoftClip,
+        XYSlowLimit,
+        XYFastLimit,
+        AdaptiveOversampling, // [wetL, wetR, dryL, dryR] pre-roll input / idle output (ADAPTIVE_OS)
+        MonoReplay,       // Right [wet, dry] replayed through its oversampler after mono processing
+        PipelineBlocks,   // Micro-blocks parked between pipeline stages, two banks (PIPELINED_ENGINE)
+        PipelineDry,      // Their dry copies
+        PipelineOutput,   // Finished output waiting out the pipeline latency
+        numSlots
+    };
+
+    /** Worst-case shape of one slot */
+    struct SlotSize
+    {
+        int numChannels = 0;
+        int numSamples = 0;
+    };
+
+    using Layout = std::array<SlotSize, numSlots>;
+
+    /**
+     * @brief Allocate every slot for its worst case (message thread only)
+     * @param newLayout Maximum channels/samples per slot
+     * @param useDoublePrecision Allocate double rather than float storage
+     */
+    void prepare(const Layout& newLayout, bool useDoublePrecision)
+    {
+        layout = newLayout;
+        isDouble = useDoublePrecision;
+
+        const size_t sampleBytes = isDouble ? sizeof(double) : sizeof(float);
+
+        size_t totalBytes = 0;
+        int totalChannels = 0;
+        for (const auto& slot : layout)
+        {
+            totalBytes += static_cast<size_t>(slot.numChannels) * channelStride(slot.numSamples, sampleBytes);
+            totalChannels += slot.numChannels;
+        }
+
+        // Value-initialised, so every slot starts out silent
+        storage.reset(new char[totalBytes + alignment]());
+        const auto base = reinterpret_cast<std::uintptr_t>(storage.get());
+        auto* aligned = reinterpret_cast<char*>((base + alignment - 1) & ~static_cast<std::uintptr_t>(alignment - 1));
+
+        floatChannels.assign(isDouble ? 0 : static_cast<size_t>(totalChannels), nullptr);
+        doubleChannels.assign(isDouble ? static_cast<size_t>(totalChannels) : 0, nullptr);
+
+        size_t offset = 0;
+        int channelIndex = 0;
+        for (size_t s = 0; s < layout.size(); ++s)
+        {
+            firstChannel[s] = channelIndex;
+            const size_t stride = channelStride(layout[s].numSamples, sampleBytes);
+
+            for (int ch = 0; ch < layout[s].numChannels; ++ch, ++channelIndex, offset += stride)
+            {
+                if (isDouble)
+                    doubleChannels[static_cast<size_t>(channelIndex)] = reinterpret_cast<double*>(aligned + offset);
+                else
+                    floatChannels[static_cast<size_t>(channelIndex)] = reinterpret_cast<float*>(aligned + offset);
+            }
+        }
+
+        allocatedBytes = totalBytes;
+    }
+
+    /**
+     * @brief Non-owning AudioBuffer over a slot (audio thread safe)
+     *
+     * The returned buffer must not be resized; its contents are whatever the
+     * previous user of the slot left behind.
+     */
+    template <typename SampleType>
+    juce::AudioBuffer<SampleType> getBuffer(Slot slot, int numChannels, int numSamples)
+    {
+        return juce::AudioBuffer<SampleType>(getChannels<SampleType>(slot, numChannels, numSamples),
+                                             numChannels, numSamples);
+    }
+
+    /** Non-owning AudioBlock over a slot (audio thread safe) */
+    template <typename SampleType>
+    juce::dsp::AudioBlock<SampleType> getBlock(Slot slot, int numChannels, int numSamples)
+    {
+        return juce::dsp::AudioBlock<SampleType>(getChannels<SampleType>(slot, numChannels, numSamples),
+                                                 static_cast<size_t>(numChannels),
+                                                 static_cast<size_t>(numSamples));
+    }
+
+    /** Slot view holding a copy of source (same channel count and length) */
+    template <typename SampleType>
+    juce::AudioBuffer<SampleType> getCopyOf(Slot slot, const juce::AudioBuffer<SampleType>& source)
+    {
+        auto view = getBuffer<SampleType>(slot, source.getNumChannels(), source.getNumSamples());
+        copy(view, source);
+        return view;
+    }
+
+    /** Copy source into an equally-shaped (or larger) buffer without resizing it */
+    template <typename SampleType>
+    static void copy(juce::AudioBuffer<SampleType>& dest, const juce::AudioBuffer<SampleType>& source)
+    {
+        jassert(dest.getNumChannels() >= source.getNumChannels());
+        jassert(dest.getNumSamples() >= source.getNumSamples());
+
+        for (int ch = 0; ch < source.getNumChannels(); ++ch)
+            dest.copyFrom(ch, 0, source, ch, 0, source.getNumSamples());
+    }
+
+    size_t getAllocatedBytes() const { return allocatedBytes; }
+
+private:
+    static size_t channelStride(int numSamples, size_t sampleBytes)
+    {
+        const size_t bytes = static_cast<size_t>(numSamples) * sampleBytes;
+        return (bytes + alignment - 1) & ~(alignment - 1);
+    }
+
+    template <typename SampleType>
+    SampleType* const* getChannels(Slot slot, int numChannels, int numSamples)
+    {
+        static_assert(std::is_same_v<SampleType, float> || std::is_same_v<SampleType, double>,
+                      "ScratchArena only holds float or double samples");
+
+        // Views are bounded by what prepare() allocated, and only for the active precision
+        jassert(isDouble == (std::is_same_v<SampleType, double>));
+        jassert(numChannels <= layout[static_cast<size_t>(slot)].numChannels);
+        jassert(numSamples <= layout[static_cast<size_t>(slot)].numSamples);
+        juce::ignoreUnused(numChannels, numSamples);
+
+        const auto first = static_cast<size_t>(firstChannel[static_cast<size_t>(slot)]);
+        if constexpr (std::is_same_v<SampleType, float>)
+            return floatChannels.data() + first;
+        else
+            return doubleChannels.data() + first;
+    }
+
+    std::unique_ptr<char[]> storage;
+    std::vector<float*> floatChannels;     // Filled only when prepared for float
+    std::vector<double*> doubleChannels;   // Filled only when prepared for double
+    std::array<int, numSlots> firstChannel{};
+    Layout layout{};
+    bool isDouble = false;
+    size_t allocatedBytes = 0;
+};
@@ -0,0 +1,96 @@
+#pragma once
+
+#include <juce_core/juce_core.h>
+#include <map>
+#include <memory>
+#include <tuple>
+#include <utility>
+
+/**
+ * @brief Process-wide cache of read-only DSP tables, shared by every plugin instance
+ *
+ * Filter designs depend only on their parameters, yet every instance used to design
+ * its own copies in prepareToPlay. get() hands out one immutable table per key to all
+ * instances in the process (every instance of this plugin binary): the first caller
+ * designs it, later callers get the same memory. A table lives exactly as long as
+ * someone holds it: the cache keeps only weak references, so the last instance to
+ * let go frees it and nothing outlives the plugin.
+ *
+ * get() locks and may design a table, so call it from prepare code on the message
+ * thread only. The tables themselves are const and safe to read from any thread.
+ */
+class SharedDSPResources
+{
+public:
+    /** What a table holds; each type always comes with the same table class */
+    enum class Type
+    {
+        HalfbandDecimator,    // PathResampler decimation FIR (std::vector<double>)
+        HalfbandInterpolator  // PathResampler interpolation FIR (std::vector<double>)
+    };
+
+    struct Key
+    {
+        Type type;
+        int factor = 0;             // Oversampling factor the table runs at
+        double sampleRate = 0.0;    // 0 for designs normalised to their own rate
+        int precision = 0;          // sizeof the table's sample type
+
+        bool operator<(const Key& other) const
+        {
+            return std::tie(type, factor, sampleRate, precision)
+                 < std::tie(other.type, other.factor, other.sampleRate, other.precision);
+        }
+    };
+
+    /**
+     * @brief The shared table for a key, created with create() if nobody holds one
+     *
+     * create() returns the table by value and runs under the cache lock, so concurrent
+     * prepares wait for one design instead of each making their own. It must not call
+     * get() itself.
+     */
+    template<typename Table, typename Factory>
+    static std::shared_ptr<const Table> get(const Key& key, Factory&& create)
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock(cache.lock);
+
+        auto& entry = cache.entries[key];
+        if (auto existing = entry.lock())
+            return std::static_pointer_cast<const Table>(existing);
+
+        // Forget tables whose last holder has gone before adding another
+        for (auto it = cache.entries.begin(); it != cache.entries.end();)
+            it = (it->second.expired() && &it->second != &entry) ? cache.entries.erase(it) : std::next(it);
+
+        auto table = std::make_shared<const Table>(std::forward<Factory>(create)());
+        entry = table;
+        return table;
+    }
+
+    /** Tables currently alive (held by at least one instance) */
+    static int getNumLiveTables()
+    {
+        auto& cache = getCache();
+        const juce::ScopedLock lock(cache.lock);
+
+        int live = 0;
+        for (const auto& entry : cache.entries)
+            live += entry.second.expired() ? 0 : 1;
+        return live;
+    }
+
+private:
+    struct Cache
+    {
+        juce::CriticalSection lock;
+        std::map<Key, std::weak_ptr<const void>> entries;
+    };
+
+    static Cache& getCache()
+    {
+        static Cache cache;
+        return cache;
+    }
+};
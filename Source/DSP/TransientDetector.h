@@ -0,0 +1,145 @@
+#pragma once
+
+#include "EnvelopeFollower.h"
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <cmath>
+
+/**
+ * @brief Fast/slow envelope transient detector shared by several EnvelopeShapers
+ *
+ * Tracks a fast (0.5/20 ms) and a slow (10/100 ms) envelope and reports their
+ * normalised difference as transientness: 0.0 = pure sustain, 1.0 = pure transient.
+ * The detection does not depend on any shaper's emphasis settings, so one detector
+ * can feed every shaper that listens to the same signal.
+ *
+ * With a decimation above 1 the block process() steps the envelopes once per
+ * decimation samples (on the peak of those samples) and linearly interpolates the
+ * transientness in between. The envelopes are far slower than the oversampled rate,
+ * so running them at the base rate changes the result very little.
+ */
+class TransientDetector
+{
+public:
+    TransientDetector()
+    {
+        // Configure fast envelope for transient detection
+        fastEnvelope.setAttackTime(0.5f);   // 0.5ms - catches transients
+        fastEnvelope.setReleaseTime(20.0f); // 20ms - quick release
+
+        // Configure slow envelope for sustain tracking
+        slowEnvelope.setAttackTime(10.0f);   // 10ms - averages transients
+        slowEnvelope.setReleaseTime(100.0f); // 100ms - tracks sustain
+    }
+
+    /**
+     * @brief Prepare the detector for playback
+     * @param sampleRate Rate of the signal passed to process()
+     */
+    void prepare(double sampleRate)
+    {
+        setSampleRate(sampleRate);
+        reset();
+    }
+
+    /**
+     * @brief Change the input rate without clearing the envelopes
+     * @param sampleRate Rate of the signal passed to process()
+     */
+    void setSampleRate(double sampleRate)
+    {
+        inputSampleRate = sampleRate;
+        updateDetectorRate();
+    }
+
+    /**
+     * @brief Step the envelopes once per this many input samples in the block process()
+     * @param newDecimation 1 = every sample (default)
+     */
+    void setDecimation(int newDecimation)
+    {
+        newDecimation = juce::jmax(1, newDecimation);
+        if (newDecimation == decimation)
+            return;
+
+        decimation = newDecimation;
+        updateDetectorRate();
+    }
+
+    /**
+     * @brief Reset the envelope state
+     */
+    void reset()
+    {
+        fastEnvelope.reset();
+        slowEnvelope.reset();
+        lastTransientness = 0.0f;
+    }
+
+    /**
+     * @brief Detect one sample (always at the input rate)
+     * @param inputSample Input audio sample
+     * @return Transientness from 0.0 (sustain) to 1.0 (transient)
+     */
+    float process(float inputSample)
+    {
+        // Track fast and slow envelopes
+        const float fastEnv = fastEnvelope.process(inputSample);
+        const float slowEnv = slowEnvelope.process(inputSample);
+
+        // Calculate transientness: 0.0 = pure sustain, 1.0 = pure transient
+        // Formula: (fast - slow) / (fast + slow + epsilon)
+        // This normalizes the difference to [0, 1] range
+        constexpr float epsilon = 1e-6f;
+        const float transientness = (fastEnv - slowEnv) / (fastEnv + slowEnv + epsilon);
+
+        // Clamp to valid range [0, 1]
+        lastTransientness = juce::jlimit(0.0f, 1.0f, transientness);
+        return lastTransientness;
+    }
+
+    /**
+     * @brief Detect a block, honouring the decimation
+     * @param input Input audio samples
+     * @param transientness Transientness per input sample (may be the same array as input)
+     * @param numSamples Number of samples to process
+     */
+    void process(const float* input, float* transientness, int numSamples)
+    {
+        if (decimation == 1)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                transientness[i] = process(input[i]);
+            return;
+        }
+
+        for (int start = 0; start < numSamples; start += decimation)
+        {
+            const int length = juce::jmin(decimation, numSamples - start);
+
+            float peak = 0.0f;
+            for (int i = start; i < start + length; ++i)
+                peak = juce::jmax(peak, std::abs(input[i]));
+
+            const float previous = lastTransientness;
+            const float step = (process(peak) - previous) / static_cast<float>(length);
+            for (int i = 0; i < length; ++i)
+                transientness[start + i] = previous + step * static_cast<float>(i + 1);
+        }
+    }
+
+private:
+    void updateDetectorRate()
+    {
+        fastEnvelope.setSampleRate(inputSampleRate / decimation);
+        slowEnvelope.setSampleRate(inputSampleRate / decimation);
+    }
+
+    EnvelopeFollower fastEnvelope;  // Fast envelope (transient detection)
+    EnvelopeFollower slowEnvelope;  // Slow envelope (sustain tracking)
+
+    double inputSampleRate{44100.0};
+    int decimation{1};
+    float lastTransientness{0.0f};
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(TransientDetector)
+};
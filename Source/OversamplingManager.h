@@ -1,30 +1,50 @@
 #pragma once
 
 #include <juce_dsp/juce_dsp.h>
+#include <algorithm>
 #include <atomic>
+#include <cmath>
+#include <memory>
+#include <type_traits>
+#include <vector>
 
 /**
  * OversamplingManager - Global oversampling handler for Architecture A
  *
  * ====================================================================================
+ * OVERSAMPLING FACTORS
+ * ====================================================================================
+ *
+ * Any power-of-two factor from 1× to 32× is available in the two oversampled engines:
+ * - Mode 0 (Zero Latency): always 1× (no oversampling, no filters)
+ * - Mode 1 (Balanced): 8× by default (Halfband Equiripple FIR)
+ * - Mode 2 (Linear Phase): 16× by default (Steep + normalized FIR)
+ *
+ * The OVERSAMPLING parameter overrides the engine's default factor. Filter quality is
+ * chosen per engine and factor (see getFilterSpec()), and the filter latency of every
+ * combination is measured once in prepare() so latency reporting follows the factor.
+ *
+ * Every combination has one oversampler per bus channel, each carrying that channel's
+ * [wet, dry] pair, so any channel count works and mono processing can run the first
+ * channel alone. They all use the same filters, so the channels stay phase-coherent
+ * exactly as if they shared one oversampler.
+ *
+ * ====================================================================================
  * THREAD-SAFETY MODEL
  * ====================================================================================
  *
  * This class is designed for LOCK-FREE, ALLOCATION-FREE operation on the audio thread.
  *
  * INITIALIZATION PHASE (prepareToPlay - main thread):
- * - prepare() allocates ALL three processing modes upfront
- * - Mode 0 (Zero Latency): No oversampling (1×)
- * - Mode 1 (Balanced): 8× oversampling (Halfband Equiripple FIR)
- * - Mode 2 (Linear Phase): 16× oversampling (Steep + normalized FIR)
+ * - prepare() allocates every engine/factor combination upfront, for the
+ *   precision the host will use
  * - All memory allocation happens here, ONCE
  *
  * AUDIO THREAD OPERATION (processBlock):
- * - setMode() performs lock-free mode switching via std::atomic
+ * - setMode() performs lock-free engine/factor switching via std::atomic
  * - NO memory allocation
  * - NO locks/mutexes
- * - Single atomic write updates active mode index
- * - upsampleBlock/downsampleBlock use the currently active mode
+ * - getOversampler() returns the currently active oversampler
  *
  * GUARANTEE: Once prepare() completes, all subsequent operations are wait-free
  * and real-time safe.
@@ -34,117 +54,142 @@
 class OversamplingManager
 {
 public:
+    static constexpr int numModes = 3;
+    static constexpr int maxFactorIndex = 5;               // 2^5 = 32×
+    static constexpr int maxFactor = 1 << maxFactorIndex;
+
+    /** Halfband filter design for one engine/factor combination */
+    struct FilterSpec
+    {
+        bool steep = false;       // juce::dsp::Oversampling isMaxQuality
+        bool normalise = false;   // Normalised (linear-phase-flat) passband gain
+    };
+
     OversamplingManager() = default;
 
+    /**
+     * Oversampling factor index (factor = 2^index) for an engine and OVERSAMPLING choice
+     *
+     * @param processingMode 0 = Zero Latency, 1 = Balanced, 2 = Linear Phase
+     * @param oversamplingChoice 0 = engine default, 1..5 = 2×..32×
+     */
+    static int getFactorIndex(int processingMode, int oversamplingChoice)
+    {
+        if (processingMode <= 0)
+            return 0;  // Zero Latency never oversamples
+
+        if (oversamplingChoice >= 1 && oversamplingChoice <= maxFactorIndex)
+            return oversamplingChoice;
+
+        return processingMode == 1 ? 3 : 4;  // Balanced 8×, Linear Phase 16×
+    }
+
+    /**
+     * Filter quality per engine and factor
+     *
+     * - Linear Phase: steep + normalised at every factor (flattest passband)
+     * - Balanced 8× and 16×: relaxed filters. Later stages run above the audio band,
+     *   so their images are already far from it
+     * - Balanced 2×/4×: steep. With only one or two stages the first halfband carries
+     *   all of the rejection right at the base-rate Nyquist, and it is still cheap
+     * - 32×: steep + normalised in both engines (offline/render quality)
+     */
+    static FilterSpec getFilterSpec(int processingMode, int factorIndex)
+    {
+        if (processingMode == 2 || factorIndex >= maxFactorIndex)
+            return { true, true };
+
+        return { factorIndex <= 2, false };
+    }
+
     /**
      * Prepare oversampling for processing (CALL ONCE in prepareToPlay)
      *
-     * Pre-allocates ALL three processing modes to enable lock-free switching.
+     * Pre-allocates every engine/factor combination to enable lock-free switching.
      * This method allocates memory and MUST NOT be called on the audio thread.
      *
      * @param baseSampleRate Base sample rate (e.g., 44100 Hz)
      * @param maxBlockSize Maximum block size at base rate
+     * @param numChannels Channels per oversampler processed per call (e.g. 2 for [wet, dry])
+     * @param numOversamplers Oversamplers per combination (one per bus channel)
+     * @param useDoublePrecision Allocate double rather than float oversamplers
      * @param initialMode Initial mode (0=Zero Latency, 1=Balanced, 2=Linear Phase)
+     * @param initialOversampling Initial OVERSAMPLING choice (0 = engine default)
      */
-    void prepare(double baseSampleRate, int maxBlockSize, int initialMode = 1)
+    void prepare(double baseSampleRate, int maxBlockSize, int numChannels, int numOversamplers,
+                 bool useDoublePrecision, int initialMode = 1, int initialOversampling = 0)
     {
         sampleRate = baseSampleRate;
-        activeMode.store(initialMode, std::memory_order_release);
-
-        // Pre-allocate ALL three modes
-        // Mode 0: Zero Latency (no oversampling) - nullptr
-        oversamplerFloat[0].reset();
-        oversamplerDouble[0].reset();
-
-        // Mode 1: Balanced (8× oversampling)
-        oversamplerFloat[1] = std::make_unique<juce::dsp::Oversampling<float>>(
-            2, 3,  // 2 channels, 2^3 = 8× oversampling
-            juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple,
-            false, false);  // Not steep, not normalized
-
-        oversamplerDouble[1] = std::make_unique<juce::dsp::Oversampling<double>>(
-            2, 3,
-            juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple,
-            false, false);
-
-        // Mode 2: Linear Phase (16× oversampling)
-        oversamplerFloat[2] = std::make_unique<juce::dsp::Oversampling<float>>(
-            2, 4,  // 2 channels, 2^4 = 16× oversampling
-            juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple,
-            true, true);  // Steep + normalization
-
-        oversamplerDouble[2] = std::make_unique<juce::dsp::Oversampling<double>>(
-            2, 4,
-            juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple,
-            true, true);
-
-        // Initialize all non-null oversamplers
-        for (int mode = 1; mode <= 2; ++mode)
+
+        for (int mode = 0; mode < numModes; ++mode)
         {
-            oversamplerFloat[mode]->initProcessing(static_cast<size_t>(maxBlockSize));
-            oversamplerDouble[mode]->initProcessing(static_cast<size_t>(maxBlockSize));
+            for (int index = 0; index <= maxFactorIndex; ++index)
+            {
+                oversamplerFloat[mode][index].clear();
+                oversamplerDouble[mode][index].clear();
+                latencySamples[mode][index] = 0;
+                exactLatencySamples[mode][index] = 0.0;
+
+                // Mode 0 and 1× have no oversampler
+                if (mode == 0 || index == 0)
+                    continue;
+
+                const auto spec = getFilterSpec(mode, index);
+                for (int channel = 0; channel < numOversamplers; ++channel)
+                {
+                    if (useDoublePrecision)
+                    {
+                        oversamplerDouble[mode][index].push_back(create<double>(numChannels, index, spec, maxBlockSize));
+                        exactLatencySamples[mode][index] = static_cast<double>(oversamplerDouble[mode][index].back()->getLatencyInSamples());
+                    }
+                    else
+                    {
+                        oversamplerFloat[mode][index].push_back(create<float>(numChannels, index, spec, maxBlockSize));
+                        exactLatencySamples[mode][index] = static_cast<double>(oversamplerFloat[mode][index].back()->getLatencyInSamples());
+                    }
+                }
+                latencySamples[mode][index] = static_cast<int>(exactLatencySamples[mode][index]);
+            }
         }
 
-        // Pre-calculate latency for each mode (at base sample rate)
-        latencySamples[0] = 0;  // Zero Latency
-        latencySamples[1] = static_cast<int>(oversamplerFloat[1]->getLatencyInSamples());  // Balanced
-        latencySamples[2] = static_cast<int>(oversamplerFloat[2]->getLatencyInSamples());  // Linear Phase
+        setMode(initialMode, initialOversampling);
     }
 
     /**
-     * Switch processing mode (LOCK-FREE - safe on audio thread)
+     * Switch processing mode and factor (LOCK-FREE - safe on audio thread)
      *
      * Changes which pre-allocated oversampler is active. NO memory allocation.
      * Thread-safe via atomic operation.
      *
      * @param processingMode 0 = Zero Latency, 1 = Balanced, 2 = Linear Phase
+     * @param oversamplingChoice 0 = engine default, 1..5 = 2×..32×
      */
-    void setMode(int processingMode)
+    void setMode(int processingMode, int oversamplingChoice = 0)
     {
-        if (processingMode < 0 || processingMode > 2)
+        if (processingMode < 0 || processingMode >= numModes)
             return;
 
+        activeFactorIndex.store(getFactorIndex(processingMode, oversamplingChoice), std::memory_order_release);
         activeMode.store(processingMode, std::memory_order_release);
     }
 
     /**
-     * Upsample buffer to OS domain
-     *
-     * @param buffer Input buffer at base sample rate
-     * @return AudioBlock in oversampled domain (or original if no OS)
+     * Currently active oversampler for one bus channel (nullptr in Zero Latency / at 1×)
      */
     template<typename SampleType>
-    juce::dsp::AudioBlock<SampleType> upsampleBlock(juce::AudioBuffer<SampleType>& buffer)
+    juce::dsp::Oversampling<SampleType>* getOversampler(int channel)
     {
         const int mode = activeMode.load(std::memory_order_acquire);
+        const int index = activeFactorIndex.load(std::memory_order_acquire);
 
-        if (mode == 0)
-        {
-            // No oversampling - return original buffer as block
-            return juce::dsp::AudioBlock<SampleType>(buffer);
-        }
+        const auto& oversamplers = [&]() -> const auto& {
+            if constexpr (std::is_same_v<SampleType, float>)
+                return oversamplerFloat[mode][index];
+            else
+                return oversamplerDouble[mode][index];
+        }();
 
-        auto* oversampler = getOversampler<SampleType>(mode);
-        return oversampler->processSamplesUp(juce::dsp::AudioBlock<SampleType>(buffer));
-    }
-
-    /**
-     * Downsample block back to base rate
-     *
-     * @param buffer Output buffer at base sample rate (will be filled)
-     * @param osBlock Oversampled block to downsample
-     */
-    template<typename SampleType>
-    void downsampleBlock(juce::AudioBuffer<SampleType>& buffer, juce::dsp::AudioBlock<SampleType>& osBlock)
-    {
-        const int mode = activeMode.load(std::memory_order_acquire);
-
-        if (mode == 0)
-            return;  // No downsampling needed
-
-        auto* oversampler = getOversampler<SampleType>(mode);
-        juce::dsp::AudioBlock<SampleType> outputBlock(buffer);
-        oversampler->processSamplesDown(outputBlock);
+        return static_cast<size_t>(channel) < oversamplers.size() ? oversamplers[static_cast<size_t>(channel)].get() : nullptr;
     }
 
     /**
@@ -157,13 +202,11 @@ public:
     }
 
     /**
-     * Get oversampling multiplier (1, 8, or 16)
+     * Get oversampling multiplier (1 to 32)
      */
     int getOsMultiplier() const
     {
-        const int mode = activeMode.load(std::memory_order_acquire);
-        static constexpr int multipliers[3] = { 1, 8, 16 };
-        return multipliers[mode];
+        return 1 << activeFactorIndex.load(std::memory_order_acquire);
     }
 
     /**
@@ -172,8 +215,31 @@ public:
      */
     int getLatencySamples() const
     {
-        const int mode = activeMode.load(std::memory_order_acquire);
-        return latencySamples[mode];
+        return latencySamples[activeMode.load(std::memory_order_acquire)]
+                             [activeFactorIndex.load(std::memory_order_acquire)];
+    }
+
+    /**
+     * Get the exact (possibly fractional) up/down filter latency of the active combination
+     * @return Latency in samples at BASE sample rate
+     */
+    double getExactLatencySamples() const
+    {
+        return exactLatencySamples[activeMode.load(std::memory_order_acquire)]
+                                  [activeFactorIndex.load(std::memory_order_acquire)];
+    }
+
+    /**
+     * Get the largest filter latency over every engine/factor combination
+     * @return Latency in samples at BASE sample rate (rounded up)
+     */
+    int getMaxLatencySamples() const
+    {
+        double maxLatency = 0.0;
+        for (const auto& modeLatencies : exactLatencySamples)
+            for (const double latency : modeLatencies)
+                maxLatency = std::max(maxLatency, latency);
+        return static_cast<int>(std::ceil(maxLatency));
     }
 
     /**
@@ -181,7 +247,7 @@ public:
      */
     bool isOversampling() const
     {
-        return activeMode.load(std::memory_order_acquire) > 0;
+        return activeFactorIndex.load(std::memory_order_acquire) > 0;
     }
 
     /**
@@ -192,38 +258,55 @@ public:
         return activeMode.load(std::memory_order_acquire);
     }
 
+    /**
+     * Get current factor index (multiplier = 2^index)
+     */
+    int getFactorIndex() const
+    {
+        return activeFactorIndex.load(std::memory_order_acquire);
+    }
+
     /**
      * Reset oversampling state (call when audio stops)
      */
     void reset()
     {
-        for (int mode = 1; mode <= 2; ++mode)
+        for (int mode = 0; mode < numModes; ++mode)
         {
-            if (oversamplerFloat[mode])
-                oversamplerFloat[mode]->reset();
-            if (oversamplerDouble[mode])
-                oversamplerDouble[mode]->reset();
+            for (int index = 0; index <= maxFactorIndex; ++index)
+            {
+                for (auto& oversampler : oversamplerFloat[mode][index])
+                    oversampler->reset();
+                for (auto& oversampler : oversamplerDouble[mode][index])
+                    oversampler->reset();
+            }
         }
     }
 
 private:
     template<typename SampleType>
-    juce::dsp::Oversampling<SampleType>* getOversampler(int mode)
+    static std::unique_ptr<juce::dsp::Oversampling<SampleType>> create(int numChannels, int factorIndex,
+                                                                       FilterSpec spec, int maxBlockSize)
     {
-        if constexpr (std::is_same_v<SampleType, float>)
-            return oversamplerFloat[mode].get();
-        else
-            return oversamplerDouble[mode].get();
+        auto oversampler = std::make_unique<juce::dsp::Oversampling<SampleType>>(
+            static_cast<size_t>(numChannels), static_cast<size_t>(factorIndex),
+            juce::dsp::Oversampling<SampleType>::filterHalfBandFIREquiripple,
+            spec.steep, spec.normalise);
+        oversampler->initProcessing(static_cast<size_t>(maxBlockSize));
+        return oversampler;
     }
 
-    // Pre-allocated oversamplers for ALL modes
-    // [0] = Zero Latency (nullptr), [1] = Balanced (8×), [2] = Linear Phase (16×)
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversamplerFloat[3];
-    std::unique_ptr<juce::dsp::Oversampling<double>> oversamplerDouble[3];
+    // Pre-allocated oversamplers for every [mode][factor index], one per bus channel; only
+    // the precision passed to prepare() is filled. Mode 0 and index 0 stay empty.
+    std::vector<std::unique_ptr<juce::dsp::Oversampling<float>>> oversamplerFloat[numModes][maxFactorIndex + 1];
+    std::vector<std::unique_ptr<juce::dsp::Oversampling<double>>> oversamplerDouble[numModes][maxFactorIndex + 1];
 
-    // Pre-calculated latency for each mode (at base sample rate)
-    int latencySamples[3] = { 0, 0, 0 };
+    // Pre-calculated latency for each combination (at base sample rate): as reported to
+    // the host (truncated) and exact, for anything that has to match the filters precisely
+    int latencySamples[numModes][maxFactorIndex + 1] = {};
+    double exactLatencySamples[numModes][maxFactorIndex + 1] = {};
 
     double sampleRate = 44100.0;
-    std::atomic<int> activeMode{1};  // Thread-safe mode switching (default: Balanced)
+    std::atomic<int> activeMode{1};         // Thread-safe mode switching (default: Balanced)
+    std::atomic<int> activeFactorIndex{3};  // 8×
 };
@@ -215,41 +215,17 @@ void Oscilloscope::paint(juce::Graphics& g)
     // Scale factor based on current height (base height is 400)
     const float scale = height / 400.0f;
 
-    // Modern gradient background
-    juce::ColourGradient gradient(juce::Colour(22, 22, 26), bounds.getX(), bounds.getY(),
-                                   juce::Colour(18, 18, 22), bounds.getX(), bounds.getBottom(), false);
-    g.setGradientFill(gradient);
-    g.fillRoundedRectangle(bounds, 6.0f * scale);
+    // Cached background: gradient, title, center line, 0 dBFS lines/labels, border
+    const float pixelScale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (!backgroundCache.isValid() || pixelScale != backgroundScale)
+        renderBackground(pixelScale);
 
-    // Sleek title
-    g.setColour(juce::Colours::white.withAlpha(0.85f));
-    g.setFont(juce::Font(10.0f * scale, juce::Font::plain));
-    juce::Rectangle<float> titleArea(bounds.getX(), bounds.getY() + 6 * scale, width, 16.0f * scale);
-    g.drawText("WAVEFORM", titleArea, juce::Justification::centred);
+    if (backgroundCache.isValid())
+        g.drawImage(backgroundCache, bounds);
 
     juce::Rectangle<float> graphBounds(bounds.getX() + 10 * scale, bounds.getY() + 26 * scale,
                                         width - 20 * scale, height - 30 * scale);
-
-    // Center line (0V) - subtle
-    g.setColour(juce::Colour(50, 50, 55).withAlpha(0.3f));
     float centerY = graphBounds.getCentreY();
-    g.drawLine(graphBounds.getX(), centerY, graphBounds.getRight(), centerY, 0.5f * scale);
-
-    // 0 dBFS reference lines (at ±1.0 amplitude = top/bottom 10% of display)
-    // This shows headroom - signal should stay between these lines
-    g.setColour(juce::Colour(255, 80, 80).withAlpha(0.5f));
-    float zeroDbfsTopY = graphBounds.getY() + graphBounds.getHeight() * 0.1f;  // 10% from top
-    float zeroDbfsBottomY = graphBounds.getBottom() - graphBounds.getHeight() * 0.1f;  // 10% from bottom
-    g.drawLine(graphBounds.getX(), zeroDbfsTopY, graphBounds.getRight(), zeroDbfsTopY, 1.5f * scale);
-    g.drawLine(graphBounds.getX(), zeroDbfsBottomY, graphBounds.getRight(), zeroDbfsBottomY, 1.5f * scale);
-
-    // Labels for 0 dBFS lines
-    g.setFont(juce::Font(8.0f * scale, juce::Font::plain));
-    g.setColour(juce::Colour(255, 80, 80).withAlpha(0.7f));
-    g.drawText("0dBFS", graphBounds.getRight() - 40 * scale, zeroDbfsTopY - 10 * scale,
-              38 * scale, 12 * scale, juce::Justification::centredRight);
-    g.drawText("0dBFS", graphBounds.getRight() - 40 * scale, zeroDbfsBottomY - 2 * scale,
-              38 * scale, 12 * scale, juce::Justification::centredRight);
 
     // Draw waveform with three-band RGB coloring - smooth interpolated rendering
     int writePos = processor.oscilloscopeWritePos.load();
@@ -381,6 +357,62 @@ void Oscilloscope::paint(juce::Graphics& g)
         // Draw GR trace overlay
         paintGRTrace(g, graphBounds, scale);
     }
+}
+
+void Oscilloscope::renderBackground(float pixelScale)
+{
+    backgroundScale = pixelScale;
+    backgroundCache = {};
+
+    const int imageWidth = juce::roundToInt(static_cast<float>(getWidth()) * pixelScale);
+    const int imageHeight = juce::roundToInt(static_cast<float>(getHeight()) * pixelScale);
+    if (imageWidth <= 0 || imageHeight <= 0)
+        return;
+
+    backgroundCache = juce::Image(juce::Image::ARGB, imageWidth, imageHeight, true);
+    juce::Graphics g(backgroundCache);
+    g.addTransform(juce::AffineTransform::scale(pixelScale));
+
+    const auto bounds = getLocalBounds().toFloat();
+    const float width = bounds.getWidth();
+    const float height = bounds.getHeight();
+    const float scale = height / 400.0f;
+
+    // Modern gradient background
+    juce::ColourGradient gradient(juce::Colour(22, 22, 26), bounds.getX(), bounds.getY(),
+                                   juce::Colour(18, 18, 22), bounds.getX(), bounds.getBottom(), false);
+    g.setGradientFill(gradient);
+    g.fillRoundedRectangle(bounds, 6.0f * scale);
+
+    // Sleek title
+    g.setColour(juce::Colours::white.withAlpha(0.85f));
+    g.setFont(juce::Font(10.0f * scale, juce::Font::plain));
+    juce::Rectangle<float> titleArea(bounds.getX(), bounds.getY() + 6 * scale, width, 16.0f * scale);
+    g.drawText("WAVEFORM", titleArea, juce::Justification::centred);
+
+    juce::Rectangle<float> graphBounds(bounds.getX() + 10 * scale, bounds.getY() + 26 * scale,
+                                        width - 20 * scale, height - 30 * scale);
+
+    // Center line (0V) - subtle
+    g.setColour(juce::Colour(50, 50, 55).withAlpha(0.3f));
+    float centerY = graphBounds.getCentreY();
+    g.drawLine(graphBounds.getX(), centerY, graphBounds.getRight(), centerY, 0.5f * scale);
+
+    // 0 dBFS reference lines (at ±1.0 amplitude = top/bottom 10% of display)
+    // This shows headroom - signal should stay between these lines
+    g.setColour(juce::Colour(255, 80, 80).withAlpha(0.5f));
+    float zeroDbfsTopY = graphBounds.getY() + graphBounds.getHeight() * 0.1f;  // 10% from top
+    float zeroDbfsBottomY = graphBounds.getBottom() - graphBounds.getHeight() * 0.1f;  // 10% from bottom
+    g.drawLine(graphBounds.getX(), zeroDbfsTopY, graphBounds.getRight(), zeroDbfsTopY, 1.5f * scale);
+    g.drawLine(graphBounds.getX(), zeroDbfsBottomY, graphBounds.getRight(), zeroDbfsBottomY, 1.5f * scale);
+
+    // Labels for 0 dBFS lines
+    g.setFont(juce::Font(8.0f * scale, juce::Font::plain));
+    g.setColour(juce::Colour(255, 80, 80).withAlpha(0.7f));
+    g.drawText("0dBFS", graphBounds.getRight() - 40 * scale, zeroDbfsTopY - 10 * scale,
+              38 * scale, 12 * scale, juce::Justification::centredRight);
+    g.drawText("0dBFS", graphBounds.getRight() - 40 * scale, zeroDbfsBottomY - 2 * scale,
+              38 * scale, 12 * scale, juce::Justification::centredRight);
 
     // Clean outer border
     g.setColour(juce::Colour(60, 60, 65).withAlpha(0.4f));
@@ -389,6 +421,8 @@ void Oscilloscope::paint(juce::Graphics& g)
 
 void Oscilloscope::resized()
 {
+    // Background is rebuilt at the new size on the next paint
+    backgroundCache = {};
     repaint();
 }
 
@@ -497,19 +531,45 @@ XYPad::XYPad(juce::AudioProcessorValueTreeState& apvts,
     addChildComponent(xSlider);
     addChildComponent(ySlider);
 
-    // Start timer for continuous ring updates (for mute toggle responsiveness)
-    startTimerHz(30);
+    // Ring updates (mute toggles, GR glow) are driven by the editor's RefreshScheduler
 }
 
 XYPad::~XYPad()
 {
-    stopTimer();
 }
 
-void XYPad::timerCallback()
+void XYPad::refresh(const MeterSnapshot& snapshot)
 {
-    // Repaint to update ring colors when mute states or GR values change
-    repaint();
+    hcGR = snapshot.hardClipGR;
+    scGR = snapshot.softClipGR;
+    slGR = snapshot.slowLimitGR;
+    flGR = snapshot.fastLimitGR;
+
+    // Repaint only when ring colors, mute states, trims or GR glow visibly change
+    auto quantize = [](float value) { return juce::roundToInt(value * 20.0f); };  // 0.05 dB steps
+    const auto& colors = processor.processorColors;
+
+    const std::array<int, 16> state {
+        quantize(hcGR), quantize(scGR), quantize(slGR), quantize(flGR),
+        apvts.getRawParameterValue("HC_MUTE")->load() > 0.5f ? 1 : 0,
+        apvts.getRawParameterValue("SC_MUTE")->load() > 0.5f ? 1 : 0,
+        apvts.getRawParameterValue("SL_MUTE")->load() > 0.5f ? 1 : 0,
+        apvts.getRawParameterValue("FL_MUTE")->load() > 0.5f ? 1 : 0,
+        quantize(apvts.getRawParameterValue("HC_TRIM")->load()),
+        quantize(apvts.getRawParameterValue("SC_TRIM")->load()),
+        quantize(apvts.getRawParameterValue("SL_TRIM")->load()),
+        quantize(apvts.getRawParameterValue("FL_TRIM")->load()),
+        static_cast<int>(colors.hardClip.getARGB()),
+        static_cast<int>(colors.softClip.getARGB()),
+        static_cast<int>(colors.slowLimit.getARGB()),
+        static_cast<int>(colors.fastLimit.getARGB())
+    };
+
+    if (state != drawnState)
+    {
+        drawnState = state;
+        repaint();
+    }
 }
 
 void XYPad::paint(juce::Graphics& g)
@@ -529,11 +589,7 @@ void XYPad::paint(juce::Graphics& g)
     bool slMuted = apvts.getRawParameterValue("SL_MUTE")->load() > 0.5f;
     bool flMuted = apvts.getRawParameterValue("FL_MUTE")->load() > 0.5f;
 
-    // Get GR values (for ring glow intensity)
-    float hcGR = processor.currentHardClipGR.load();
-    float scGR = processor.currentSoftClipGR.load();
-    float slGR = processor.currentSlowLimitGR.load();
-    float flGR = processor.currentFastLimitGR.load();
+    // GR values from the meter snapshot (for ring glow intensity)
     float totalGR = hcGR + scGR + slGR + flGR;
 
     // Modern gradient background - darker for contrast with ring
@@ -901,8 +957,7 @@ CalibrationPanel::CalibrationPanel(juce::AudioProcessorValueTreeState& apvts, Qu
     calibLevelAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         apvts, "CALIB_LEVEL", calibLevelSlider);
 
-    // Start timer to update colors
-    startTimerHz(15);
+    // Colors are updated by the editor's RefreshScheduler while the panel is open
 
     // Start collapsed
     setVisible(false);
@@ -910,10 +965,9 @@ CalibrationPanel::CalibrationPanel(juce::AudioProcessorValueTreeState& apvts, Qu
 
 CalibrationPanel::~CalibrationPanel()
 {
-    stopTimer();
 }
 
-void CalibrationPanel::timerCallback()
+void CalibrationPanel::refresh(const MeterSnapshot&)
 {
     // Update calibration slider color to match accent
     calibLevelSlider.setColour(juce::Slider::thumbColourId, processor.processorColors.accent);
@@ -991,7 +1045,7 @@ void CalibrationPanel::updateGainAppliedDisplay(double gainDB)
 AdvancedPanel::AdvancedPanel(juce::AudioProcessorValueTreeState& apvts, QuadBlendDriveAudioProcessor& p)
     : apvts(apvts), processor(p)
 {
-    startTimerHz(15);  // Update colors periodically
+    // Colors are updated by the editor's RefreshScheduler while the panel is open
     // Configure section labels
     softClipLabel.setText("SOFT CLIP", juce::dontSendNotification);
     softClipLabel.setFont(juce::Font(10.0f, juce::Font::bold));
@@ -1081,6 +1135,63 @@ AdvancedPanel::AdvancedPanel(juce::AudioProcessorValueTreeState& apvts, QuadBlen
     addAndMakeVisible(flCompButton);
     flCompAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(apvts, "FL_COMP", flCompButton);
 
+    // Per-path oversampling controls
+    pathOversamplingLabel.setText("PATH OVERSAMPLING", juce::dontSendNotification);
+    pathOversamplingLabel.setFont(juce::Font(10.0f, juce::Font::bold));
+    pathOversamplingLabel.setColour(juce::Label::textColourId, juce::Colour(180, 180, 190));
+    addAndMakeVisible(pathOversamplingLabel);
+
+    auto setupPathOversamplingCombo = [this](juce::ComboBox& combo) {
+        combo.addItemList({ "Common", "1x", "2x", "4x", "8x", "16x" }, 1);
+        combo.setColour(juce::ComboBox::backgroundColourId, juce::Colour(35, 35, 40));
+        combo.setColour(juce::ComboBox::textColourId, juce::Colours::white.withAlpha(0.9f));
+        combo.setColour(juce::ComboBox::outlineColourId, juce::Colour(60, 60, 65));
+        combo.setJustificationType(juce::Justification::centred);
+        combo.setTooltip("Path Oversampling\n"
+                         "Common runs at the engine's rate; lower factors save CPU\n"
+                         "The limiters alias far less than the clippers, so they suit 2x\n"
+                         "Paths are re-aligned automatically, which adds a little latency");
+        addAndMakeVisible(combo);
+    };
+
+    setupPathOversamplingCombo(hcOversamplingCombo);
+    setupPathOversamplingCombo(scOversamplingCombo);
+    setupPathOversamplingCombo(slOversamplingCombo);
+    setupPathOversamplingCombo(flOversamplingCombo);
+    hcOversamplingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(apvts, "HC_OVERSAMPLING", hcOversamplingCombo);
+    scOversamplingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(apvts, "SC_OVERSAMPLING", scOversamplingCombo);
+    slOversamplingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(apvts, "SL_OVERSAMPLING", slOversamplingCombo);
+    flOversamplingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(apvts, "FL_OVERSAMPLING", flOversamplingCombo);
+
+    adaptiveOversamplingButton.setButtonText("Adaptive OS");
+    adaptiveOversamplingButton.setColour(juce::ToggleButton::textColourId, juce::Colours::white);
+    adaptiveOversamplingButton.setTooltip("Adaptive Oversampling\n"
+                                          "Balanced/Linear Phase skip the oversampler while every path is linear\n"
+                                          "(same latency) and switch it back in before anything saturates");
+    addAndMakeVisible(adaptiveOversamplingButton);
+    adaptiveOversamplingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(apvts, "ADAPTIVE_OS", adaptiveOversamplingButton);
+
+    controlRateLabel.setText("CONTROL RATE", juce::dontSendNotification);
+    controlRateLabel.setFont(juce::Font(10.0f, juce::Font::bold));
+    controlRateLabel.setColour(juce::Label::textColourId, juce::Colour(180, 180, 190));
+    addAndMakeVisible(controlRateLabel);
+
+    limiterControlRateButton.setButtonText("Limiter Ctrl Rate");
+    limiterControlRateButton.setColour(juce::ToggleButton::textColourId, juce::Colours::white);
+    limiterControlRateButton.setTooltip("Limiter Control Rate\n"
+                                        "Slow/Fast Limit detect once per base-rate sample and ramp their gain\n"
+                                        "up to the oversampled rate: much cheaper, attack is 1-sample resolution");
+    addAndMakeVisible(limiterControlRateButton);
+    limiterControlRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(apvts, "LIMIT_CONTROL_RATE", limiterControlRateButton);
+
+    envelopeControlRateButton.setButtonText("Envelope Ctrl Rate");
+    envelopeControlRateButton.setColour(juce::ToggleButton::textColourId, juce::Colours::white);
+    envelopeControlRateButton.setTooltip("Envelope Control Rate\n"
+                                         "The transient detector behind the envelope shapers runs at the base rate\n"
+                                         "and is interpolated up to the oversampled rate");
+    addAndMakeVisible(envelopeControlRateButton);
+    envelopeControlRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(apvts, "ENVELOPE_CONTROL_RATE", envelopeControlRateButton);
+
     // === ENVELOPE SHAPING CONTROLS ===
     envelopeLabel.setText("ENVELOPE SHAPING (PUNCH / SUSTAIN EMPHASIS)", juce::dontSendNotification);
     envelopeLabel.setFont(juce::Font(10.0f, juce::Font::bold));
@@ -1242,6 +1353,30 @@ void AdvancedPanel::resized()
     slCompButton.setBounds(cx, y - 3, compBtnW, compBtnH);
     cx += compBtnW + compGap;
     flCompButton.setBounds(cx, y - 3, compBtnW, compBtnH);
+
+    y += compBtnH + 10;
+
+    // ========== ROW 4: PATH OVERSAMPLING (columns match the compensation buttons) ==========
+    pathOversamplingLabel.setBounds(bounds.getX(), y, 140, headerHeight);
+    cx = bounds.getX() + 150;
+    hcOversamplingCombo.setBounds(cx, y - 3, compBtnW, compBtnH);
+    cx += compBtnW + compGap;
+    scOversamplingCombo.setBounds(cx, y - 3, compBtnW, compBtnH);
+    cx += compBtnW + compGap;
+    slOversamplingCombo.setBounds(cx, y - 3, compBtnW, compBtnH);
+    cx += compBtnW + compGap;
+    flOversamplingCombo.setBounds(cx, y - 3, compBtnW, compBtnH);
+    cx += compBtnW + compGap;
+    adaptiveOversamplingButton.setBounds(cx, y - 3, 110, compBtnH);
+
+    y += compBtnH + 10;
+
+    // ========== ROW 5: CONTROL RATE ==========
+    controlRateLabel.setBounds(bounds.getX(), y, 140, headerHeight);
+    cx = bounds.getX() + 150;
+    limiterControlRateButton.setBounds(cx, y - 3, 130, compBtnH);
+    cx += 130 + compGap;
+    envelopeControlRateButton.setBounds(cx, y - 3, 140, compBtnH);
 }
 
 void AdvancedPanel::setVisible(bool shouldBeVisible)
@@ -1251,10 +1386,9 @@ void AdvancedPanel::setVisible(bool shouldBeVisible)
 
 AdvancedPanel::~AdvancedPanel()
 {
-    stopTimer();
 }
 
-void AdvancedPanel::timerCallback()
+void AdvancedPanel::refresh(const MeterSnapshot&)
 {
     // Update envelope slider colors to match processor colors
     hcAttackSlider.setColour(juce::Slider::thumbColourId, processor.processorColors.hardClip);
@@ -1399,17 +1533,22 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     : AudioProcessorEditor(&p),
       audioProcessor(p),
       xyPad(p.apvts, "XY_X_PARAM", "XY_Y_PARAM", p),
-      calibrationPanel(p.apvts, p),
-      advancedPanel(p.apvts, p),
-      preferencesPanel(p),
-      steveScope(p),
-      transferCurveMeter(p),  // Transfer curve with level meter
       inputMeter(p, true),    // Stereo input meter
-      outputMeter(p, false)   // Stereo output meter
+      outputMeter(p, false),  // Stereo output meter
+      refreshScheduler(p, *this)
 {
+    audioProcessor.editorOpen.store(true);
+
     // Apply custom look and feel
     setLookAndFeel(&lookAndFeel);
 
+    // Display-synced refresh: each client runs at its own rate, only while showing
+    refreshScheduler.addClient(inputMeter, inputMeter, 60.0);
+    refreshScheduler.addClient(outputMeter, outputMeter, 60.0);
+    refreshScheduler.addClient(xyPad, xyPad, 30.0);
+    refreshScheduler.addClient(*this, *this, 10.0);
+    // Scope, transfer curve and panels register themselves when first shown
+
     setSize(1000, 610);  // Default size - compact, scope/advanced panels expand below
     setResizable(true, true);
     setResizeLimits(800, 610, 1900, 1200);  // Min 800x610, Max with panels expanded
@@ -1417,9 +1556,8 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     // Setup XY Pad
     addAndMakeVisible(xyPad);
 
-    // Setup Visualizations (these go first so panels can overlay)
-    addChildComponent(steveScope);          // Hidden by default - shown when SCOPE is clicked
-    addChildComponent(transferCurveMeter);  // Transfer curve with level meter (hidden by default)
+    // Setup Visualizations (scope and transfer curve are inserted above the XY pad
+    // when first shown, so panels can still overlay them)
     addAndMakeVisible(inputMeter);          // Stereo input meter
     addAndMakeVisible(outputMeter);         // Stereo output meter
 
@@ -1429,7 +1567,8 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     transferCurveToggleButton.setColour(juce::TextButton::buttonColourId, juce::Colour(35, 35, 40));
     transferCurveToggleButton.setColour(juce::TextButton::textColourOffId, juce::Colours::white.withAlpha(0.85f));
     transferCurveToggleButton.onClick = [this]() {
-        transferCurveMeter.setVisible(!transferCurveMeter.isVisible());
+        auto& meter = getTransferCurveMeter();
+        meter.setVisible(!meter.isVisible());
         resized();  // Re-layout when panel visibility changes
     };
     addAndMakeVisible(transferCurveToggleButton);
@@ -1442,7 +1581,8 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     addAndMakeVisible(calibrationToggleButton);
 
     calibrationToggleButton.onClick = [this]() {
-        calibrationPanel.setVisible(!calibrationPanel.isVisible());
+        auto& panel = getCalibrationPanel();
+        panel.setVisible(!panel.isVisible());
         resized();  // Re-layout when panel visibility changes
     };
     // Note: Button text and colors are dynamically updated in timerCallback() based on normalization state
@@ -1746,23 +1886,20 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     preferencesButton.onClick = [this]()
     {
         // Toggle preferences panel visibility
-        bool shouldShow = !preferencesPanel.isVisible();
-        preferencesPanel.setVisible(shouldShow);
+        auto& panel = getPreferencesPanel();
+        bool shouldShow = !panel.isVisible();
+        panel.setVisible(shouldShow);
 
         // Position the panel near the button and bring to front
         if (shouldShow)
         {
             auto buttonBounds = preferencesButton.getBoundsInParent();
-            preferencesPanel.setBounds(buttonBounds.getX() - 80, buttonBounds.getBottom() + 5, 200, 210);
-            preferencesPanel.toFront(false);  // Bring to front so it shows on top
+            panel.setBounds(buttonBounds.getX() - 80, buttonBounds.getBottom() + 5, 200, 210);
+            panel.toFront(false);  // Bring to front so it shows on top
         }
     };
     addAndMakeVisible(preferencesButton);
 
-    // Add preferences panel (initially hidden - must start closed)
-    preferencesPanel.setVisible(false);
-    addChildComponent(preferencesPanel);  // Use addChildComponent so it starts hidden
-
     // Scope Toggle Button - expands window to show oscilloscope below 600px
     scopeToggleButton.setButtonText("SCOPE");
     scopeToggleButton.setClickingTogglesState(true);
@@ -1778,15 +1915,16 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
         if (scopeToggleButton.getToggleState())
         {
             // Expand window to show scope
-            steveScope.setVisible(true);
+            getSteveScope().setVisible(true);
             setSize(getWidth(), baseHeight + scopeHeight);
         }
         else
         {
             // Collapse window, hide scope
-            steveScope.setVisible(false);
+            if (steveScope != nullptr)
+                steveScope->setVisible(false);
             // Only shrink if advanced panel is also hidden
-            if (!advancedPanel.isVisible())
+            if (!isShown(advancedPanel.get()))
                 setSize(getWidth(), baseHeight);
         }
         resized();
@@ -1803,26 +1941,26 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     advancedToggleButton.setColour(juce::TextButton::textColourOnId, juce::Colours::white);
     advancedToggleButton.onClick = [this]() {
         const int baseHeight = 610;
-        const int advancedHeight = 290;  // Height to fit panel snugly (280 scaled + padding)
+        const int advancedHeight = 358;  // Height to fit panel snugly (348 scaled + padding)
 
         if (advancedToggleButton.getToggleState())
         {
             // Expand window to show advanced panel
-            advancedPanel.setVisible(true);
+            getAdvancedPanel().setVisible(true);
             setSize(getWidth(), baseHeight + advancedHeight);
         }
         else
         {
             // Collapse window, hide advanced panel
-            advancedPanel.setVisible(false);
+            if (advancedPanel != nullptr)
+                advancedPanel->setVisible(false);
             // Only shrink if scope is also hidden
-            if (!steveScope.isVisible())
+            if (!isShown(steveScope.get()))
                 setSize(getWidth(), baseHeight);
         }
         resized();
     };
     addAndMakeVisible(advancedToggleButton);
-    addChildComponent(advancedPanel);  // Use addChildComponent to keep panel hidden initially
 
     // Setup Sliders - Global Controls (proportional sizing)
     auto setupRotarySlider = [this](juce::Slider& slider, juce::Label& label, const juce::String& text)
@@ -1889,8 +2027,6 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     };
     addAndMakeVisible(resetTrimsButton);
 
-    // Start timer for updating normalization display (now in CalibrationPanel)
-    startTimerHz(10);  // 10 Hz update rate
 
     // Setup Trim Sliders (proportional to main knobs) with processor colors
     auto setupTrimSlider = [this](juce::Slider& slider, juce::Label& label, const juce::String& text, int processorIndex)
@@ -2156,6 +2292,38 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     processingModeCombo.setJustificationType(juce::Justification::centred);
     addAndMakeVisible(processingModeCombo);
 
+    // Setup Clip Anti-Aliasing Selector (ADAA for Hard/Soft Clip)
+    clipAntiAliasCombo.addItem("AA Off", 1);
+    clipAntiAliasCombo.addItem("ADAA 1", 2);
+    clipAntiAliasCombo.addItem("ADAA 2", 3);
+    clipAntiAliasCombo.setColour(juce::ComboBox::backgroundColourId, juce::Colour(35, 35, 40));
+    clipAntiAliasCombo.setColour(juce::ComboBox::textColourId, juce::Colours::white.withAlpha(0.9f));
+    clipAntiAliasCombo.setColour(juce::ComboBox::outlineColourId, juce::Colour(60, 60, 65));
+    clipAntiAliasCombo.setColour(juce::ComboBox::buttonColourId, juce::Colour(50, 50, 55));
+    clipAntiAliasCombo.setJustificationType(juce::Justification::centred);
+    clipAntiAliasCombo.setTooltip("Clip Anti-Aliasing (ADAA)\n"
+                                  "Reduces aliasing from Hard/Soft Clip without more oversampling\n"
+                                  "Most useful in Zero Latency; adds 0.5 (1st) or 1 (2nd) sample delay to the clip paths");
+    addAndMakeVisible(clipAntiAliasCombo);
+
+    // Setup Oversampling Factor Selector (overrides the engine's default factor)
+    oversamplingCombo.addItem("OS Auto", 1);
+    oversamplingCombo.addItem("2x", 2);
+    oversamplingCombo.addItem("4x", 3);
+    oversamplingCombo.addItem("8x", 4);
+    oversamplingCombo.addItem("16x", 5);
+    oversamplingCombo.addItem("32x", 6);
+    oversamplingCombo.setColour(juce::ComboBox::backgroundColourId, juce::Colour(35, 35, 40));
+    oversamplingCombo.setColour(juce::ComboBox::textColourId, juce::Colours::white.withAlpha(0.9f));
+    oversamplingCombo.setColour(juce::ComboBox::outlineColourId, juce::Colour(60, 60, 65));
+    oversamplingCombo.setColour(juce::ComboBox::buttonColourId, juce::Colour(50, 50, 55));
+    oversamplingCombo.setJustificationType(juce::Justification::centred);
+    oversamplingCombo.setTooltip("Oversampling Factor\n"
+                                 "Auto uses the engine default (Balanced 8x, Linear Phase 16x)\n"
+                                 "Lower factors save CPU and latency; 32x is for offline rendering\n"
+                                 "Ignored in Zero Latency; reported latency follows the factor");
+    addAndMakeVisible(oversamplingCombo);
+
     // Setup Version Label (upper right corner)
     versionLabel.setText("v" + kPluginVersion, juce::dontSendNotification);
     versionLabel.setJustificationType(juce::Justification::centredRight);
@@ -2223,6 +2391,10 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
 
     processingModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         p.apvts, "PROCESSING_MODE", processingModeCombo);
+    clipAntiAliasAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        p.apvts, "CLIP_ANTIALIAS", clipAntiAliasCombo);
+    oversamplingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        p.apvts, "OVERSAMPLING", oversamplingCombo);
 
     // Initialize Master Comp to match Delta Mode state on plugin load
     auto* deltaModeParam = p.apvts.getRawParameterValue("DELTA_MODE");
@@ -2230,27 +2402,82 @@ QuadBlendDriveAudioProcessorEditor::QuadBlendDriveAudioProcessorEditor(QuadBlend
     if (auto* masterCompParam = p.apvts.getParameter("MASTER_COMP"))
         masterCompParam->setValueNotifyingHost(deltaModeOn ? 1.0f : 0.0f);
 
-    // Add CalibrationPanel LAST so it appears on top of all other controls
-    addChildComponent(calibrationPanel);  // Use addChildComponent to keep panel hidden initially
-
     // Initialize ABCD button states
     updateABCDButtonStates();
 }
 
 QuadBlendDriveAudioProcessorEditor::~QuadBlendDriveAudioProcessorEditor()
 {
-    stopTimer();
+    audioProcessor.editorOpen.store(false);
     setLookAndFeel(nullptr);
 }
 
-void QuadBlendDriveAudioProcessorEditor::timerCallback()
+CalibrationPanel& QuadBlendDriveAudioProcessorEditor::getCalibrationPanel()
+{
+    if (calibrationPanel == nullptr)
+    {
+        calibrationPanel = std::make_unique<CalibrationPanel>(audioProcessor.apvts, audioProcessor);
+        refreshScheduler.addClient(*calibrationPanel, *calibrationPanel, 15.0);
+        addChildComponent(*calibrationPanel);  // On top of all other controls
+    }
+    return *calibrationPanel;
+}
+
+AdvancedPanel& QuadBlendDriveAudioProcessorEditor::getAdvancedPanel()
+{
+    if (advancedPanel == nullptr)
+    {
+        advancedPanel = std::make_unique<AdvancedPanel>(audioProcessor.apvts, audioProcessor);
+        refreshScheduler.addClient(*advancedPanel, *advancedPanel, 15.0);
+        addChildComponent(*advancedPanel, getIndexOfChildComponent(&advancedToggleButton) + 1);
+    }
+    return *advancedPanel;
+}
+
+PreferencesPanel& QuadBlendDriveAudioProcessorEditor::getPreferencesPanel()
+{
+    if (preferencesPanel == nullptr)
+    {
+        preferencesPanel = std::make_unique<PreferencesPanel>(audioProcessor);
+        addChildComponent(*preferencesPanel);
+    }
+    return *preferencesPanel;
+}
+
+STEVEScope& QuadBlendDriveAudioProcessorEditor::getSteveScope()
+{
+    if (steveScope == nullptr)
+    {
+        // Layer images are allocated on first paint, at the size it is laid out to
+        steveScope = std::make_unique<STEVEScope>(audioProcessor);
+        refreshScheduler.addClient(*steveScope, *steveScope, 30.0);
+        addChildComponent(*steveScope, getIndexOfChildComponent(&xyPad) + 1);
+    }
+    return *steveScope;
+}
+
+TransferCurveMeter& QuadBlendDriveAudioProcessorEditor::getTransferCurveMeter()
+{
+    if (transferCurveMeter == nullptr)
+    {
+        transferCurveMeter = std::make_unique<TransferCurveMeter>(audioProcessor);
+        refreshScheduler.addClient(*transferCurveMeter, *transferCurveMeter, 60.0);
+        addChildComponent(*transferCurveMeter, getIndexOfChildComponent(&xyPad) + 1);
+    }
+    return *transferCurveMeter;
+}
+
+void QuadBlendDriveAudioProcessorEditor::refresh(const MeterSnapshot& snapshot)
 {
     // Update normalization display labels in CalibrationPanel
-    double peakDB = audioProcessor.currentPeakDB.load();
-    double gainDB = audioProcessor.normalizationGainDB.load();
+    double peakDB = snapshot.inputPeakDB;
+    double gainDB = snapshot.normalizationGainDB;
 
-    calibrationPanel.updateInputPeakDisplay(peakDB);
-    calibrationPanel.updateGainAppliedDisplay(gainDB);
+    if (calibrationPanel != nullptr)
+    {
+        calibrationPanel->updateInputPeakDisplay(peakDB);
+        calibrationPanel->updateGainAppliedDisplay(gainDB);
+    }
 
     // Update trim slider colors if processor colors have changed
     hcTrimSlider.setColour(juce::Slider::thumbColourId, audioProcessor.processorColors.hardClip);
@@ -2276,7 +2503,8 @@ void QuadBlendDriveAudioProcessorEditor::timerCallback()
     // Update Learn toggle button based on normalization state
     // Visual feedback shows normalization status even when panel is collapsed
     // Only lights up when Apply button is actually toggled ON (not just when learned)
-    bool normalizationEnabled = calibrationPanel.isNormalizationEnabled();
+    // (Normalization can only be applied from the panel, so an unbuilt panel means off)
+    bool normalizationEnabled = calibrationPanel != nullptr && calibrationPanel->isNormalizationEnabled();
     if (normalizationEnabled)
     {
         // APPLIED: Active/lit state with bright accent color and indicator
@@ -2439,6 +2667,8 @@ void QuadBlendDriveAudioProcessorEditor::resized()
     const int quickPresetWidth = static_cast<int>(26 * scale);
     const int engineLabelWidth = static_cast<int>(55 * scale);
     const int engineComboWidth = static_cast<int>(115 * scale);
+    const int antiAliasComboWidth = static_cast<int>(75 * scale);
+    const int oversamplingComboWidth = static_cast<int>(70 * scale);
     const int undoRedoWidth = static_cast<int>(42 * scale);
     const int helpBtnWidth = static_cast<int>(24 * scale);
     const int versionWidth = static_cast<int>(50 * scale);
@@ -2468,6 +2698,14 @@ void QuadBlendDriveAudioProcessorEditor::resized()
     processingModeLabel.setBounds(toolbarX, toolbarY, engineLabelWidth, toolbarButtonHeight);
     toolbarX += engineLabelWidth + static_cast<int>(4 * scale);
     processingModeCombo.setBounds(toolbarX, toolbarY, engineComboWidth, toolbarButtonHeight);
+    toolbarX += engineComboWidth + static_cast<int>(6 * scale);
+
+    // Clip anti-aliasing combo (next to the engine it complements)
+    clipAntiAliasCombo.setBounds(toolbarX, toolbarY, antiAliasComboWidth, toolbarButtonHeight);
+    toolbarX += antiAliasComboWidth + static_cast<int>(6 * scale);
+
+    // Oversampling factor combo
+    oversamplingCombo.setBounds(toolbarX, toolbarY, oversamplingComboWidth, toolbarButtonHeight);
 
     // Right side of toolbar: Colors, Undo, Redo, Help, Version
     const int colorsBtnWidth = static_cast<int>(55 * scale);
@@ -2492,11 +2730,11 @@ void QuadBlendDriveAudioProcessorEditor::resized()
     auto titleArea = bounds.removeFromTop(static_cast<int>(70 * scale));
 
     // Calibration Panel - Below toolbar when expanded
-    if (calibrationPanel.isVisible())
+    if (isShown(calibrationPanel.get()))
     {
         const int panelWidth = static_cast<int>(250 * scale);
         const int panelHeight = 200;
-        calibrationPanel.setBounds(toolbarPadding,
+        calibrationPanel->setBounds(toolbarPadding,
                                   toolbarHeight + static_cast<int>(5 * scale),
                                   panelWidth,
                                   panelHeight);
@@ -2642,17 +2880,17 @@ void QuadBlendDriveAudioProcessorEditor::resized()
 
     // Advanced Panel - Overlays waveform meter when visible
     // Positioned absolutely to overlay the bottom section
-    if (advancedPanel.isVisible())
+    if (isShown(advancedPanel.get()))
     {
         const int advancedPanelWidth = static_cast<int>(600 * scale);  // Wider for two-column layout
-        const int advancedPanelHeight = static_cast<int>(280 * scale);  // Reduced height (horizontal gain comp layout)
+        const int advancedPanelHeight = static_cast<int>(348 * scale);  // Gain comp, path oversampling and control rate rows
         int advancedPanelY = advancedButtonY + advancedButtonHeight + static_cast<int>(8 * scale);
         int advancedPanelX = centerSection.getX() + (xyAvailableWidth - advancedPanelWidth) / 2;
-        advancedPanel.setBounds(advancedPanelX, advancedPanelY, advancedPanelWidth, advancedPanelHeight);
+        advancedPanel->setBounds(advancedPanelX, advancedPanelY, advancedPanelWidth, advancedPanelHeight);
     }
-    else
+    else if (advancedPanel != nullptr)
     {
-        advancedPanel.setBounds(0, 0, 0, 0);  // Hide when not visible
+        advancedPanel->setBounds(0, 0, 0, 0);  // Hide when not visible
     }
 
     // ========== RIGHT SECTION (OUTPUT CONTROLS) ==========
@@ -2742,20 +2980,21 @@ void QuadBlendDriveAudioProcessorEditor::resized()
     outputMeter.setBounds(meterStartX + meterWidth + meterGap, meterArea.getY(), meterWidth, meterArea.getHeight());
 
     // ========== SCOPE AREA (when visible) ==========
-    if (steveScope.isVisible())
+    if (isShown(steveScope.get()))
     {
         // Scope starts below the button row (RESET TRIMS, ADVANCED, SCOPE buttons)
         const int scopeStartY = advancedButtonY + advancedButtonHeight + static_cast<int>(8 * scale);
         scopeArea = juce::Rectangle<int>(0, scopeStartY, getWidth(), getHeight() - scopeStartY);
-        steveScope.setBounds(scopeArea.reduced(padding, padding));
+        steveScope->setBounds(scopeArea.reduced(padding, padding));
     }
-    else
+    else if (steveScope != nullptr)
     {
         // When hidden, make sure it's not visible
-        steveScope.setBounds(0, 0, 0, 0);
+        steveScope->setBounds(0, 0, 0, 0);
     }
 
     // Transfer Curve toggle button and meter (hidden, not used in current layout)
     transferCurveToggleButton.setBounds(0, 0, 0, 0);
-    transferCurveMeter.setBounds(0, 0, 0, 0);
+    if (transferCurveMeter != nullptr)
+        transferCurveMeter->setBounds(0, 0, 0, 0);
 }
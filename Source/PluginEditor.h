@@ -8,6 +8,7 @@
 #include "StereoMeter.h"
 #include "STEVELookAndFeel.h"
 #include "STEVEScope.h"
+#include "RefreshScheduler.h"
 
 // Master Meter Component
 class MasterMeter : public juce::Component, private juce::Timer
@@ -43,14 +44,19 @@ public:
 private:
     void timerCallback() override;
     void paintGRTrace(juce::Graphics& g, juce::Rectangle<float> graphBounds, float scale);
+    void renderBackground(float pixelScale);
 
     QuadBlendDriveAudioProcessor& processor;
     static constexpr int displaySize = 90;  // 3 seconds at 30fps (matches GR meter)
     int displayCursorPos = 0;
+
+    // Static background (gradient, title, reference lines, labels, border), rebuilt on resize
+    juce::Image backgroundCache;
+    float backgroundScale = 0.0f;
 };
 
 // Custom XY Pad Component
-class XYPad : public juce::Component, private juce::Timer
+class XYPad : public juce::Component, public RefreshScheduler::Client
 {
 public:
     XYPad(juce::AudioProcessorValueTreeState& apvts,
@@ -66,10 +72,18 @@ public:
     void mouseDoubleClick(const juce::MouseEvent& event) override;
     void resized() override;
 
+    // Per-frame update from the editor's RefreshScheduler (30fps)
+    void refresh(const MeterSnapshot& snapshot) override;
+
 private:
-    void timerCallback() override;
     void updateParameters(juce::Point<float> position);
 
+    // GR values from the latest meter snapshot (ring glow + corner indicators)
+    float hcGR = 0.0f, scGR = 0.0f, slGR = 0.0f, flGR = 0.0f;
+
+    // Mutes, trims, colors and quantized GR as last drawn - repaint only on change
+    std::array<int, 16> drawnState{};
+
     juce::AudioProcessorValueTreeState& apvts;
     juce::String xParamID, yParamID;
     QuadBlendDriveAudioProcessor& processor;
@@ -85,7 +99,7 @@ private:
 };
 
 // Calibration Panel (Collapsible)
-class CalibrationPanel : public juce::Component, private juce::Timer
+class CalibrationPanel : public juce::Component, public RefreshScheduler::Client
 {
 public:
     CalibrationPanel(juce::AudioProcessorValueTreeState& apvts, QuadBlendDriveAudioProcessor& processor);
@@ -104,8 +118,10 @@ public:
     // Check if normalization is currently engaged
     bool isNormalizationEnabled() const { return normalizeButton.getToggleState(); }
 
+    // Color updates from the editor's RefreshScheduler (15fps, only while open)
+    void refresh(const MeterSnapshot& snapshot) override;
+
 private:
-    void timerCallback() override;
 
     juce::AudioProcessorValueTreeState& apvts;
     QuadBlendDriveAudioProcessor& processor;
@@ -123,7 +139,7 @@ private:
 };
 
 // Advanced DSP Parameters Panel
-class AdvancedPanel : public juce::Component, private juce::Timer
+class AdvancedPanel : public juce::Component, public RefreshScheduler::Client
 {
 public:
     AdvancedPanel(juce::AudioProcessorValueTreeState& apvts, QuadBlendDriveAudioProcessor& processor);
@@ -135,8 +151,10 @@ public:
     void setVisible(bool shouldBeVisible) override;
     bool isOpen() const { return getLocalBounds().getHeight() > 0; }
 
+    // Color updates from the editor's RefreshScheduler (15fps, only while open)
+    void refresh(const MeterSnapshot& snapshot) override;
+
 private:
-    void timerCallback() override;
 
     juce::AudioProcessorValueTreeState& apvts;
     QuadBlendDriveAudioProcessor& processor;
@@ -164,6 +182,16 @@ private:
     // Gain Compensation controls
     juce::ToggleButton hcCompButton, scCompButton, slCompButton, flCompButton;
 
+    // Per-path oversampling (each processor's rate inside the XY blend)
+    juce::Label pathOversamplingLabel;
+    juce::ComboBox hcOversamplingCombo, scOversamplingCombo, slOversamplingCombo, flOversamplingCombo;
+    juce::ToggleButton adaptiveOversamplingButton;  // Idle the oversampler while every path is linear
+
+    // Control-rate detection (limiters and the envelope shapers' transient detector)
+    juce::Label controlRateLabel;
+    juce::ToggleButton limiterControlRateButton;  // Slow/fast limiter detection at the base rate
+    juce::ToggleButton envelopeControlRateButton; // Shared transient detection at the base rate
+
     // === ENVELOPE SHAPING CONTROLS ===
     juce::Label envelopeLabel;  // Section header
 
@@ -193,6 +221,13 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> scCompAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> slCompAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> flCompAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> hcOversamplingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> scOversamplingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> slOversamplingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> flOversamplingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> adaptiveOversamplingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> limiterControlRateAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> envelopeControlRateAttachment;
 
     // Envelope shaping attachments
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> hcAttackAttachment;
@@ -304,7 +339,7 @@ private:
     juce::TextButton resetButton{"Reset to Defaults"};
 };
 
-class QuadBlendDriveAudioProcessorEditor : public juce::AudioProcessorEditor, private juce::Timer
+class QuadBlendDriveAudioProcessorEditor : public juce::AudioProcessorEditor, private RefreshScheduler::Client
 {
 public:
     QuadBlendDriveAudioProcessorEditor(QuadBlendDriveAudioProcessor&);
@@ -314,29 +349,40 @@ public:
     void resized() override;
 
 private:
-    void timerCallback() override;
+    // Slow (10fps) editor-level updates: calibration readouts, colors, undo/redo, TPL, threshold link
+    void refresh(const MeterSnapshot& snapshot) override;
     void updateABCDButtonStates();  // Update ABCD button visual states
 
+    // Hidden panels and visualisers are built (with their attachments and refresh
+    // registration) the first time they are shown, keeping editor open cheap
+    CalibrationPanel& getCalibrationPanel();
+    AdvancedPanel& getAdvancedPanel();
+    PreferencesPanel& getPreferencesPanel();
+    STEVEScope& getSteveScope();
+    TransferCurveMeter& getTransferCurveMeter();
+
+    static bool isShown(const juce::Component* c) { return c != nullptr && c->isVisible(); }
+
     QuadBlendDriveAudioProcessor& audioProcessor;
 
     // XY Pad
     XYPad xyPad;
 
-    // Calibration Panel
-    CalibrationPanel calibrationPanel;
+    // Calibration Panel (constructed on first show)
+    std::unique_ptr<CalibrationPanel> calibrationPanel;
     juce::TextButton calibrationToggleButton;
 
-    // Advanced Panel
-    AdvancedPanel advancedPanel;
+    // Advanced Panel (constructed on first show)
+    std::unique_ptr<AdvancedPanel> advancedPanel;
     juce::TextButton advancedToggleButton;
 
-    // Preferences Panel
-    PreferencesPanel preferencesPanel;
+    // Preferences Panel (constructed on first show)
+    std::unique_ptr<PreferencesPanel> preferencesPanel;
     juce::TextButton preferencesButton;
 
-    // Visualizations
-    STEVEScope steveScope;  // Comprehensive waveform scope with settings menu
-    TransferCurveMeter transferCurveMeter;  // Transfer curve with level meter
+    // Visualizations (scope and transfer curve are constructed on first show)
+    std::unique_ptr<STEVEScope> steveScope;  // Comprehensive waveform scope with settings menu
+    std::unique_ptr<TransferCurveMeter> transferCurveMeter;  // Transfer curve with level meter
     juce::TextButton transferCurveToggleButton;  // Toggle button for transfer curve
     StereoMeter inputMeter;   // Stereo input meter
     StereoMeter outputMeter;  // Stereo output meter
@@ -382,6 +428,12 @@ private:
     juce::ComboBox processingModeCombo;
     juce::Label processingModeLabel;
 
+    // Clip Anti-Aliasing Selector (Off, ADAA 1st/2nd order)
+    juce::ComboBox clipAntiAliasCombo;
+
+    // Oversampling Factor Selector (engine default, 2x-32x)
+    juce::ComboBox oversamplingCombo;
+
     // Version Label (upper right corner)
     juce::Label versionLabel;
 
@@ -436,6 +488,8 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> truePeakEnableAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> processingModeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> clipAntiAliasAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> oversamplingAttachment;
 
     // Custom look and feel
     STEVELookAndFeel lookAndFeel;
@@ -445,5 +499,9 @@ private:
     juce::File currentPresetPath;
     int currentABCDSlot{-1};  // -1 = none, 0-3 = A/B/C/D
 
+    // Single vblank-driven refresh for all animated components
+    // Declared last so it stops dispatching before any client is destroyed
+    RefreshScheduler refreshScheduler;
+
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(QuadBlendDriveAudioProcessorEditor)
 };
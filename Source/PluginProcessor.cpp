@@ -9,10 +9,130 @@ QuadBlendDriveAudioProcessor::QuadBlendDriveAudioProcessor()
                          .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
       apvts(*this, &undoManager, "Parameters", createParameterLayout())
 {
+    // Resolve the audio thread's parameters once; processBlock only dereferences these
+    const std::pair<const char*, float ParameterSnapshot::*> bindings[] = {
+        { "XY_X_PARAM", &ParameterSnapshot::xyX },
+        { "XY_Y_PARAM", &ParameterSnapshot::xyY },
+        { "THRESHOLD", &ParameterSnapshot::thresholdDB },
+        { "SC_KNEE", &ParameterSnapshot::scKneePercent },
+        { "LIMIT_REL", &ParameterSnapshot::limitRelMs },
+        { "SL_LIMIT_ATTACK", &ParameterSnapshot::slAttackMs },
+        { "FL_LIMIT_ATTACK", &ParameterSnapshot::flAttackMs },
+        { "FL_LIMIT_RELEASE", &ParameterSnapshot::flReleaseMs },
+        { "INPUT_GAIN", &ParameterSnapshot::inputGainDB },
+        { "OUTPUT_GAIN", &ParameterSnapshot::outputGainDB },
+        { "MIX_WET", &ParameterSnapshot::mixWetPercent },
+        { "HC_TRIM", &ParameterSnapshot::hcTrimDB },
+        { "SC_TRIM", &ParameterSnapshot::scTrimDB },
+        { "SL_TRIM", &ParameterSnapshot::slTrimDB },
+        { "FL_TRIM", &ParameterSnapshot::flTrimDB },
+        { "HC_MUTE", &ParameterSnapshot::hcMute },
+        { "SC_MUTE", &ParameterSnapshot::scMute },
+        { "SL_MUTE", &ParameterSnapshot::slMute },
+        { "FL_MUTE", &ParameterSnapshot::flMute },
+        { "HC_SOLO", &ParameterSnapshot::hcSolo },
+        { "SC_SOLO", &ParameterSnapshot::scSolo },
+        { "SL_SOLO", &ParameterSnapshot::slSolo },
+        { "FL_SOLO", &ParameterSnapshot::flSolo },
+        { "HC_COMP", &ParameterSnapshot::hcComp },
+        { "SC_COMP", &ParameterSnapshot::scComp },
+        { "SL_COMP", &ParameterSnapshot::slComp },
+        { "FL_COMP", &ParameterSnapshot::flComp },
+        { "HC_ATTACK", &ParameterSnapshot::hcAttackDB },
+        { "HC_SUSTAIN", &ParameterSnapshot::hcSustainDB },
+        { "SC_ATTACK", &ParameterSnapshot::scAttackDB },
+        { "SC_SUSTAIN", &ParameterSnapshot::scSustainDB },
+        { "SL_ATTACK", &ParameterSnapshot::slAttackDB },
+        { "SL_SUSTAIN", &ParameterSnapshot::slSustainDB },
+        { "FL_ATTACK", &ParameterSnapshot::flAttackDB },
+        { "FL_SUSTAIN", &ParameterSnapshot::flSustainDB },
+        { "BYPASS", &ParameterSnapshot::bypass },
+        { "DELTA_MODE", &ParameterSnapshot::deltaMode },
+        { "MASTER_COMP", &ParameterSnapshot::masterComp },
+        { "AGC_ENABLE", &ParameterSnapshot::agcEnable },
+        { "PROCESSING_MODE", &ParameterSnapshot::processingMode },
+        { "CHANNEL_MODE", &ParameterSnapshot::channelMode },
+        { "CHANNEL_LINK", &ParameterSnapshot::channelLinkPercent },
+        { "CHANNEL_LINK_GROUPS", &ParameterSnapshot::channelLinkGroups },
+        { "CLIP_ANTIALIAS", &ParameterSnapshot::clipAntiAlias },
+        { "OVERSAMPLING", &ParameterSnapshot::oversampling },
+        { "HC_OVERSAMPLING", &ParameterSnapshot::hcOversampling },
+        { "SC_OVERSAMPLING", &ParameterSnapshot::scOversampling },
+        { "SL_OVERSAMPLING", &ParameterSnapshot::slOversampling },
+        { "FL_OVERSAMPLING", &ParameterSnapshot::flOversampling },
+        { "LIMIT_CONTROL_RATE", &ParameterSnapshot::limiterControlRate },
+        { "ENVELOPE_CONTROL_RATE", &ParameterSnapshot::envelopeControlRate },
+        { "ADAPTIVE_OS", &ParameterSnapshot::adaptiveOversampling },
+        { "PARALLEL_PATHS", &ParameterSnapshot::parallelPaths },
+        { "OVERSHOOT_ENABLE", &ParameterSnapshot::overshootEnable },
+        { "TRUE_PEAK_ENABLE", &ParameterSnapshot::truePeakEnable },
+        { "OUTPUT_CEILING", &ParameterSnapshot::outputCeilingDB },
+        { "OVERSHOOT_DELTA_MODE", &ParameterSnapshot::overshootDeltaMode },
+        { "TRUE_PEAK_DELTA_MODE", &ParameterSnapshot::truePeakDeltaMode },
+    };
+
+    for (const auto& [paramID, member] : bindings)
+    {
+        auto* value = apvts.getRawParameterValue(paramID);
+        jassert(value != nullptr);  // Parameter ID missing from createParameterLayout()
+        if (value != nullptr)
+            parameterBindings.emplace_back(value, member);
+    }
+
+    // Switches between two engines with different latency, so it is only read per host block
+    pipelinedEngine = apvts.getRawParameterValue("PIPELINED_ENGINE");
+
+    // The worker pools follow their switches (see updateWorkerPools())
+    parallelPaths = apvts.getRawParameterValue("PARALLEL_PATHS");
+    apvts.addParameterListener("PARALLEL_PATHS", this);
+    apvts.addParameterListener("PIPELINED_ENGINE", this);
+
+    readParameterSnapshot();
 }
 
 QuadBlendDriveAudioProcessor::~QuadBlendDriveAudioProcessor()
 {
+    apvts.removeParameterListener("PARALLEL_PATHS", this);
+    apvts.removeParameterListener("PIPELINED_ENGINE", this);
+    cancelPendingUpdate();
+}
+
+// Called from whichever thread changed the parameter (the audio thread for automation)
+void QuadBlendDriveAudioProcessor::parameterChanged(const juce::String&, float)
+{
+    triggerAsyncUpdate();
+}
+
+void QuadBlendDriveAudioProcessor::handleAsyncUpdate()
+{
+    updateWorkerPools();
+}
+
+// Message thread only. Starting or stopping a pool is safe during playback: run() never
+// depends on a worker and simply does every job itself while a pool has none.
+void QuadBlendDriveAudioProcessor::updateWorkerPools()
+{
+    // PARALLEL_PATHS: three workers plus the audio thread cover the four XY paths
+    if (workerPoolsPrepared && parallelPaths->load() > 0.5f)
+    {
+        if (xyWorkers.getNumWorkers() == 0)
+            xyWorkers.start(numXYPaths - 1, preparedBlockSize, currentSampleRate);
+    }
+    else
+    {
+        xyWorkers.stop();
+    }
+
+    // PIPELINED_ENGINE: one worker for the limiter stage
+    if (workerPoolsPrepared && pipelinedEngine->load() > 0.5f)
+    {
+        if (pipelineWorkers.getNumWorkers() == 0)
+            pipelineWorkers.start(1, preparedBlockSize, currentSampleRate);
+    }
+    else
+    {
+        pipelineWorkers.stop();
+    }
 }
 
 //==============================================================================
@@ -267,6 +387,14 @@ QuadBlendDriveAudioProcessor::createParameterLayout()
         juce::String(), juce::AudioProcessorParameter::genericParameter,
         [](float value, int) { return juce::String(static_cast<int>(value)) + " %"; }));
 
+    // Channel Link Groups: which channels of a multichannel bus CHANNEL_LINK links.
+    // All = every channel but the LFE, Bed + Heights = the bed and the height layer
+    // separately, Stereo Pairs = each left/right pair on its own (centres unlinked)
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "CHANNEL_LINK_GROUPS", "Channel Link Groups",
+        juce::StringArray{"All", "Bed + Heights", "Stereo Pairs"},
+        0));  // Default to All (identical to plain stereo linking)
+
     // Auto-Gain Compensation: Match output loudness to input for honest A/B
     layout.add(std::make_unique<juce::AudioParameterBool>(
         "AGC_ENABLE", "Auto-Gain Compensation", false));
@@ -277,6 +405,63 @@ QuadBlendDriveAudioProcessor::createParameterLayout()
         juce::StringArray{"Zero Latency", "Balanced", "Linear Phase"},
         0));  // Default to Zero Latency
 
+    // Oversampling factor for Balanced/Linear Phase (Zero Latency is always 1x)
+    // Engine Default = 8x Balanced / 16x Linear Phase; 32x is meant for offline renders
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "OVERSAMPLING", "Oversampling",
+        juce::StringArray{"Engine Default", "2x", "4x", "8x", "16x", "32x"},
+        0));
+
+    // Per-path oversampling inside the XY blend: each processor can run below the common
+    // rate above (never above it). Smooth limiters alias far less than the clippers.
+    // Lower-rate paths are resampled back and every path is delay-aligned automatically.
+    const juce::StringArray pathOversamplingChoices{"Common", "1x", "2x", "4x", "8x", "16x"};
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "HC_OVERSAMPLING", "Hard Clip Oversampling", pathOversamplingChoices, 0));
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "SC_OVERSAMPLING", "Soft Clip Oversampling", pathOversamplingChoices, 0));
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "SL_OVERSAMPLING", "Slow Limit Oversampling", pathOversamplingChoices, 0));
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "FL_OVERSAMPLING", "Fast Limit Oversampling", pathOversamplingChoices, 0));
+
+    // Limiter Control Rate: the slow/fast limiters detect and compute their gain once per
+    // base-rate sample and ramp it up to their oversampled rate. Saves about a fifth of a
+    // soloed limiter path's CPU (the oversampling filters dominate the rest) but is not
+    // transparent on dense, hot material: attack onsets land at base-rate resolution, so on
+    // loud pink noise single samples differ by up to ~20 dB under the peak (RMS ~25 dB under).
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        "LIMIT_CONTROL_RATE", "Limiter Control Rate", false));
+
+    // Envelope Control Rate: the shared transient detector behind the four envelope
+    // shapers steps once per base-rate sample and interpolates up to the OS rate
+    // (on loud pink noise within ~40 dB of full-rate output at the peak, ~45 dB in RMS)
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        "ENVELOPE_CONTROL_RATE", "Envelope Control Rate", false));
+
+    // Adaptive Oversampling: Balanced/Linear Phase bypass the oversampler through a
+    // latency-matched delay while every XY path is linear (quiet passages, fades, gaps)
+    // and switch it back in, pre-rolled and crossfaded, before anything would saturate
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        "ADAPTIVE_OS", "Adaptive Oversampling", false));
+
+    // Parallel XY Paths: the four XY paths of an oversampled block run at once on a small
+    // real-time worker pool and join before the blend. Bit-identical to running them in turn.
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        "PARALLEL_PATHS", "Parallel XY Paths", false));
+
+    // Pipelined Engine: the oversampled chain up to the mix and the output limiters run as
+    // two pipeline stages on separate cores, for one host block of extra latency
+    layout.add(std::make_unique<juce::AudioParameterBool>(
+        "PIPELINED_ENGINE", "Pipelined Engine", false));
+
+    // Clip Anti-Aliasing: ADAA on Hard/Soft Clip, mainly for Zero Latency where there is
+    // no oversampling. Adds a half-sample (1st order) or one-sample (2nd order) delay.
+    layout.add(std::make_unique<juce::AudioParameterChoice>(
+        "CLIP_ANTIALIAS", "Clip Anti-Aliasing",
+        juce::StringArray{"Off", "ADAA 1st Order", "ADAA 2nd Order"},
+        0));  // Default Off (bit-identical to earlier versions)
+
     return layout;
 }
 
@@ -285,15 +470,29 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
 {
     currentSampleRate = sampleRate;
 
-    // Get current processing mode
+    // processBlockInternal never hands the DSP more than one micro-block, whatever the
+    // host's block size, so all scratch and oversamplers are sized for a micro-block
+    const int maxBlockSize = microBlockSize;
+
+    // Every channel of the main bus runs the same chain; the layout decides which channels
+    // link their limiter detection (CHANNEL_LINK_GROUPS)
+    numBusChannels = juce::jlimit(1, maxChannels, juce::jmax(getTotalNumInputChannels(), getTotalNumOutputChannels()));
+    const auto channelSet = getChannelLayoutOfBus(true, 0);
+    for (int ch = 0; ch < maxChannels; ++ch)
+        busChannelTypes[static_cast<size_t>(ch)] = channelSet.getTypeOfChannel(ch);
+    updateLinkGroups(routing.linkGroups);
+
+    // Get current processing mode and oversampling factor choice
     int processingMode = static_cast<int>(apvts.getRawParameterValue("PROCESSING_MODE")->load());
+    const int oversamplingChoice = static_cast<int>(apvts.getRawParameterValue("OVERSAMPLING")->load());
 
     // ===== ARCHITECTURE A: Global Oversampling Manager =====
-    // Prepare oversampling for entire signal chain
+    // Prepare oversampling for the XY blend, every engine/factor combination up front
     // Mode 0: No OS (multiplier = 1)
-    // Mode 1: 8× OS (multiplier = 8)
-    // Mode 2: 16× OS (multiplier = 16)
-    osManager.prepare(sampleRate, samplesPerBlock, processingMode);
+    // Mode 1: 8× OS by default, Mode 2: 16× by default, OVERSAMPLING overrides (2×-32×)
+    // One oversampler per bus channel, each carrying that channel's wet and dry for phase coherence
+    osManager.prepare(sampleRate, maxBlockSize, 2, numBusChannels, isUsingDoublePrecision(),
+                      processingMode, oversamplingChoice);
 
     // Get OS sample rate for all processor calculations
     const double osSampleRate = osManager.getOsSampleRate();
@@ -314,9 +513,9 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
     constexpr double tplLookaheadMs = 2.0;  // TPL lookahead (separate from XY processors)
 
     // Calculate MAXIMUM lookahead samples (for buffer allocation to support dynamic mode switching)
-    // Use 3ms (Standard mode) at 16x OS rate (Linear Phase mode) at max sample rate (192kHz)
+    // Use 3ms (Standard mode) at the highest OS factor (32x) at max sample rate (192kHz)
     // IMPORTANT: Use hardcoded 192kHz max rate to ensure buffers can handle any sample rate change
-    const int maxOsMultiplier = 16;  // Linear Phase mode
+    const int maxOsMultiplier = OversamplingManager::maxFactor;
     constexpr double maxSystemSampleRate = 192000.0;  // Maximum supported sample rate
     const double maxOsSampleRate = maxSystemSampleRate * maxOsMultiplier;
     const double maxLookaheadMs = 3.0;  // Standard mode
@@ -324,28 +523,72 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
 
     // Calculate CURRENT lookahead samples at current OS rate (used for actual processing)
     lookaheadSamples = static_cast<int>(std::ceil(osSampleRate * xyProcessorLookaheadMs / 1000.0));
-    advancedTPLLookaheadSamples = static_cast<int>(std::ceil(osSampleRate * tplLookaheadMs / 1000.0));
+    advancedTPLLookaheadSamples = static_cast<int>(std::ceil(getProtectionOsSampleRate(processingMode) * tplLookaheadMs / 1000.0));
 
     // Maximum TPL lookahead samples for buffer allocation (handles sample rate changes)
     const int maxTPLLookaheadSamples = static_cast<int>(std::ceil(maxOsSampleRate * tplLookaheadMs / 1000.0));
 
+    // Per-path resamplers for XY paths running below the common rate (all stages up front)
+    for (auto& resampler : xyPathResamplers)
+        resampler.prepare(maxBlockSize * maxOversamplingFactor, numBusChannels);
+
+    // Worst-case alignment: a 1x path under 32x, plus lookahead rounding and whole-sample padding
+    const int maxPathAlignment = xyPathResamplers[0].getLatency(OversamplingManager::maxFactorIndex, 0)
+                               + 2 * OversamplingManager::maxFactor;
+
+    updateXYPathRates({ static_cast<int>(apvts.getRawParameterValue("HC_OVERSAMPLING")->load()),
+                        static_cast<int>(apvts.getRawParameterValue("SC_OVERSAMPLING")->load()),
+                        static_cast<int>(apvts.getRawParameterValue("SL_OVERSAMPLING")->load()),
+                        static_cast<int>(apvts.getRawParameterValue("FL_OVERSAMPLING")->load()) });
+
     // Calculate plugin latency reported to host
-    // Latency = OS filter latency + XY processor lookahead (converted back to base rate)
+    // Latency = OS filter latency + XY processor lookahead + per-path resampling alignment
+    // (converted back to base rate)
     // NOTE: Mode 0 (Zero Latency) skips lookahead entirely, so only report lookahead in Modes 1 & 2
     const int osFilterLatency = osManager.getLatencySamples();  // At base rate
     const int xyLookaheadBaseSamples = (processingMode == 0) ? 0 :
         static_cast<int>(std::ceil(sampleRate * xyProcessorLookaheadMs / 1000.0));
-    totalLatencySamples = osFilterLatency + xyLookaheadBaseSamples;
+    totalLatencySamples = osFilterLatency + xyLookaheadBaseSamples + xyPathAlignment / osMultiplier;
+
+    // PIPELINED_ENGINE adds one host block. Its steps are at most that long, so a bank of
+    // parked micro-blocks holds one step.
+    preparedBlockSize = juce::jmax(samplesPerBlock, 1);
+    pipeline.slicesPerBank = (preparedBlockSize + microBlockSize - 1) / microBlockSize;
+    pipeline.handoffs.assign(static_cast<size_t>(2 * pipeline.slicesPerBank), MicroBlockHandoff{});
+    pipeline.latency = pipelinedEngine->load() > 0.5f ? preparedBlockSize : 0;
+    pipeline.restart = true;
 
     // Report latency to host so DAW can compensate all tracks automatically
-    setLatencySamples(totalLatencySamples);
+    setLatencySamples(totalLatencySamples + pipeline.latency);
+
+    // All lookahead/delay lines share one aligned allocation, each at its max size
+    // so mode and sample rate switches never reallocate on the audio thread
+    DelayMemory::Lengths delayLengths{};
+    delayLengths[DelayMemory::HardClipLookahead] = maxLookaheadSamples;
+    delayLengths[DelayMemory::SoftClipLookahead] = maxLookaheadSamples;
+    delayLengths[DelayMemory::SlowLimitLookahead] = maxLookaheadSamples;
+    delayLengths[DelayMemory::FastLimitLookahead] = maxLookaheadSamples;
+    delayLengths[DelayMemory::DryDelay] = maxLookaheadSamples + maxPathAlignment;
+    delayLengths[DelayMemory::TPLLookahead] = maxTPLLookaheadSamples;
+    delayLengths[DelayMemory::HardClipAlign] = maxPathAlignment;
+    delayLengths[DelayMemory::SoftClipAlign] = maxPathAlignment;
+    delayLengths[DelayMemory::SlowLimitAlign] = maxPathAlignment;
+    delayLengths[DelayMemory::FastLimitAlign] = maxPathAlignment;
+    delayMemory.prepare(delayLengths, numBusChannels);
+
+    for (int path = 0; path < numXYPaths; ++path)
+    {
+        for (int ch = 0; ch < numBusChannels; ++ch)
+            xyPathRates[path].alignBuffer[ch] = delayMemory.getLine(
+                static_cast<DelayMemory::Line>(DelayMemory::HardClipAlign + path), ch);
+    }
 
-    for (int ch = 0; ch < 2; ++ch)
+    for (int ch = 0; ch < numBusChannels; ++ch)
     {
         auto& state = advancedTPLState[ch];
 
         // Initialize lookahead buffer (use max size to handle sample rate changes)
-        state.lookaheadBuffer.resize(maxTPLLookaheadSamples, 0.0);
+        state.lookaheadBuffer = delayMemory.getLine(DelayMemory::TPLLookahead, ch);
         state.lookaheadWritePos = 0;
         state.grEnvelope = 0.0;
         state.lowBandEnv = 0.0;
@@ -353,77 +596,102 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
         state.highBandEnv = 0.0;
         state.currentReleaseCoeff = 0.001;  // Default release
 
-        // Initialize OSM Mode 0 compensation delay buffer (use max size for safety)
-        osmCompensationState[ch].delayBuffer.resize(maxTPLLookaheadSamples, 0.0);
-        osmCompensationState[ch].writePos = 0;
-
         // Initialize dry delay buffer for parallel processing (OS rate)
         // v1.7.6: Delay applied in OS domain for 4-channel sync processing
         // Use maximum OS rate lookahead samples for buffer sizing
-        dryDelayState[ch].delayBuffer.resize(maxLookaheadSamples, 0.0);
+        dryDelayState[ch].delayBuffer = delayMemory.getLine(DelayMemory::DryDelay, ch);
         dryDelayState[ch].writePos = 0;
+    }
 
-        // Design multiband filters for IRC at OS rate
-        const double pi = juce::MathConstants<double>::pi;
-        const double fs = (osSampleRate > 0.0) ? osSampleRate : 44100.0;  // Safe default if somehow 0
+    // ADAPTIVE_OS idle path. Its longest delay is the slowest filters plus 3ms lookahead plus
+    // a 1x path's resampling, all at the base rate; the history also has to reach back over
+    // a pre-roll (twice the filter latency plus the XY delay) and the current micro-block
+    int maxResamplingDelay = 0;
+    for (int index = 1; index <= OversamplingManager::maxFactorIndex; ++index)
+        maxResamplingDelay = juce::jmax(maxResamplingDelay, xyPathResamplers[0].getLatency(index, 0) / (1 << index) + 2);
+
+    const int maxIdleDelay = osManager.getMaxLatencySamples() + maxResamplingDelay
+                           + static_cast<int>(std::ceil(sampleRate * maxLookaheadMs / 1000.0));
+    adaptiveWetDelay.prepare(maxIdleDelay, 2 * maxIdleDelay + 2 * maxBlockSize, numBusChannels);
+    adaptiveDryDelay.prepare(maxIdleDelay, 2 * maxIdleDelay + 2 * maxBlockSize, numBusChannels);
+    adaptiveOs = {};
+    adaptiveOs.holdSamples = juce::roundToInt(sampleRate * 0.1);  // 100ms of linear input before idling
+
+    // MONO DETECTION replay: about twice the slowest filters' latency (as the ADAPTIVE_OS
+    // pre-roll) plus a micro-block, at the base rate and at the highest OS factor
+    const int monoReplaySamples = 2 * osManager.getMaxLatencySamples() + maxBlockSize;
+    monoInputHistory.prepare(monoReplaySamples);
+    monoOsHistory.prepare(monoReplaySamples * maxOversamplingFactor);
+    monoDetection = {};
+
+    // Worker pools for the switches that are on, sized for the new audio period
+    cancelPendingUpdate();
+    xyWorkers.stop();
+    pipelineWorkers.stop();
+    workerPoolsPrepared = true;
+    updateWorkerPools();
+
+    // Design multiband filters for IRC at OS rate (identical for both channels)
+    auto& coeffs = advancedTPLCoeffs;
+    const double pi = juce::MathConstants<double>::pi;
+    const double fs = (osSampleRate > 0.0) ? osSampleRate : 44100.0;  // Safe default if somehow 0
 
-        // Low-pass filter: <200 Hz (2nd order Butterworth)
-        {
-            const double fc = 200.0;
-            const double omega = 2.0 * pi * fc / fs;
-            const double cosw = std::cos(omega);
-            const double sinw = std::sin(omega);
-            const double alpha = sinw / (2.0 * 0.707);  // Q = 0.707 (Butterworth)
-
-            state.lowB0 = (1.0 - cosw) / 2.0;
-            state.lowB1 = 1.0 - cosw;
-            state.lowB2 = (1.0 - cosw) / 2.0;
-            const double a0 = 1.0 + alpha;
-            state.lowA1 = -2.0 * cosw / a0;
-            state.lowA2 = (1.0 - alpha) / a0;
-            state.lowB0 /= a0;
-            state.lowB1 /= a0;
-            state.lowB2 /= a0;
-        }
+    // Low-pass filter: <200 Hz (2nd order Butterworth)
+    {
+        const double fc = 200.0;
+        const double omega = 2.0 * pi * fc / fs;
+        const double cosw = std::cos(omega);
+        const double sinw = std::sin(omega);
+        const double alpha = sinw / (2.0 * 0.707);  // Q = 0.707 (Butterworth)
+
+        coeffs.lowB0 = (1.0 - cosw) / 2.0;
+        coeffs.lowB1 = 1.0 - cosw;
+        coeffs.lowB2 = (1.0 - cosw) / 2.0;
+        const double a0 = 1.0 + alpha;
+        coeffs.lowA1 = -2.0 * cosw / a0;
+        coeffs.lowA2 = (1.0 - alpha) / a0;
+        coeffs.lowB0 /= a0;
+        coeffs.lowB1 /= a0;
+        coeffs.lowB2 /= a0;
+    }
 
-        // Band-pass filter: 200-4000 Hz (2nd order)
-        {
-            const double fc = 1100.0;  // Center frequency
-            const double Q = 0.5;      // Width
-            const double omega = 2.0 * pi * fc / fs;
-            const double cosw = std::cos(omega);
-            const double sinw = std::sin(omega);
-            const double alpha = sinw / (2.0 * Q);
-
-            state.midB0 = alpha;
-            state.midB1 = 0.0;
-            state.midB2 = -alpha;
-            const double a0 = 1.0 + alpha;
-            state.midA1 = -2.0 * cosw / a0;
-            state.midA2 = (1.0 - alpha) / a0;
-            state.midB0 /= a0;
-            state.midB1 /= a0;
-            state.midB2 /= a0;
-        }
+    // Band-pass filter: 200-4000 Hz (2nd order)
+    {
+        const double fc = 1100.0;  // Center frequency
+        const double Q = 0.5;      // Width
+        const double omega = 2.0 * pi * fc / fs;
+        const double cosw = std::cos(omega);
+        const double sinw = std::sin(omega);
+        const double alpha = sinw / (2.0 * Q);
+
+        coeffs.midB0 = alpha;
+        coeffs.midB1 = 0.0;
+        coeffs.midB2 = -alpha;
+        const double a0 = 1.0 + alpha;
+        coeffs.midA1 = -2.0 * cosw / a0;
+        coeffs.midA2 = (1.0 - alpha) / a0;
+        coeffs.midB0 /= a0;
+        coeffs.midB1 /= a0;
+        coeffs.midB2 /= a0;
+    }
 
-        // High-pass filter: >4000 Hz (2nd order Butterworth)
-        {
-            const double fc = 4000.0;
-            const double omega = 2.0 * pi * fc / fs;
-            const double cosw = std::cos(omega);
-            const double sinw = std::sin(omega);
-            const double alpha = sinw / (2.0 * 0.707);  // Q = 0.707
-
-            state.highB0 = (1.0 + cosw) / 2.0;
-            state.highB1 = -(1.0 + cosw);
-            state.highB2 = (1.0 + cosw) / 2.0;
-            const double a0 = 1.0 + alpha;
-            state.highA1 = -2.0 * cosw / a0;
-            state.highA2 = (1.0 - alpha) / a0;
-            state.highB0 /= a0;
-            state.highB1 /= a0;
-            state.highB2 /= a0;
-        }
+    // High-pass filter: >4000 Hz (2nd order Butterworth)
+    {
+        const double fc = 4000.0;
+        const double omega = 2.0 * pi * fc / fs;
+        const double cosw = std::cos(omega);
+        const double sinw = std::sin(omega);
+        const double alpha = sinw / (2.0 * 0.707);  // Q = 0.707
+
+        coeffs.highB0 = (1.0 + cosw) / 2.0;
+        coeffs.highB1 = -(1.0 + cosw);
+        coeffs.highB2 = (1.0 + cosw) / 2.0;
+        const double a0 = 1.0 + alpha;
+        coeffs.highA1 = -2.0 * cosw / a0;
+        coeffs.highA2 = (1.0 - alpha) / a0;
+        coeffs.highB0 /= a0;
+        coeffs.highB1 /= a0;
+        coeffs.highB2 /= a0;
     }
 
     // Calculate oscilloscope buffer size (3000ms = 3 seconds)
@@ -448,7 +716,6 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
     // Low-pass: 2nd order Butterworth at 250 Hz
     // Mid band-pass: 250 Hz - 4 kHz
     // High-pass: 2nd order Butterworth at 4 kHz
-    const double pi = juce::MathConstants<double>::pi;
     const double safeSampleRate = (sampleRate > 0.0) ? sampleRate : 44100.0;  // Safe default
 
     for (int ch = 0; ch < 2; ++ch)
@@ -505,94 +772,68 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
         oscFilters[ch].highZ1 = oscFilters[ch].highZ2 = 0.0;
     }
 
-    // Allocate float buffers
-    dryBufferFloat.setSize(2, samplesPerBlock);
-    tempBuffer1Float.setSize(2, samplesPerBlock);
-    tempBuffer2Float.setSize(2, samplesPerBlock);
-    tempBuffer3Float.setSize(2, samplesPerBlock);
-    tempBuffer4Float.setSize(2, samplesPerBlock);
-    combined4ChFloat.setSize(4, samplesPerBlock);  // 4-channel for phase-coherent processing
-    protectionDeltaCombined4ChFloat.setSize(4, samplesPerBlock);  // Pre-allocated for overshoot delta mode
-
-    // Allocate layer buffers for per-sample per-processor visualization (float)
-    layerInputFloat.setSize(2, samplesPerBlock);
-    layerHardClipFloat.setSize(2, samplesPerBlock);
-    layerSoftClipFloat.setSize(2, samplesPerBlock);
-    layerSlowLimitFloat.setSize(2, samplesPerBlock);
-    layerFastLimitFloat.setSize(2, samplesPerBlock);
-    layerFinalOutputFloat.setSize(2, samplesPerBlock);
-
-    // Allocate double buffers
-    dryBufferDouble.setSize(2, samplesPerBlock);
-    tempBuffer1Double.setSize(2, samplesPerBlock);
-    tempBuffer2Double.setSize(2, samplesPerBlock);
-    tempBuffer3Double.setSize(2, samplesPerBlock);
-    tempBuffer4Double.setSize(2, samplesPerBlock);
-    combined4ChDouble.setSize(4, samplesPerBlock);  // 4-channel for phase-coherent processing
-    protectionDeltaCombined4ChDouble.setSize(4, samplesPerBlock);  // Pre-allocated for overshoot delta mode
-
-    // Allocate layer buffers for per-sample per-processor visualization (double)
-    layerInputDouble.setSize(2, samplesPerBlock);
-    layerHardClipDouble.setSize(2, samplesPerBlock);
-    layerSoftClipDouble.setSize(2, samplesPerBlock);
-    layerSlowLimitDouble.setSize(2, samplesPerBlock);
-    layerFastLimitDouble.setSize(2, samplesPerBlock);
-    layerFinalOutputDouble.setSize(2, samplesPerBlock);
-
-    // Initialize ALL 4-channel oversamplers for phase-coherent dry/wet processing
-    // Pre-allocate for all modes to allow hot-swapping without audio thread allocation
-    // CRITICAL: Must use IDENTICAL filter settings as osManager for phase coherence!
-
-    // Balanced mode (8x OS) - MUST match osManager Mode 1 settings
-    oversampling4ChBalancedFloat = std::make_unique<juce::dsp::Oversampling<float>>(
-        4, 3, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, false, false);
-    oversampling4ChBalancedDouble = std::make_unique<juce::dsp::Oversampling<double>>(
-        4, 3, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, false, false);
-    oversampling4ChBalancedFloat->initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampling4ChBalancedDouble->initProcessing(static_cast<size_t>(samplesPerBlock));
-
-    // Linear Phase mode (16x OS) - MUST match osManager Mode 2 settings
-    oversampling4ChLinearFloat = std::make_unique<juce::dsp::Oversampling<float>>(
-        4, 4, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, true);
-    oversampling4ChLinearDouble = std::make_unique<juce::dsp::Oversampling<double>>(
-        4, 4, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, true, true);
-    oversampling4ChLinearFloat->initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampling4ChLinearDouble->initProcessing(static_cast<size_t>(samplesPerBlock));
+    // Allocate per-block scratch for the worst case (micro-block at the highest OS factor),
+    // in the precision the host will actually call us with
+    {
+        const int hostChannels = juce::jmax(2, getTotalNumInputChannels(), getTotalNumOutputChannels());
+        const int osBlockSize = maxBlockSize * maxOversamplingFactor;
+
+        ScratchArena::Layout layout;
+        layout[ScratchArena::NormalizedInput] = { hostChannels, maxBlockSize };
+        layout[ScratchArena::Dry] = { hostChannels, maxBlockSize };
+        layout[ScratchArena::LimiterReference] = { hostChannels, maxBlockSize };
+        layout[ScratchArena::XYHardClip] = { numBusChannels, osBlockSize };
+        layout[ScratchArena::XYSoftClip] = { numBusChannels, osBlockSize };
+        layout[ScratchArena::XYSlowLimit] = { numBusChannels, osBlockSize };
+        layout[ScratchArena::XYFastLimit] = { numBusChannels, osBlockSize };
+        layout[ScratchArena::AdaptiveOversampling] = { 2 * numBusChannels, maxBlockSize };
+        layout[ScratchArena::MonoReplay] = { 2, maxBlockSize };
+        layout[ScratchArena::PipelineBlocks] = { hostChannels, 2 * pipeline.slicesPerBank * microBlockSize };
+        layout[ScratchArena::PipelineDry] = { hostChannels, 2 * pipeline.slicesPerBank * microBlockSize };
+        layout[ScratchArena::PipelineOutput] = { hostChannels, preparedBlockSize };
+
+        scratch.prepare(layout, isUsingDoublePrecision());
+
+        // The envelope shapers work in float whatever the host precision
+        envelopeScratch.setSize(2, osBlockSize);
+    }
 
     // Delta mode (8x OS) - For overshoot suppression delta mode in Balanced mode
     // Pre-allocate to avoid audio thread allocation when delta mode is enabled
-    // Uses 4 channels: [mainL, mainR, refL, refR] for phase-coherent processing
-    oversampling4ChDeltaFloat = std::make_unique<juce::dsp::Oversampling<float>>(
-        4, 3, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, false);
-    oversampling4ChDeltaDouble = std::make_unique<juce::dsp::Oversampling<double>>(
-        4, 3, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, true, false);
-    oversampling4ChDeltaFloat->initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampling4ChDeltaDouble->initProcessing(static_cast<size_t>(samplesPerBlock));
+    // Uses 2 channels per bus channel: [main..., ref...] for phase-coherent processing
+    const auto numDeltaChannels = static_cast<size_t>(2 * numBusChannels);
+    oversamplingDeltaFloat = std::make_unique<juce::dsp::Oversampling<float>>(
+        numDeltaChannels, 3, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, false);
+    oversamplingDeltaDouble = std::make_unique<juce::dsp::Oversampling<double>>(
+        numDeltaChannels, 3, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, true, false);
+    oversamplingDeltaFloat->initProcessing(static_cast<size_t>(maxBlockSize));
+    oversamplingDeltaDouble->initProcessing(static_cast<size_t>(maxBlockSize));
 
     // Delta mode (16x OS) - For overshoot suppression delta mode in Linear Phase mode
-    oversampling4ChDelta16xFloat = std::make_unique<juce::dsp::Oversampling<float>>(
-        4, 4, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, true);
-    oversampling4ChDelta16xDouble = std::make_unique<juce::dsp::Oversampling<double>>(
-        4, 4, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, true, true);
-    oversampling4ChDelta16xFloat->initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampling4ChDelta16xDouble->initProcessing(static_cast<size_t>(samplesPerBlock));
-
-    // 2-channel oversamplers for protection limiters (overshoot suppression, advanced TPL)
+    oversamplingDelta16xFloat = std::make_unique<juce::dsp::Oversampling<float>>(
+        numDeltaChannels, 4, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, true);
+    oversamplingDelta16xDouble = std::make_unique<juce::dsp::Oversampling<double>>(
+        numDeltaChannels, 4, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, true, true);
+    oversamplingDelta16xFloat->initProcessing(static_cast<size_t>(maxBlockSize));
+    oversamplingDelta16xDouble->initProcessing(static_cast<size_t>(maxBlockSize));
+
+    // Bus-wide oversamplers for protection limiters (overshoot suppression, advanced TPL)
     // Balanced mode (8x OS) - matches osManager Mode 1
-    oversampling2ChBalancedFloat = std::make_unique<juce::dsp::Oversampling<float>>(
-        2, 3, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, false, false);
-    oversampling2ChBalancedDouble = std::make_unique<juce::dsp::Oversampling<double>>(
-        2, 3, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, false, false);
-    oversampling2ChBalancedFloat->initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampling2ChBalancedDouble->initProcessing(static_cast<size_t>(samplesPerBlock));
+    const auto numProtectionChannels = static_cast<size_t>(numBusChannels);
+    oversamplingProtectionBalancedFloat = std::make_unique<juce::dsp::Oversampling<float>>(
+        numProtectionChannels, 3, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, false, false);
+    oversamplingProtectionBalancedDouble = std::make_unique<juce::dsp::Oversampling<double>>(
+        numProtectionChannels, 3, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, false, false);
+    oversamplingProtectionBalancedFloat->initProcessing(static_cast<size_t>(maxBlockSize));
+    oversamplingProtectionBalancedDouble->initProcessing(static_cast<size_t>(maxBlockSize));
 
     // Linear Phase mode (16x OS) - matches osManager Mode 2
-    oversampling2ChLinearFloat = std::make_unique<juce::dsp::Oversampling<float>>(
-        2, 4, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, true);
-    oversampling2ChLinearDouble = std::make_unique<juce::dsp::Oversampling<double>>(
-        2, 4, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, true, true);
-    oversampling2ChLinearFloat->initProcessing(static_cast<size_t>(samplesPerBlock));
-    oversampling2ChLinearDouble->initProcessing(static_cast<size_t>(samplesPerBlock));
+    oversamplingProtectionLinearFloat = std::make_unique<juce::dsp::Oversampling<float>>(
+        numProtectionChannels, 4, juce::dsp::Oversampling<float>::filterHalfBandFIREquiripple, true, true);
+    oversamplingProtectionLinearDouble = std::make_unique<juce::dsp::Oversampling<double>>(
+        numProtectionChannels, 4, juce::dsp::Oversampling<double>::filterHalfBandFIREquiripple, true, true);
+    oversamplingProtectionLinearFloat->initProcessing(static_cast<size_t>(maxBlockSize));
+    oversamplingProtectionLinearDouble->initProcessing(static_cast<size_t>(maxBlockSize));
 
     // Initialize parameter smoothers (20ms ramp time to prevent zipper noise)
     const double rampTimeSeconds = 0.020;  // 20ms
@@ -604,6 +845,12 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
     agcInputRMS.store(0.0f);
     agcOutputRMS.store(0.0f);
 
+    // Meters and AGC update every ~10 ms regardless of the host block size
+    controlRateSamples = juce::jmax(1, juce::roundToInt(sampleRate * 0.01));
+    controlRate = {};
+    silentInputSamples = 0;
+    controlRate.samplesUntilUpdate = controlRateSamples;
+
     // Initialize per-processor envelope followers for smooth GR visualization
     for (int ch = 0; ch < 2; ++ch)
         processorEnvelope[ch].prepare(sampleRate);
@@ -635,47 +882,44 @@ void QuadBlendDriveAudioProcessor::prepareToPlay(double sampleRate, int samplesP
     // === ENVELOPE SHAPERS INITIALIZATION ===
     // Prepare envelope shapers at oversampled rate for accurate transient detection
     // Note: Envelope detection runs at OS rate, matching drive processor rate
+    xyTransientDetector.prepare(osSampleRate);
     hardClipShaper.prepare(osSampleRate);
     softClipShaper.prepare(osSampleRate);
     slowLimitShaper.prepare(osSampleRate);
     fastLimitShaper.prepare(osSampleRate);
 
-    // Reset all processor states and allocate lookahead buffers (3ms for all)
-    for (int ch = 0; ch < 2; ++ch)
-    {
-        // Architecture A: Dry delay buffers NO LONGER NEEDED
-        // Modes 0: Both dry/wet bypass OS (no phase mismatch)
-        // Modes 1/2: Both dry/wet pass through 4-channel oversampler (perfect phase alignment)
-        dryDelayState[ch].delayBuffer.clear();
-        dryDelayState[ch].writePos = 0;
+    // prepare() resets the shapers' emphasis, so force derived values (which push it) to rebuild
+    derivedParamsFloat.valid = false;
+    derivedParamsDouble.valid = false;
 
-        // Hard Clip lookahead (allocate at MAX size for dynamic switching)
-        hardClipState[ch].lookaheadBuffer.resize(maxLookaheadSamples, 0.0);
+    // Reset all processor states and attach lookahead lines (allocated at MAX size in delayMemory)
+    for (int ch = 0; ch < numBusChannels; ++ch)
+    {
+        // Hard Clip lookahead
+        hardClipState[ch].lookaheadBuffer = delayMemory.getLine(DelayMemory::HardClipLookahead, ch);
         hardClipState[ch].lookaheadWritePos = 0;
+        hardClipState[ch].adaa.reset();
 
-        // Soft Clip lookahead (allocate at MAX size for dynamic switching)
-        softClipState[ch].lookaheadBuffer.resize(maxLookaheadSamples, 0.0);
+        // Soft Clip lookahead
+        softClipState[ch].lookaheadBuffer = delayMemory.getLine(DelayMemory::SoftClipLookahead, ch);
         softClipState[ch].lookaheadWritePos = 0;
+        softClipState[ch].adaa.reset();
 
         // Slow Limiter
         slowLimiterState[ch].envelope = 0.0;
         slowLimiterState[ch].adaptiveRelease = 100.0;
-        slowLimiterState[ch].lookaheadBuffer.resize(maxLookaheadSamples, 0.0);
+        slowLimiterState[ch].lookaheadBuffer = delayMemory.getLine(DelayMemory::SlowLimitLookahead, ch);
         slowLimiterState[ch].lookaheadWritePos = 0;
 
         // Fast Limiter
         fastLimiterState[ch].envelope = 0.0;
-        fastLimiterState[ch].lookaheadBuffer.resize(maxLookaheadSamples, 0.0);
+        fastLimiterState[ch].lookaheadBuffer = delayMemory.getLine(DelayMemory::FastLimitLookahead, ch);
         fastLimiterState[ch].lookaheadWritePos = 0;
 
-        // Protection Limiter (4ms lookahead, true-peak safety)
+        // Protection Limiter (zero-latency, true-peak safety)
         protectionLimiterState[ch].envelope = 0.0;
         protectionLimiterState[ch].fastReleaseEnv = 0.0;
         protectionLimiterState[ch].slowReleaseEnv = 0.0;
-        protectionLimiterState[ch].lookaheadBuffer.resize(protectionLookaheadSamples, 0.0);
-        protectionLimiterState[ch].lookaheadWritePos = 0;
-        // Allocate oversampled buffer (8x oversampling)
-        protectionLimiterState[ch].oversampledBuffer.resize(samplesPerBlock * 8, 0.0);
     }
 }
 
@@ -684,23 +928,48 @@ void QuadBlendDriveAudioProcessor::releaseResources()
     // Reset main oversampling manager
     osManager.reset();
 
-    // Reset 4-channel dry/wet oversamplers
-    if (oversampling4ChBalancedFloat) oversampling4ChBalancedFloat->reset();
-    if (oversampling4ChBalancedDouble) oversampling4ChBalancedDouble->reset();
-    if (oversampling4ChLinearFloat) oversampling4ChLinearFloat->reset();
-    if (oversampling4ChLinearDouble) oversampling4ChLinearDouble->reset();
+    // No more blocks to share out
+    cancelPendingUpdate();
+    workerPoolsPrepared = false;
+    xyWorkers.stop();
+    pipelineWorkers.stop();
+    pipeline.restart = true;
+
+    // Reset per-path XY resamplers
+    for (auto& resampler : xyPathResamplers)
+        resampler.reset();
+
+    // Restart with the oversampled chain engaged
+    adaptiveWetDelay.reset();
+    adaptiveDryDelay.reset();
+    adaptiveOs.idle = false;
+    adaptiveOs.quietSamples = 0;
+
+    // Both sides restart from silence, so they are already in step
+    monoDetection = {};
 
     // Reset delta mode oversamplers
-    if (oversampling4ChDeltaFloat) oversampling4ChDeltaFloat->reset();
-    if (oversampling4ChDeltaDouble) oversampling4ChDeltaDouble->reset();
-    if (oversampling4ChDelta16xFloat) oversampling4ChDelta16xFloat->reset();
-    if (oversampling4ChDelta16xDouble) oversampling4ChDelta16xDouble->reset();
+    if (oversamplingDeltaFloat) oversamplingDeltaFloat->reset();
+    if (oversamplingDeltaDouble) oversamplingDeltaDouble->reset();
+    if (oversamplingDelta16xFloat) oversamplingDelta16xFloat->reset();
+    if (oversamplingDelta16xDouble) oversamplingDelta16xDouble->reset();
 
     // Reset protection stage oversamplers
-    if (oversampling2ChBalancedFloat) oversampling2ChBalancedFloat->reset();
-    if (oversampling2ChBalancedDouble) oversampling2ChBalancedDouble->reset();
-    if (oversampling2ChLinearFloat) oversampling2ChLinearFloat->reset();
-    if (oversampling2ChLinearDouble) oversampling2ChLinearDouble->reset();
+    if (oversamplingProtectionBalancedFloat) oversamplingProtectionBalancedFloat->reset();
+    if (oversamplingProtectionBalancedDouble) oversamplingProtectionBalancedDouble->reset();
+    if (oversamplingProtectionLinearFloat) oversamplingProtectionLinearFloat->reset();
+    if (oversamplingProtectionLinearDouble) oversamplingProtectionLinearDouble->reset();
+}
+
+bool QuadBlendDriveAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
+{
+    // Every channel runs the full chain in place, so input and output must match
+    const auto mainInput = layouts.getMainInputChannelSet();
+    const auto mainOutput = layouts.getMainOutputChannelSet();
+
+    return mainInput == mainOutput
+        && !mainInput.isDisabled()
+        && mainInput.size() <= maxChannels;
 }
 
 //==============================================================================
@@ -857,164 +1126,207 @@ void QuadBlendDriveAudioProcessor::calculateNormalizationGain()
 
 void QuadBlendDriveAudioProcessor::updateDecimatedDisplay()
 {
-    // Decimate high-resolution displayBuffer (8192 samples) to GUI-friendly cache (512 segments)
-    // Uses min/max envelope for accurate peak representation at 60fps
+    // Decimate high-resolution displayBuffer (196608 samples) to GUI-friendly cache (8192 segments)
+    // Uses min/max envelope for accurate peak representation
     // Called from GUI thread - thread-safe read of ring buffer
+    //
+    // Incremental: only the segments completed since the previous call are decimated, the
+    // rest of the cache is shifted left. A full pass is only needed on first use, after the
+    // ring has been cleared, or when a whole ring or more has been written since the last call.
+
+    // The write counter, not the ring position, tells how much was written: a ring position
+    // cannot tell a whole lap (the scope hidden for a few seconds) from no progress at all
+    const uint64_t written = displaySamplesWritten.load(std::memory_order_acquire);
+    const uint32_t generation = displayBufferGeneration.load();
+    const int currentWritePos = static_cast<int>(written % displayBufferSize);
+    constexpr int samplesPerSegment = displayBufferSize / decimatedDisplaySize;  // 196608 / 8192 = 24
+
+    int newSegments = decimatedDisplaySize;
+    if (decimatedReadPos >= 0 && generation == decimatedGeneration)
+    {
+        const uint64_t elapsed = written - decimatedSamplesRead;
+        if (elapsed < static_cast<uint64_t>(displayBufferSize))
+            newSegments = static_cast<int>(elapsed) / samplesPerSegment;
+    }
 
-    const int currentWritePos = displayWritePos.load();
-    constexpr int samplesPerSegment = displayBufferSize / decimatedDisplaySize;  // 8192 / 512 = 16
-
-    // Read from ring buffer starting from oldest sample (write position is next write location)
-    int readPos = currentWritePos;
-
-    for (int segment = 0; segment < decimatedDisplaySize; ++segment)
-    {
-        DecimatedSegment& seg = decimatedDisplay[segment];
-
-        // Initialize min/max for this segment
-        float waveformMin = 0.0f;
-        float waveformMax = 0.0f;
-        float waveformMinL = 0.0f, waveformMaxL = 0.0f;
-        float waveformMinR = 0.0f, waveformMaxR = 0.0f;
-        float grMin = 0.0f;
-        float grMax = 0.0f;
-        float sumLow = 0.0f;
-        float sumMid = 0.0f;
-        float sumHigh = 0.0f;
-
-        // === DRIVE VISUALIZER LAYER MIN/MAX ===
-        float inputMin = 0.0f, inputMax = 0.0f;
-        float hardClipMin = 0.0f, hardClipMax = 0.0f;
-        float softClipMin = 0.0f, softClipMax = 0.0f;
-        float slowLimitMin = 0.0f, slowLimitMax = 0.0f;
-        float fastLimitMin = 0.0f, fastLimitMax = 0.0f;
-        float finalOutputMin = 0.0f, finalOutputMax = 0.0f;
-
-        // === THRESHOLD METER: GAIN REDUCTION MIN/MAX ===
-        float hardClipGRMin = 0.0f, hardClipGRMax = 0.0f;
-        float softClipGRMin = 0.0f, softClipGRMax = 0.0f;
-        float slowLimitGRMin = 0.0f, slowLimitGRMax = 0.0f;
-        float fastLimitGRMin = 0.0f, fastLimitGRMax = 0.0f;
-
-        // Process all samples in this segment
-        for (int i = 0; i < samplesPerSegment; ++i)
+    if (newSegments >= decimatedDisplaySize)
+    {
+        // Full rebuild, reading from the oldest sample (write position is next write location)
+        int readPos = currentWritePos;
+        for (auto& seg : decimatedDisplay)
         {
-            const DisplaySample& sample = displayBuffer[readPos];
-
-            // Use mono mix for waveform envelope (L+R)/2
-            float waveform = (sample.waveformL + sample.waveformR) * 0.5f;
-
-            // Update min/max for waveform envelope
-            if (i == 0)
-            {
-                waveformMin = waveform;
-                waveformMax = waveform;
-                waveformMinL = waveformMaxL = sample.waveformL;
-                waveformMinR = waveformMaxR = sample.waveformR;
-                grMin = sample.gainReduction;
-                grMax = sample.gainReduction;
-
-                // Initialize per-processor output min/max (raw outputs, not blend-weighted)
-                inputMin = inputMax = sample.inputSignal;
-                hardClipMin = hardClipMax = sample.hardClipOutput;
-                softClipMin = softClipMax = sample.softClipOutput;
-                slowLimitMin = slowLimitMax = sample.slowLimitOutput;
-                fastLimitMin = fastLimitMax = sample.fastLimitOutput;
-                finalOutputMin = finalOutputMax = sample.finalOutput;
-
-                // Initialize gain reduction min/max
-                hardClipGRMin = hardClipGRMax = sample.hardClipGainReduction;
-                softClipGRMin = softClipGRMax = sample.softClipGainReduction;
-                slowLimitGRMin = slowLimitGRMax = sample.slowLimitGainReduction;
-                fastLimitGRMin = fastLimitGRMax = sample.fastLimitGainReduction;
-            }
-            else
-            {
-                waveformMin = std::min(waveformMin, waveform);
-                waveformMax = std::max(waveformMax, waveform);
-                waveformMinL = std::min(waveformMinL, sample.waveformL);
-                waveformMaxL = std::max(waveformMaxL, sample.waveformL);
-                waveformMinR = std::min(waveformMinR, sample.waveformR);
-                waveformMaxR = std::max(waveformMaxR, sample.waveformR);
-                grMin = std::min(grMin, sample.gainReduction);
-                grMax = std::max(grMax, sample.gainReduction);
-
-                // Update per-processor output min/max (raw outputs, not blend-weighted)
-                inputMin = std::min(inputMin, sample.inputSignal);
-                inputMax = std::max(inputMax, sample.inputSignal);
-                hardClipMin = std::min(hardClipMin, sample.hardClipOutput);
-                hardClipMax = std::max(hardClipMax, sample.hardClipOutput);
-                softClipMin = std::min(softClipMin, sample.softClipOutput);
-                softClipMax = std::max(softClipMax, sample.softClipOutput);
-                slowLimitMin = std::min(slowLimitMin, sample.slowLimitOutput);
-                slowLimitMax = std::max(slowLimitMax, sample.slowLimitOutput);
-                fastLimitMin = std::min(fastLimitMin, sample.fastLimitOutput);
-                fastLimitMax = std::max(fastLimitMax, sample.fastLimitOutput);
-                finalOutputMin = std::min(finalOutputMin, sample.finalOutput);
-                finalOutputMax = std::max(finalOutputMax, sample.finalOutput);
-
-                // Update gain reduction min/max
-                hardClipGRMin = std::min(hardClipGRMin, sample.hardClipGainReduction);
-                hardClipGRMax = std::max(hardClipGRMax, sample.hardClipGainReduction);
-                softClipGRMin = std::min(softClipGRMin, sample.softClipGainReduction);
-                softClipGRMax = std::max(softClipGRMax, sample.softClipGainReduction);
-                slowLimitGRMin = std::min(slowLimitGRMin, sample.slowLimitGainReduction);
-                slowLimitGRMax = std::max(slowLimitGRMax, sample.slowLimitGainReduction);
-                fastLimitGRMin = std::min(fastLimitGRMin, sample.fastLimitGainReduction);
-                fastLimitGRMax = std::max(fastLimitGRMax, sample.fastLimitGainReduction);
-            }
+            decimateDisplaySegment(readPos, seg);
+            readPos = (readPos + samplesPerSegment) % displayBufferSize;
+        }
 
-            // Accumulate frequency bands for averaging
-            sumLow += sample.lowBand;
-            sumMid += sample.midBand;
-            sumHigh += sample.highBand;
+        decimatedReadPos = readPos;
+        decimatedSamplesRead = written;
+        decimatedGeneration = generation;
+        decimatedSegmentsWritten += static_cast<uint64_t>(decimatedDisplaySize);
+    }
+    else if (newSegments > 0)
+    {
+        // Scroll the cache and append only the newly completed segments on the right
+        std::copy(decimatedDisplay.begin() + newSegments, decimatedDisplay.end(), decimatedDisplay.begin());
 
-            // Advance read position in ring buffer
-            readPos = (readPos + 1) % displayBufferSize;
+        for (int segment = decimatedDisplaySize - newSegments; segment < decimatedDisplaySize; ++segment)
+        {
+            decimateDisplaySegment(decimatedReadPos, decimatedDisplay[segment]);
+            decimatedReadPos = (decimatedReadPos + samplesPerSegment) % displayBufferSize;
         }
+        decimatedSamplesRead += static_cast<uint64_t>(newSegments * samplesPerSegment);
 
-        // Store decimated segment with min/max envelope
-        seg.waveformMin = waveformMin;
-        seg.waveformMax = waveformMax;
-        seg.waveformMinL = waveformMinL;
-        seg.waveformMaxL = waveformMaxL;
-        seg.waveformMinR = waveformMinR;
-        seg.waveformMaxR = waveformMaxR;
-        seg.grMin = grMin;
-        seg.grMax = grMax;
-        seg.avgLow = sumLow / static_cast<float>(samplesPerSegment);
-        seg.avgMid = sumMid / static_cast<float>(samplesPerSegment);
-        seg.avgHigh = sumHigh / static_cast<float>(samplesPerSegment);
-
-        // Store layer min/max
-        seg.inputMin = inputMin;
-        seg.inputMax = inputMax;
-        seg.hardClipMin = hardClipMin;
-        seg.hardClipMax = hardClipMax;
-        seg.softClipMin = softClipMin;
-        seg.softClipMax = softClipMax;
-        seg.slowLimitMin = slowLimitMin;
-        seg.slowLimitMax = slowLimitMax;
-        seg.fastLimitMin = fastLimitMin;
-        seg.fastLimitMax = fastLimitMax;
-        seg.finalOutputMin = finalOutputMin;
-        seg.finalOutputMax = finalOutputMax;
-
-        // Store gain reduction min/max
-        seg.hardClipGRMin = hardClipGRMin;
-        seg.hardClipGRMax = hardClipGRMax;
-        seg.softClipGRMin = softClipGRMin;
-        seg.softClipGRMax = softClipGRMax;
-        seg.slowLimitGRMin = slowLimitGRMin;
-        seg.slowLimitGRMax = slowLimitGRMax;
-        seg.fastLimitGRMin = fastLimitGRMin;
-        seg.fastLimitGRMax = fastLimitGRMax;
+        decimatedSegmentsWritten += static_cast<uint64_t>(newSegments);
     }
 
     // Signal that decimated display is ready for rendering
     decimatedDisplayReady.store(true);
 }
 
+void QuadBlendDriveAudioProcessor::decimateDisplaySegment(int readPos, DecimatedSegment& seg) const
+{
+    constexpr int samplesPerSegment = displayBufferSize / decimatedDisplaySize;
+
+    // Initialize min/max for this segment
+    float waveformMin = 0.0f;
+    float waveformMax = 0.0f;
+    float waveformMinL = 0.0f, waveformMaxL = 0.0f;
+    float waveformMinR = 0.0f, waveformMaxR = 0.0f;
+    float grMin = 0.0f;
+    float grMax = 0.0f;
+    float sumLow = 0.0f;
+    float sumMid = 0.0f;
+    float sumHigh = 0.0f;
+
+    // === DRIVE VISUALIZER LAYER MIN/MAX ===
+    float inputMin = 0.0f, inputMax = 0.0f;
+    float hardClipMin = 0.0f, hardClipMax = 0.0f;
+    float softClipMin = 0.0f, softClipMax = 0.0f;
+    float slowLimitMin = 0.0f, slowLimitMax = 0.0f;
+    float fastLimitMin = 0.0f, fastLimitMax = 0.0f;
+    float finalOutputMin = 0.0f, finalOutputMax = 0.0f;
+
+    // === THRESHOLD METER: GAIN REDUCTION MIN/MAX ===
+    float hardClipGRMin = 0.0f, hardClipGRMax = 0.0f;
+    float softClipGRMin = 0.0f, softClipGRMax = 0.0f;
+    float slowLimitGRMin = 0.0f, slowLimitGRMax = 0.0f;
+    float fastLimitGRMin = 0.0f, fastLimitGRMax = 0.0f;
+
+    // Process all samples in this segment
+    for (int i = 0; i < samplesPerSegment; ++i)
+    {
+        const DisplaySample& sample = displayBuffer[readPos];
+
+        // Use mono mix for waveform envelope (L+R)/2
+        float waveform = (sample.waveformL + sample.waveformR) * 0.5f;
+
+        // Update min/max for waveform envelope
+        if (i == 0)
+        {
+            waveformMin = waveform;
+            waveformMax = waveform;
+            waveformMinL = waveformMaxL = sample.waveformL;
+            waveformMinR = waveformMaxR = sample.waveformR;
+            grMin = sample.gainReduction;
+            grMax = sample.gainReduction;
+
+            // Initialize per-processor output min/max (raw outputs, not blend-weighted)
+            inputMin = inputMax = sample.inputSignal;
+            hardClipMin = hardClipMax = sample.hardClipOutput;
+            softClipMin = softClipMax = sample.softClipOutput;
+            slowLimitMin = slowLimitMax = sample.slowLimitOutput;
+            fastLimitMin = fastLimitMax = sample.fastLimitOutput;
+            finalOutputMin = finalOutputMax = sample.finalOutput;
+
+            // Initialize gain reduction min/max
+            hardClipGRMin = hardClipGRMax = sample.hardClipGainReduction;
+            softClipGRMin = softClipGRMax = sample.softClipGainReduction;
+            slowLimitGRMin = slowLimitGRMax = sample.slowLimitGainReduction;
+            fastLimitGRMin = fastLimitGRMax = sample.fastLimitGainReduction;
+        }
+        else
+        {
+            waveformMin = std::min(waveformMin, waveform);
+            waveformMax = std::max(waveformMax, waveform);
+            waveformMinL = std::min(waveformMinL, sample.waveformL);
+            waveformMaxL = std::max(waveformMaxL, sample.waveformL);
+            waveformMinR = std::min(waveformMinR, sample.waveformR);
+            waveformMaxR = std::max(waveformMaxR, sample.waveformR);
+            grMin = std::min(grMin, sample.gainReduction);
+            grMax = std::max(grMax, sample.gainReduction);
+
+            // Update per-processor output min/max (raw outputs, not blend-weighted)
+            inputMin = std::min(inputMin, sample.inputSignal);
+            inputMax = std::max(inputMax, sample.inputSignal);
+            hardClipMin = std::min(hardClipMin, sample.hardClipOutput);
+            hardClipMax = std::max(hardClipMax, sample.hardClipOutput);
+            softClipMin = std::min(softClipMin, sample.softClipOutput);
+            softClipMax = std::max(softClipMax, sample.softClipOutput);
+            slowLimitMin = std::min(slowLimitMin, sample.slowLimitOutput);
+            slowLimitMax = std::max(slowLimitMax, sample.slowLimitOutput);
+            fastLimitMin = std::min(fastLimitMin, sample.fastLimitOutput);
+            fastLimitMax = std::max(fastLimitMax, sample.fastLimitOutput);
+            finalOutputMin = std::min(finalOutputMin, sample.finalOutput);
+            finalOutputMax = std::max(finalOutputMax, sample.finalOutput);
+
+            // Update gain reduction min/max
+            hardClipGRMin = std::min(hardClipGRMin, sample.hardClipGainReduction);
+            hardClipGRMax = std::max(hardClipGRMax, sample.hardClipGainReduction);
+            softClipGRMin = std::min(softClipGRMin, sample.softClipGainReduction);
+            softClipGRMax = std::max(softClipGRMax, sample.softClipGainReduction);
+            slowLimitGRMin = std::min(slowLimitGRMin, sample.slowLimitGainReduction);
+            slowLimitGRMax = std::max(slowLimitGRMax, sample.slowLimitGainReduction);
+            fastLimitGRMin = std::min(fastLimitGRMin, sample.fastLimitGainReduction);
+            fastLimitGRMax = std::max(fastLimitGRMax, sample.fastLimitGainReduction);
+        }
+
+        // Accumulate frequency bands for averaging
+        sumLow += sample.lowBand;
+        sumMid += sample.midBand;
+        sumHigh += sample.highBand;
+
+        // Advance read position in ring buffer
+        readPos = (readPos + 1) % displayBufferSize;
+    }
+
+    // Store decimated segment with min/max envelope
+    seg.waveformMin = waveformMin;
+    seg.waveformMax = waveformMax;
+    seg.waveformMinL = waveformMinL;
+    seg.waveformMaxL = waveformMaxL;
+    seg.waveformMinR = waveformMinR;
+    seg.waveformMaxR = waveformMaxR;
+    seg.grMin = grMin;
+    seg.grMax = grMax;
+    seg.avgLow = sumLow / static_cast<float>(samplesPerSegment);
+    seg.avgMid = sumMid / static_cast<float>(samplesPerSegment);
+    seg.avgHigh = sumHigh / static_cast<float>(samplesPerSegment);
+
+    // Store layer min/max
+    seg.inputMin = inputMin;
+    seg.inputMax = inputMax;
+    seg.hardClipMin = hardClipMin;
+    seg.hardClipMax = hardClipMax;
+    seg.softClipMin = softClipMin;
+    seg.softClipMax = softClipMax;
+    seg.slowLimitMin = slowLimitMin;
+    seg.slowLimitMax = slowLimitMax;
+    seg.fastLimitMin = fastLimitMin;
+    seg.fastLimitMax = fastLimitMax;
+    seg.finalOutputMin = finalOutputMin;
+    seg.finalOutputMax = finalOutputMax;
+
+    // Store gain reduction min/max
+    seg.hardClipGRMin = hardClipGRMin;
+    seg.hardClipGRMax = hardClipGRMax;
+    seg.softClipGRMin = softClipGRMin;
+    seg.softClipGRMax = softClipGRMax;
+    seg.slowLimitGRMin = slowLimitGRMin;
+    seg.slowLimitGRMax = slowLimitGRMax;
+    seg.fastLimitGRMin = fastLimitGRMin;
+    seg.fastLimitGRMax = fastLimitGRMax;
+}
+
 void QuadBlendDriveAudioProcessor::updateTransportState()
 {
     // === TRANSPORT STATE DETECTION ===
@@ -1044,8 +1356,10 @@ void QuadBlendDriveAudioProcessor::updateTransportState()
     if (currentlyPlaying && !wasPlayingPrev)
     {
         // === PLAYBACK JUST STARTED ===
-        // Clear display buffer for fresh start
+        // Clear display buffer for fresh start (the write counter moves on to the next lap)
         displayWritePos.store(0);
+        const uint64_t written = displaySamplesWritten.load();
+        displaySamplesWritten.store((written + displayBufferSize - 1) / displayBufferSize * displayBufferSize);
 
         // Clear the buffer contents
         for (auto& sample : displayBuffer)
@@ -1058,6 +1372,9 @@ void QuadBlendDriveAudioProcessor::updateTransportState()
             sample.highBand = 0.0f;
         }
 
+        // Tell the GUI its incremental decimation cache is stale
+        displayBufferGeneration.fetch_add(1);
+
         displayBufferFrozen.store(false);
     }
     else if (!currentlyPlaying && wasPlayingPrev)
@@ -1072,131 +1389,689 @@ void QuadBlendDriveAudioProcessor::updateTransportState()
 }
 
 //==============================================================================
-// ProcessBlock wrappers
-void QuadBlendDriveAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+// Compiled parameter snapshot
+void QuadBlendDriveAudioProcessor::readParameterSnapshot()
 {
-    processBlockInternal(buffer, midiMessages);
-}
+    ParameterSnapshot latest;
+    for (const auto& [value, member] : parameterBindings)
+        latest.*member = value->load(std::memory_order_relaxed);
 
-void QuadBlendDriveAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
-{
-    processBlockInternal(buffer, midiMessages);
+    if (latest != params || parameterGeneration == 0)
+    {
+        params = latest;
+        ++parameterGeneration;
+        updateRoutingPlan();
+    }
 }
 
-//==============================================================================
-// Template processBlock implementation
-template<typename SampleType>
-void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<SampleType>& buffer,
-                                                         juce::MidiBuffer&)
+void QuadBlendDriveAudioProcessor::updateLinkGroups(LinkGroups groups)
 {
-    juce::ScopedNoDenormals noDenormals;
-    const int totalNumInputChannels = getTotalNumInputChannels();
-    const int totalNumOutputChannels = getTotalNumOutputChannels();
-    const int numSamples = buffer.getNumSamples();
+    using Type = juce::AudioChannelSet::ChannelType;
 
-    // DEBUG: Uncomment this block to test absolute zero-latency bypass
-    // If latency persists with this enabled, it's in JUCE/host, not our code
-    // #define DEBUG_ZERO_LATENCY_TEST
-    #ifdef DEBUG_ZERO_LATENCY_TEST
+    auto isHeight = [](Type type)
     {
-        const int processingMode = static_cast<int>(apvts.getRawParameterValue("PROCESSING_MODE")->load());
-        if (processingMode == 0)
+        switch (type)
         {
-            // Absolute minimum: just clear unused channels and return
-            for (int i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-                buffer.clear(i, 0, numSamples);
-            return;  // Complete bypass - buffer passes through unchanged
+            case juce::AudioChannelSet::topMiddle:
+            case juce::AudioChannelSet::topFrontLeft:
+            case juce::AudioChannelSet::topFrontCentre:
+            case juce::AudioChannelSet::topFrontRight:
+            case juce::AudioChannelSet::topRearLeft:
+            case juce::AudioChannelSet::topRearCentre:
+            case juce::AudioChannelSet::topRearRight:
+            case juce::AudioChannelSet::topSideLeft:
+            case juce::AudioChannelSet::topSideRight:
+            case juce::AudioChannelSet::bottomFrontLeft:
+            case juce::AudioChannelSet::bottomFrontCentre:
+            case juce::AudioChannelSet::bottomFrontRight:
+                return true;
+            default:
+                return false;
         }
-    }
-    #endif
+    };
 
-    // === TRANSPORT STATE DETECTION ===
-    updateTransportState();
+    // Left/right partners; a channel of a discrete (unnamed) layout pairs with its neighbour
+    static constexpr std::pair<Type, Type> stereoPairs[] = {
+        { juce::AudioChannelSet::left, juce::AudioChannelSet::right },
+        { juce::AudioChannelSet::leftSurround, juce::AudioChannelSet::rightSurround },
+        { juce::AudioChannelSet::leftCentre, juce::AudioChannelSet::rightCentre },
+        { juce::AudioChannelSet::leftSurroundSide, juce::AudioChannelSet::rightSurroundSide },
+        { juce::AudioChannelSet::leftSurroundRear, juce::AudioChannelSet::rightSurroundRear },
+        { juce::AudioChannelSet::wideLeft, juce::AudioChannelSet::wideRight },
+        { juce::AudioChannelSet::topFrontLeft, juce::AudioChannelSet::topFrontRight },
+        { juce::AudioChannelSet::topSideLeft, juce::AudioChannelSet::topSideRight },
+        { juce::AudioChannelSet::topRearLeft, juce::AudioChannelSet::topRearRight },
+        { juce::AudioChannelSet::bottomFrontLeft, juce::AudioChannelSet::bottomFrontRight },
+        { juce::AudioChannelSet::proximityLeft, juce::AudioChannelSet::proximityRight },
+    };
+    constexpr int numStereoPairs = static_cast<int>(std::size(stereoPairs));
 
-    for (int i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
-        buffer.clear(i, 0, numSamples);
+    // First a key per channel (equal keys link), then keys renumbered 0, 1, 2, ...
+    std::array<int, maxChannels> keys;
+    for (int ch = 0; ch < maxChannels; ++ch)
+    {
+        const Type type = busChannelTypes[static_cast<size_t>(ch)];
+        int key = -1;
+
+        if (ch < numBusChannels && type != juce::AudioChannelSet::LFE && type != juce::AudioChannelSet::LFE2)
+        {
+            if (groups == LinkGroups::All)
+            {
+                key = 0;
+            }
+            else if (groups == LinkGroups::BedAndHeights)
+            {
+                key = isHeight(type) ? 1 : 0;
+            }
+            else if (type == juce::AudioChannelSet::unknown || type >= juce::AudioChannelSet::discreteChannel0)
+            {
+                key = numStereoPairs + ch / 2;
+            }
+            else
+            {
+                for (int pair = 0; pair < numStereoPairs; ++pair)
+                    if (type == stereoPairs[pair].first || type == stereoPairs[pair].second)
+                        key = pair;
+            }
+        }
 
-    // Bypass check
-    const bool bypass = apvts.getRawParameterValue("BYPASS")->load() > 0.5f;
+        keys[static_cast<size_t>(ch)] = key;
+    }
 
-    // If bypass is engaged, capture the dry input signal to oscilloscope and return
-    if (bypass)
+    int numGroups = 0;
+    for (int ch = 0; ch < maxChannels; ++ch)
     {
-        // === WAVEFORM DISPLAY DATA CAPTURE (Bypass Mode) ===
-        // Apply frequency band filters once and write to both legacy and new display buffers
-        // Only update display buffer when transport is playing (not frozen)
-        if (!displayBufferFrozen.load())
+        int group = -1;
+        if (keys[static_cast<size_t>(ch)] >= 0)
         {
-            int writePos = oscilloscopeWritePos.load();
-            int oscSize = oscilloscopeSize.load();
-            int displayWrite = displayWritePos.load();
-
-            for (int i = 0; i < numSamples; ++i)
-            {
-                // Get stereo samples
-                float sampleL = 0.0f;
-                float sampleR = 0.0f;
-                if (buffer.getNumChannels() > 0)
-                    sampleL = static_cast<float>(buffer.getReadPointer(0)[i]);
-                if (buffer.getNumChannels() > 1)
-                    sampleR = static_cast<float>(buffer.getReadPointer(1)[i]);
+            for (int earlier = 0; earlier < ch && group < 0; ++earlier)
+                if (keys[static_cast<size_t>(earlier)] == keys[static_cast<size_t>(ch)])
+                    group = linkGroup[static_cast<size_t>(earlier)];
+            if (group < 0)
+                group = numGroups++;
+        }
+        linkGroup[static_cast<size_t>(ch)] = group;
+    }
+}
 
-                // Create mono mix for frequency analysis
-                float monoSample = (sampleL + sampleR) * 0.5f;
-                double sample = static_cast<double>(monoSample);
+void QuadBlendDriveAudioProcessor::updateRoutingPlan()
+{
+    routing.bypass = params.bypass > 0.5f;
+    routing.deltaMode = params.deltaMode > 0.5f;
+    routing.agcEnabled = params.agcEnable > 0.5f;
+    routing.midSide = static_cast<int>(params.channelMode) == 1;
+    routing.processingMode = static_cast<int>(params.processingMode);
+    routing.oversamplingChoice = juce::jlimit(0, OversamplingManager::maxFactorIndex, static_cast<int>(params.oversampling));
+    routing.pathOversampling[HardClipPath] = static_cast<int>(params.hcOversampling);
+    routing.pathOversampling[SoftClipPath] = static_cast<int>(params.scOversampling);
+    routing.pathOversampling[SlowLimitPath] = static_cast<int>(params.slOversampling);
+    routing.pathOversampling[FastLimitPath] = static_cast<int>(params.flOversampling);
+    routing.envelopeControlRate = params.envelopeControlRate > 0.5f;
+    routing.adaptiveOversampling = params.adaptiveOversampling > 0.5f;
+    routing.parallelPaths = params.parallelPaths > 0.5f;
+    const auto linkGroups = static_cast<LinkGroups>(juce::jlimit(0, 2, static_cast<int>(params.channelLinkGroups)));
+    if (linkGroups != routing.linkGroups)
+    {
+        routing.linkGroups = linkGroups;
+        updateLinkGroups(linkGroups);
+    }
+    const bool limiterControlRate = params.limiterControlRate > 0.5f;
+    if (limiterControlRate != routing.limiterControlRate)
+    {
+        // Start the control-rate ramp from the gain the full-rate path left off at
+        for (int ch = 0; ch < numBusChannels; ++ch)
+        {
+            slowLimiterState[ch].controlGain = slowLimiterState[ch].smoothedGain;
+            fastLimiterState[ch].controlGain = fastLimiterState[ch].smoothedGain;
+        }
+        routing.limiterControlRate = limiterControlRate;
+    }
+    const int antiAliasOrder = juce::jlimit(0, 2, static_cast<int>(params.clipAntiAlias));
+    if (antiAliasOrder != routing.clipAntiAliasOrder)
+    {
+        // Each order keeps different history: restart it rather than read stale values
+        for (int ch = 0; ch < numBusChannels; ++ch)
+        {
+            hardClipState[ch].adaa.reset();
+            softClipState[ch].adaa.reset();
+        }
+        routing.clipAntiAliasOrder = antiAliasOrder;
+    }
 
-                // Apply frequency band filters ONCE (use left channel filter state)
-                // Low-pass filter (Red channel <250 Hz)
-                double lowOut = oscFilters[0].lowB0 * sample + oscFilters[0].lowZ1;
-                oscFilters[0].lowZ1 = oscFilters[0].lowB1 * sample - oscFilters[0].lowA1 * lowOut + oscFilters[0].lowZ2;
-                oscFilters[0].lowZ2 = oscFilters[0].lowB2 * sample - oscFilters[0].lowA2 * lowOut;
-                float lowBand = static_cast<float>(std::abs(lowOut));
+    // True Peak Limiter is disabled in Zero Latency mode (requires lookahead)
+    routing.overshootEnabled = params.overshootEnable > 0.5f;
+    routing.truePeakEnabled = (routing.processingMode != 0) && (params.truePeakEnable > 0.5f);
+    routing.overshootDeltaMode = params.overshootDeltaMode > 0.5f;
+    routing.truePeakDeltaMode = params.truePeakDeltaMode > 0.5f;
+
+    const bool anyLimiter = routing.overshootEnabled || routing.truePeakEnabled;
+    routing.combinedLimiters = routing.overshootEnabled && routing.truePeakEnabled
+                               && !routing.overshootDeltaMode && !routing.truePeakDeltaMode;
+    routing.runLimiters = !routing.deltaMode || anyLimiter;
+    routing.captureLimiterReference = routing.deltaMode && anyLimiter;
+}
 
-                // Band-pass filter (Green channel 250-4000 Hz)
-                double midOut = oscFilters[0].midB0 * sample + oscFilters[0].midZ1;
-                oscFilters[0].midZ1 = oscFilters[0].midB1 * sample - oscFilters[0].midA1 * midOut + oscFilters[0].midZ2;
-                oscFilters[0].midZ2 = oscFilters[0].midB2 * sample - oscFilters[0].midA2 * midOut;
-                float midBand = static_cast<float>(std::abs(midOut));
+void QuadBlendDriveAudioProcessor::updateXYPathRates(const std::array<int, numXYPaths>& choices)
+{
+    // Paths below the common rate pay a resampling round trip and round their lookahead
+    // up to whole path-rate samples; every path is padded to the slowest one
+    const int commonIndex = osManager.getFactorIndex();
 
-                // High-pass filter (Blue channel >4000 Hz)
-                double highOut = oscFilters[0].highB0 * sample + oscFilters[0].highZ1;
-                oscFilters[0].highZ1 = oscFilters[0].highB1 * sample - oscFilters[0].highA1 * highOut + oscFilters[0].highZ2;
-                oscFilters[0].highZ2 = oscFilters[0].highB2 * sample - oscFilters[0].highA2 * highOut;
-                float highBand = static_cast<float>(std::abs(highOut));
+    // pushLookahead() delays by one sample less than its length
+    auto lookaheadDelay = [](int length) { return juce::jmax(length - 1, 0); };
+    const int commonPathLatency = lookaheadDelay(lookaheadSamples);
+    int slowestPath = commonPathLatency;
 
-                // Write to legacy oscilloscope buffer (if active)
-                if (oscSize > 0 && static_cast<int>(oscilloscopeBuffer.size()) >= oscSize && writePos < oscSize)
-                {
-                    oscilloscopeBuffer[writePos] = monoSample;
-                    oscilloscopeLowBand[writePos] = lowBand;
-                    oscilloscopeMidBand[writePos] = midBand;
-                    oscilloscopeHighBand[writePos] = highBand;
-                }
+    for (int path = 0; path < numXYPaths; ++path)
+    {
+        auto& rate = xyPathRates[path];
+        const int choice = choices[static_cast<size_t>(path)];
+        rate.factorIndex = (choice > 0) ? juce::jmin(choice - 1, commonIndex) : commonIndex;
+        rate.divisor = 1 << (commonIndex - rate.factorIndex);
+        rate.lookahead = (lookaheadSamples + rate.divisor - 1) / rate.divisor;
+        rate.latency = xyPathResamplers[path].getLatency(commonIndex, rate.factorIndex)
+                     + lookaheadDelay(rate.lookahead) * rate.divisor;
+        slowestPath = juce::jmax(slowestPath, rate.latency);
+
+        xyPathResamplers[path].reset();
+    }
 
-                // Write to unified display buffer
-                DisplaySample displaySample;
-                displaySample.waveformL = sampleL;
-                displaySample.waveformR = sampleR;
-                displaySample.gainReduction = 0.0f;  // No GR in bypass mode
-                displaySample.lowBand = lowBand;
-                displaySample.midBand = midBand;
-                displaySample.highBand = highBand;
+    // Whole base-rate samples, so the dry delay and the reported latency stay exact
+    const int commonFactor = 1 << commonIndex;
+    xyPathAlignment = (slowestPath - commonPathLatency + commonFactor - 1) / commonFactor * commonFactor;
 
-                // === WAVEFORM GR METER: No processing in bypass mode ===
-                displaySample.inputSignal = monoSample;  // Input = output in bypass
-                displaySample.hardClipOutput = monoSample;
-                displaySample.softClipOutput = monoSample;
-                displaySample.slowLimitOutput = monoSample;
-                displaySample.fastLimitOutput = monoSample;
-                displaySample.finalOutput = monoSample;
+    for (auto& rate : xyPathRates)
+    {
+        rate.alignDelay = commonPathLatency + xyPathAlignment - rate.latency;
+        for (int ch = 0; ch < numBusChannels; ++ch)
+        {
+            rate.alignBuffer[ch].clear(rate.alignDelay);
+            rate.alignWritePos[ch] = 0;
+        }
+    }
 
-                // No GR in bypass mode
-                displaySample.hardClipGainReduction = 0.0f;
-                displaySample.softClipGainReduction = 0.0f;
-                displaySample.slowLimitGainReduction = 0.0f;
-                displaySample.fastLimitGainReduction = 0.0f;
+    xyPathChoices = choices;
+}
 
-                displayBuffer[displayWrite] = displaySample;
+double QuadBlendDriveAudioProcessor::getTailLengthSeconds() const
+{
+    const double pipelineSeconds = currentSampleRate > 0.0 ? pipeline.latency / currentSampleRate : 0.0;
+    return computeTailSeconds(apvts.getRawParameterValue("LIMIT_REL")->load(),
+                              apvts.getRawParameterValue("FL_LIMIT_RELEASE")->load()) + pipelineSeconds;
+}
+
+double QuadBlendDriveAudioProcessor::computeTailSeconds(double slowReleaseScaleMs, double fastReleaseMs) const
+{
+    // Slowest release time constant: the slow limiter's adaptive maximum (800 ms at the
+    // default 100 ms scale), the fast limiter, or the protection limiters (~80 ms)
+    const double slowestReleaseMs = juce::jmax(800.0 * slowReleaseScaleMs / 100.0, fastReleaseMs, 80.0);
+
+    // ln(100) time constants for an envelope to fall 40 dB, i.e. well clear of any gain reduction
+    const double recoverySeconds = slowestReleaseMs * 0.001 * std::log(100.0);
+    const double latencySeconds = currentSampleRate > 0.0 ? totalLatencySamples / currentSampleRate : 0.0;
+    return latencySeconds + recoverySeconds;
+}
+
+bool QuadBlendDriveAudioProcessor::advanceControlRate(int numSamples)
+{
+    controlRate.samplesUntilUpdate -= numSamples;
+    if (controlRate.samplesUntilUpdate > 0)
+        return false;
+
+    controlRate.samplesUntilUpdate += controlRateSamples;
+    if (controlRate.samplesUntilUpdate <= 0)  // Block longer than the interval
+        controlRate.samplesUntilUpdate = controlRateSamples;
+
+    // Peak followers: instant attack, ~50ms release (0.95 per ~10ms update)
+    auto updatePeak = [](std::atomic<float>& peak, float windowPeak) {
+        const float currentPeak = peak.load();
+        peak.store(windowPeak > currentPeak ? windowPeak : currentPeak * 0.95f);
+    };
+
+    updatePeak(inputPeakL, controlRate.inputPeakL);
+    updatePeak(inputPeakR, controlRate.inputPeakR);
+    updatePeak(outputPeakL, controlRate.outputPeakL);
+    updatePeak(outputPeakR, controlRate.outputPeakR);
+    updatePeak(meterPeak, controlRate.transferPeak);
+
+    currentOutputPeakL.store(controlRate.outputPeakL);
+    currentOutputPeakR.store(controlRate.outputPeakR);
+
+    // AGC loudness estimates (smoothed once per update, not once per block)
+    if (controlRate.agcInputCount > 0)
+    {
+        const float inputRms = static_cast<float>(std::sqrt(controlRate.agcInputSumSquares / controlRate.agcInputCount));
+        agcInputRMS.store(agcInputRMS.load() * 0.9f + inputRms * 0.1f);
+    }
+
+    if (controlRate.agcOutputCount > 0)
+    {
+        const float outputRms = static_cast<float>(std::sqrt(controlRate.agcOutputSumSquares / controlRate.agcOutputCount));
+        agcOutputRMS.store(agcOutputRMS.load() * 0.9f + outputRms * 0.1f);
+
+        const float smoothedInputRms = agcInputRMS.load();
+        const float smoothedOutputRms = agcOutputRMS.load();
+        if (smoothedOutputRms > 0.0001f && smoothedInputRms > 0.0001f)
+        {
+            // Clamp AGC gain to reasonable range (±maxAgcGainDB)
+            const auto maxAgcGain = static_cast<float>(juce::Decibels::decibelsToGain(maxAgcGainDB));
+            smoothedAgcGain.setTargetValue(juce::jlimit(1.0f / maxAgcGain, maxAgcGain, smoothedInputRms / smoothedOutputRms));
+        }
+    }
+
+    controlRate.clearWindow();
+    return true;
+}
+
+template<typename SampleType>
+QuadBlendDriveAudioProcessor::DerivedParameters<SampleType>& QuadBlendDriveAudioProcessor::getDerivedParameters()
+{
+    if constexpr (std::is_same<SampleType, float>::value)
+        return derivedParamsFloat;
+    else
+        return derivedParamsDouble;
+}
+
+template<typename SampleType>
+const QuadBlendDriveAudioProcessor::DerivedParameters<SampleType>& QuadBlendDriveAudioProcessor::updateDerivedParameters()
+{
+    auto& d = getDerivedParameters<SampleType>();
+    if (d.valid && d.generation == parameterGeneration)
+        return d;
+
+    d.generation = parameterGeneration;
+    d.valid = true;
+
+    const SampleType xyX = static_cast<SampleType>(params.xyX);
+    const SampleType xyY = static_cast<SampleType>(params.xyY);
+    const SampleType inputGainDB = static_cast<SampleType>(params.inputGainDB);
+    const SampleType outputGainDB = static_cast<SampleType>(params.outputGainDB);
+
+    d.threshold = juce::Decibels::decibelsToGain(static_cast<SampleType>(params.thresholdDB));
+    d.inputGain = juce::Decibels::decibelsToGain(inputGainDB);
+    d.outputGain = juce::Decibels::decibelsToGain(outputGainDB);
+    d.mixWet = static_cast<SampleType>(params.mixWetPercent) / static_cast<SampleType>(100.0);
+    d.scKnee = static_cast<SampleType>(params.scKneePercent) / static_cast<SampleType>(100.0);
+
+    // Quantize gains to exactly 1.0 when near 0 dB (unity gain)
+    // Prevents parameter smoothing from asymptotically approaching but never reaching unity
+    // This is critical for null tests and bit-perfect passthrough at unity gain
+    constexpr SampleType unityThresholdDB = static_cast<SampleType>(0.05);  // ±0.05 dB
+    if (std::abs(inputGainDB) < unityThresholdDB)
+        d.inputGain = static_cast<SampleType>(1.0);
+    if (std::abs(outputGainDB) < unityThresholdDB)
+        d.outputGain = static_cast<SampleType>(1.0);
+
+    // Quantize mix parameter at extremes (ensures smoothing reaches exact 0/1)
+    // Prevents asymptotic approach causing wet signal bleed at "0%" mix
+    if (d.mixWet < static_cast<SampleType>(0.005))  // < 0.5%
+        d.mixWet = static_cast<SampleType>(0.0);
+    else if (d.mixWet > static_cast<SampleType>(0.995))  // > 99.5%
+        d.mixWet = static_cast<SampleType>(1.0);
+
+    d.hcTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(params.hcTrimDB));
+    d.scTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(params.scTrimDB));
+    d.slTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(params.slTrimDB));
+    d.flTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(params.flTrimDB));
+
+    // Read mute and solo states
+    // Mute takes priority over solo (like an analog console - if it's cut, it's cut)
+    const bool hcMuteParam = params.hcMute > 0.5f;
+    const bool scMuteParam = params.scMute > 0.5f;
+    const bool slMuteParam = params.slMute > 0.5f;
+    const bool flMuteParam = params.flMute > 0.5f;
+
+    const bool hcSolo = params.hcSolo > 0.5f;
+    const bool scSolo = params.scSolo > 0.5f;
+    const bool slSolo = params.slSolo > 0.5f;
+    const bool flSolo = params.flSolo > 0.5f;
+
+    // Solo logic: if any processor is soloed, mute all non-soloed processors
+    // BUT explicit mute always takes priority (mute overrides solo)
+    const bool anySolo = hcSolo || scSolo || slSolo || flSolo;
+    bool hcMute = hcMuteParam;  // Explicit mute always applies
+    bool scMute = scMuteParam;
+    bool slMute = slMuteParam;
+    bool flMute = flMuteParam;
+    if (anySolo)
+    {
+        // Only mute non-soloed processors that aren't already explicitly muted
+        if (!hcSolo && !hcMuteParam) hcMute = true;
+        if (!scSolo && !scMuteParam) scMute = true;
+        if (!slSolo && !slMuteParam) slMute = true;
+        if (!flSolo && !flMuteParam) flMute = true;
+    }
+
+    // Calculate bi-linear blend weights from XY pad
+    // XY Grid Layout: Top-Left=HC, Top-Right=FL, Bottom-Left=SC, Bottom-Right=SL
+    // X-axis: Left=CLIPPING (HC/SC), Right=LIMITING (FL/SL)
+    // Y-axis: Top=HARD/TRANSPARENT (HC/FL), Bottom=SOFT/MUSICAL (SC/SL)
+    // GUI sends: Y=1 for TOP, Y=0 for BOTTOM; X=0 for LEFT, X=1 for RIGHT
+    d.wHC = (static_cast<SampleType>(1.0) - xyX) * xyY;  // Top-left (X=0, Y=1)
+    d.wFL = xyX * xyY;  // Top-right (X=1, Y=1)
+    d.wSC = (static_cast<SampleType>(1.0) - xyX) * (static_cast<SampleType>(1.0) - xyY);  // Bottom-left (X=0, Y=0)
+    d.wSL = xyX * (static_cast<SampleType>(1.0) - xyY);  // Bottom-right (X=1, Y=0)
+
+    // Apply mute logic: zero out weights for muted processors
+    if (hcMute) d.wHC = static_cast<SampleType>(0.0);
+    if (scMute) d.wSC = static_cast<SampleType>(0.0);
+    if (slMute) d.wSL = static_cast<SampleType>(0.0);
+    if (flMute) d.wFL = static_cast<SampleType>(0.0);
+
+    // Renormalize weights to sum to 1.0 (avoid division by zero)
+    const SampleType weightSum = d.wHC + d.wSC + d.wSL + d.wFL;
+    d.allProcessorsMuted = (weightSum <= static_cast<SampleType>(1e-10));
+    d.deltaTrimGain = static_cast<SampleType>(1.0);
+
+    if (!d.allProcessorsMuted)
+    {
+        const SampleType normFactor = static_cast<SampleType>(1.0) / weightSum;
+        d.wHC *= normFactor;
+        d.wSC *= normFactor;
+        d.wSL *= normFactor;
+        d.wFL *= normFactor;
+
+        // Effective trim of the blended wet path (weighted sum of trims). With master comp
+        // each processor's trim is undone after processing, so the effective trim is 1.0
+        if (params.masterComp <= 0.5f)
+            d.deltaTrimGain = d.wHC * d.hcTrimGain + d.wSC * d.scTrimGain + d.wSL * d.slTrimGain + d.wFL * d.flTrimGain;
+    }
+    else
+    {
+        // All processors muted - weights stay zero (will skip processing and use dry signal)
+        d.wHC = d.wSC = d.wSL = d.wFL = static_cast<SampleType>(0.0);
+    }
+
+    // Envelope shaper targets only move when their parameters do
+    hardClipShaper.setAttackEmphasis(params.hcAttackDB);
+    hardClipShaper.setSustainEmphasis(params.hcSustainDB);
+    softClipShaper.setAttackEmphasis(params.scAttackDB);
+    softClipShaper.setSustainEmphasis(params.scSustainDB);
+    slowLimitShaper.setAttackEmphasis(params.slAttackDB);
+    slowLimitShaper.setSustainEmphasis(params.slSustainDB);
+    fastLimitShaper.setAttackEmphasis(params.flAttackDB);
+    fastLimitShaper.setSustainEmphasis(params.flSustainDB);
+
+    return d;
+}
+
+//==============================================================================
+// ProcessBlock wrappers
+void QuadBlendDriveAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processBlockInternal(buffer, midiMessages);
+}
+
+void QuadBlendDriveAudioProcessor::processBlock(juce::AudioBuffer<double>& buffer, juce::MidiBuffer& midiMessages)
+{
+    processBlockInternal(buffer, midiMessages);
+}
+
+//==============================================================================
+// Template processBlock implementation
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<SampleType>& buffer,
+                                                         juce::MidiBuffer&)
+{
+    juce::ScopedNoDenormals noDenormals;
+    const int totalNumInputChannels = getTotalNumInputChannels();
+    const int totalNumOutputChannels = getTotalNumOutputChannels();
+    const int numSamples = buffer.getNumSamples();
+
+    // DEBUG: Uncomment this block to test absolute zero-latency bypass
+    // If latency persists with this enabled, it's in JUCE/host, not our code
+    // #define DEBUG_ZERO_LATENCY_TEST
+    #ifdef DEBUG_ZERO_LATENCY_TEST
+    {
+        const int processingMode = static_cast<int>(apvts.getRawParameterValue("PROCESSING_MODE")->load());
+        if (processingMode == 0)
+        {
+            // Absolute minimum: just clear unused channels and return
+            for (int i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
+                buffer.clear(i, 0, numSamples);
+            return;  // Complete bypass - buffer passes through unchanged
+        }
+    }
+    #endif
+
+    // === TRANSPORT STATE DETECTION ===
+    updateTransportState();
+
+    for (int i = totalNumInputChannels; i < totalNumOutputChannels; ++i)
+        buffer.clear(i, 0, numSamples);
+
+    // === PIPELINED ENGINE ===
+    // Switching it on or off changes the latency, so either way start from an empty
+    // pipeline (a FIFO of silence, nothing in flight)
+    const int pipelineLatency = pipelinedEngine->load() > 0.5f ? preparedBlockSize : 0;
+    if (pipelineLatency != pipeline.latency || pipeline.restart)
+    {
+        pipeline.latency = pipelineLatency;
+        pipeline.inputBank = 0;
+        pipeline.numSlices[0] = pipeline.numSlices[1] = 0;
+        pipeline.fifoRead = pipeline.fifoWrite = 0;
+        pipeline.restart = false;
+
+        if (pipeline.latency > 0)
+            scratch.getBuffer<SampleType>(ScratchArena::PipelineOutput, buffer.getNumChannels(), pipeline.latency).clear();
+
+        setLatencySamples(totalLatencySamples + pipeline.latency);
+    }
+
+    if (pipeline.latency > 0)
+    {
+        for (int startSample = 0; startSample < numSamples; startSample += pipeline.latency)
+            processPipelineStep(buffer, startSample, juce::jmin(pipeline.latency, numSamples - startSample));
+        return;
+    }
+
+    // === MICRO-BLOCK SCHEDULER ===
+    // Run the whole chain (oversample -> XY blend -> downsample -> limiters) on fixed
+    // slices of the host block, referencing the host's memory in place. Scratch buffers
+    // and oversamplers are sized for one micro-block, so at 16x everything stays cache
+    // resident, and host blocks larger than prepareToPlay's samplesPerBlock are safe.
+    for (int startSample = 0; startSample < numSamples; startSample += microBlockSize)
+    {
+        const int microBlockSamples = juce::jmin(microBlockSize, numSamples - startSample);
+        juce::AudioBuffer<SampleType> microBlock(buffer.getArrayOfWritePointers(), buffer.getNumChannels(),
+                                                 startSample, microBlockSamples);
+        processMicroBlock(microBlock);
+    }
+}
+
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::processMicroBlock(juce::AudioBuffer<SampleType>& buffer)
+{
+    MicroBlockHandoff handoff;
+    if (!processMicroBlockInput(buffer, handoff))
+        return;
+
+    processMicroBlockLimiters(buffer, handoff);
+    processMicroBlockOutput(buffer, scratch.getBuffer<SampleType>(ScratchArena::Dry, buffer.getNumChannels(), buffer.getNumSamples()),
+                            handoff);
+}
+
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::processPipelineStep(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples)
+{
+    const int numChannels = buffer.getNumChannels();
+    const int inputBank = pipeline.inputBank;
+    const int outputBank = 1 - inputBank;
+    const int bankSamples = 2 * pipeline.slicesPerBank * microBlockSize;
+    auto blocks = scratch.getBuffer<SampleType>(ScratchArena::PipelineBlocks, numChannels, bankSamples);
+    auto dryBlocks = scratch.getBuffer<SampleType>(ScratchArena::PipelineDry, numChannels, bankSamples);
+
+    // View of one parked micro-block
+    auto slice = [&](juce::AudioBuffer<SampleType>& storage, int bank, int index, int length)
+    {
+        return juce::AudioBuffer<SampleType>(storage.getArrayOfWritePointers(), numChannels,
+                                             (bank * pipeline.slicesPerBank + index) * microBlockSize, length);
+    };
+    auto handoffOf = [&](int bank, int index) -> MicroBlockHandoff&
+    {
+        return pipeline.handoffs[static_cast<size_t>(bank * pipeline.slicesPerBank + index)];
+    };
+
+    // This step's input, one micro-block at a time, into the input bank. It publishes
+    // latency, reads the parameters, feeds the display and may share the XY paths out, so
+    // it always runs on the audio thread.
+    auto runInputStage = [&]
+    {
+        int index = 0;
+        for (int offset = 0; offset < numSamples; offset += microBlockSize, ++index)
+        {
+            auto& handoff = handoffOf(inputBank, index);
+            handoff.numSamples = juce::jmin(microBlockSize, numSamples - offset);
+
+            auto block = slice(blocks, inputBank, index, handoff.numSamples);
+            for (int ch = 0; ch < numChannels; ++ch)
+                block.copyFrom(ch, 0, buffer, ch, startSample + offset, handoff.numSamples);
+
+            handoff.runOutputStages = processMicroBlockInput(block, handoff);
+            if (handoff.runOutputStages && handoff.needsDry)
+            {
+                auto dry = slice(dryBlocks, inputBank, index, handoff.numSamples);
+                ScratchArena::copy(dry, scratch.getBuffer<SampleType>(ScratchArena::Dry, numChannels, handoff.numSamples));
+            }
+        }
+        pipeline.numSlices[inputBank] = index;
+    };
+
+    // The output limiters over the previous step's blocks. They share no state with the
+    // input stage and only touch the parked blocks, so the worker may take them meanwhile
+    // (or the audio thread runs them afterwards).
+    auto runLimiterStage = [&](int)
+    {
+        for (int index = 0; index < pipeline.numSlices[outputBank]; ++index)
+        {
+            const auto& handoff = handoffOf(outputBank, index);
+            if (handoff.runOutputStages)
+            {
+                auto block = slice(blocks, outputBank, index, handoff.numSamples);
+                processMicroBlockLimiters(block, handoff);
+            }
+        }
+    };
+    pipelineWorkers.runAlongside(runInputStage, 1, runLimiterStage);
+
+    // The output stage shares meters, AGC and the display with the input stage, so it runs
+    // after the join: finish the previous step's blocks into the FIFO...
+    auto fifo = scratch.getBuffer<SampleType>(ScratchArena::PipelineOutput, numChannels, pipeline.latency);
+    for (int index = 0; index < pipeline.numSlices[outputBank]; ++index)
+    {
+        const auto& handoff = handoffOf(outputBank, index);
+        auto block = slice(blocks, outputBank, index, handoff.numSamples);
+        if (handoff.runOutputStages)
+            processMicroBlockOutput(block, slice(dryBlocks, outputBank, index, handoff.numSamples), handoff);
+
+        const int first = juce::jmin(handoff.numSamples, pipeline.latency - pipeline.fifoWrite);
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            fifo.copyFrom(ch, pipeline.fifoWrite, block, ch, 0, first);
+            fifo.copyFrom(ch, 0, block, ch, first, handoff.numSamples - first);
+        }
+        pipeline.fifoWrite = (pipeline.fifoWrite + handoff.numSamples) % pipeline.latency;
+    }
+
+    // ...and output this step one pipeline latency late (the FIFO started out holding
+    // that much silence and every step puts back what it takes)
+    const int first = juce::jmin(numSamples, pipeline.latency - pipeline.fifoRead);
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        buffer.copyFrom(ch, startSample, fifo, ch, pipeline.fifoRead, first);
+        buffer.copyFrom(ch, startSample + first, fifo, ch, 0, numSamples - first);
+    }
+    pipeline.fifoRead = (pipeline.fifoRead + numSamples) % pipeline.latency;
+
+    pipeline.inputBank = outputBank;
+}
+
+template<typename SampleType>
+bool QuadBlendDriveAudioProcessor::processMicroBlockInput(juce::AudioBuffer<SampleType>& buffer, MicroBlockHandoff& handoff)
+{
+    const int numSamples = buffer.getNumSamples();
+
+    // Snapshot all parameters once; everything below reads from params
+    readParameterSnapshot();
+
+    // If bypass is engaged, capture the dry input signal to oscilloscope and return
+    if (routing.bypass)
+    {
+        // === WAVEFORM DISPLAY DATA CAPTURE (Bypass Mode) ===
+        // Apply frequency band filters once and write to both legacy and new display buffers
+        // Only update display buffer when an editor is open and transport is playing (not frozen)
+        if (editorOpen.load() && !displayBufferFrozen.load())
+        {
+            int writePos = oscilloscopeWritePos.load();
+            int oscSize = oscilloscopeSize.load();
+            int displayWrite = displayWritePos.load();
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                // Get stereo samples
+                float sampleL = 0.0f;
+                float sampleR = 0.0f;
+                if (buffer.getNumChannels() > 0)
+                    sampleL = static_cast<float>(buffer.getReadPointer(0)[i]);
+                if (buffer.getNumChannels() > 1)
+                    sampleR = static_cast<float>(buffer.getReadPointer(1)[i]);
+
+                // Create mono mix for frequency analysis
+                float monoSample = (sampleL + sampleR) * 0.5f;
+                double sample = static_cast<double>(monoSample);
+
+                // Apply frequency band filters ONCE (use left channel filter state)
+                // Low-pass filter (Red channel <250 Hz)
+                double lowOut = oscFilters[0].lowB0 * sample + oscFilters[0].lowZ1;
+                oscFilters[0].lowZ1 = oscFilters[0].lowB1 * sample - oscFilters[0].lowA1 * lowOut + oscFilters[0].lowZ2;
+                oscFilters[0].lowZ2 = oscFilters[0].lowB2 * sample - oscFilters[0].lowA2 * lowOut;
+                float lowBand = static_cast<float>(std::abs(lowOut));
+
+                // Band-pass filter (Green channel 250-4000 Hz)
+                double midOut = oscFilters[0].midB0 * sample + oscFilters[0].midZ1;
+                oscFilters[0].midZ1 = oscFilters[0].midB1 * sample - oscFilters[0].midA1 * midOut + oscFilters[0].midZ2;
+                oscFilters[0].midZ2 = oscFilters[0].midB2 * sample - oscFilters[0].midA2 * midOut;
+                float midBand = static_cast<float>(std::abs(midOut));
+
+                // High-pass filter (Blue channel >4000 Hz)
+                double highOut = oscFilters[0].highB0 * sample + oscFilters[0].highZ1;
+                oscFilters[0].highZ1 = oscFilters[0].highB1 * sample - oscFilters[0].highA1 * highOut + oscFilters[0].highZ2;
+                oscFilters[0].highZ2 = oscFilters[0].highB2 * sample - oscFilters[0].highA2 * highOut;
+                float highBand = static_cast<float>(std::abs(highOut));
+
+                // Write to legacy oscilloscope buffer (if active)
+                if (oscSize > 0 && static_cast<int>(oscilloscopeBuffer.size()) >= oscSize && writePos < oscSize)
+                {
+                    oscilloscopeBuffer[writePos] = monoSample;
+                    oscilloscopeLowBand[writePos] = lowBand;
+                    oscilloscopeMidBand[writePos] = midBand;
+                    oscilloscopeHighBand[writePos] = highBand;
+                }
+
+                // Write to unified display buffer
+                DisplaySample displaySample;
+                displaySample.waveformL = sampleL;
+                displaySample.waveformR = sampleR;
+                displaySample.gainReduction = 0.0f;  // No GR in bypass mode
+                displaySample.lowBand = lowBand;
+                displaySample.midBand = midBand;
+                displaySample.highBand = highBand;
+
+                // === WAVEFORM GR METER: No processing in bypass mode ===
+                displaySample.inputSignal = monoSample;  // Input = output in bypass
+                displaySample.hardClipOutput = monoSample;
+                displaySample.softClipOutput = monoSample;
+                displaySample.slowLimitOutput = monoSample;
+                displaySample.fastLimitOutput = monoSample;
+                displaySample.finalOutput = monoSample;
+
+                // No GR in bypass mode
+                displaySample.hardClipGainReduction = 0.0f;
+                displaySample.softClipGainReduction = 0.0f;
+                displaySample.slowLimitGainReduction = 0.0f;
+                displaySample.fastLimitGainReduction = 0.0f;
+
+                displayBuffer[displayWrite] = displaySample;
 
                 // Update ring buffer positions
                 if (oscSize > 0)
@@ -1208,6 +2083,7 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
             if (oscSize > 0)
                 oscilloscopeWritePos.store(writePos);
             displayWritePos.store(displayWrite);
+            displaySamplesWritten.store(displaySamplesWritten.load() + static_cast<uint64_t>(numSamples), std::memory_order_release);
         }
 
         // Update output peak meters (bypass mode)
@@ -1243,117 +2119,35 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         currentSlowLimitGR.store(0.0f);
         currentFastLimitGR.store(0.0f);
 
-        return;
-    }
-
-    // Get correct buffers for this precision
-    auto& dryBuffer = std::is_same<SampleType, float>::value ?
-                      reinterpret_cast<juce::AudioBuffer<SampleType>&>(dryBufferFloat) :
-                      reinterpret_cast<juce::AudioBuffer<SampleType>&>(dryBufferDouble);
-    auto& tempBuffer1 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer1Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer1Double);
-    auto& tempBuffer2 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer2Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer2Double);
-    auto& tempBuffer3 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer3Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer3Double);
-    auto& tempBuffer4 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer4Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer4Double);
-
-    // Read parameters
-    const SampleType xyX = static_cast<SampleType>(apvts.getRawParameterValue("XY_X_PARAM")->load());
-    const SampleType xyY = static_cast<SampleType>(apvts.getRawParameterValue("XY_Y_PARAM")->load());
-
-    const SampleType thresholdDB = static_cast<SampleType>(apvts.getRawParameterValue("THRESHOLD")->load());
-    const SampleType inputGainDB = static_cast<SampleType>(apvts.getRawParameterValue("INPUT_GAIN")->load());
-    const SampleType outputGainDB = static_cast<SampleType>(apvts.getRawParameterValue("OUTPUT_GAIN")->load());
-    const SampleType mixWetPercent = static_cast<SampleType>(apvts.getRawParameterValue("MIX_WET")->load());
-    const SampleType scKneePercent = static_cast<SampleType>(apvts.getRawParameterValue("SC_KNEE")->load());
-    const SampleType limitRelMs = static_cast<SampleType>(apvts.getRawParameterValue("LIMIT_REL")->load());
-    const SampleType slAttackMs = static_cast<SampleType>(apvts.getRawParameterValue("SL_LIMIT_ATTACK")->load());
-    const SampleType flAttackMs = static_cast<SampleType>(apvts.getRawParameterValue("FL_LIMIT_ATTACK")->load());
-    const SampleType flReleaseMs = static_cast<SampleType>(apvts.getRawParameterValue("FL_LIMIT_RELEASE")->load());
-
-    const SampleType hcTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("HC_TRIM")->load());
-    const SampleType scTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("SC_TRIM")->load());
-    const SampleType slTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("SL_TRIM")->load());
-    const SampleType flTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("FL_TRIM")->load());
-
-    // Read mute and solo states
-    // Mute takes priority over solo (like an analog console - if it's cut, it's cut)
-    const bool hcMuteParam = apvts.getRawParameterValue("HC_MUTE")->load() > 0.5f;
-    const bool scMuteParam = apvts.getRawParameterValue("SC_MUTE")->load() > 0.5f;
-    const bool slMuteParam = apvts.getRawParameterValue("SL_MUTE")->load() > 0.5f;
-    const bool flMuteParam = apvts.getRawParameterValue("FL_MUTE")->load() > 0.5f;
-
-    const bool hcSolo = apvts.getRawParameterValue("HC_SOLO")->load() > 0.5f;
-    const bool scSolo = apvts.getRawParameterValue("SC_SOLO")->load() > 0.5f;
-    const bool slSolo = apvts.getRawParameterValue("SL_SOLO")->load() > 0.5f;
-    const bool flSolo = apvts.getRawParameterValue("FL_SOLO")->load() > 0.5f;
-
-    // Solo logic: if any processor is soloed, mute all non-soloed processors
-    // BUT explicit mute always takes priority (mute overrides solo)
-    const bool anySolo = hcSolo || scSolo || slSolo || flSolo;
-    bool hcMute = hcMuteParam;  // Explicit mute always applies
-    bool scMute = scMuteParam;
-    bool slMute = slMuteParam;
-    bool flMute = flMuteParam;
-    if (anySolo)
-    {
-        // Only mute non-soloed processors that aren't already explicitly muted
-        if (!hcSolo && !hcMuteParam) hcMute = true;
-        if (!scSolo && !scMuteParam) scMute = true;
-        if (!slSolo && !slMuteParam) slMute = true;
-        if (!flSolo && !flMuteParam) flMute = true;
+        return false;
     }
 
-    const bool deltaMode = apvts.getRawParameterValue("DELTA_MODE")->load() > 0.5f;
-    const bool agcEnabled = apvts.getRawParameterValue("AGC_ENABLE")->load() > 0.5f;
+    // Derived gains and blend weights (recomputed only when a parameter changed)
+    const auto& derived = updateDerivedParameters<SampleType>();
 
-    const SampleType threshold = juce::Decibels::decibelsToGain(thresholdDB);
-    SampleType inputGain = juce::Decibels::decibelsToGain(inputGainDB);
-    SampleType outputGain = juce::Decibels::decibelsToGain(outputGainDB);
-    SampleType mixWet = mixWetPercent / static_cast<SampleType>(100.0);
-    const SampleType scKnee = scKneePercent / static_cast<SampleType>(100.0);
+    const bool deltaMode = routing.deltaMode;
+    const bool agcEnabled = routing.agcEnabled;
 
-    // Quantize gains to exactly 1.0 when near 0 dB (unity gain)
-    // Prevents parameter smoothing from asymptotically approaching but never reaching unity
-    // This is critical for null tests and bit-perfect passthrough at unity gain
-    constexpr SampleType unityThresholdDB = static_cast<SampleType>(0.05);  // ±0.05 dB
-    if (std::abs(inputGainDB) < unityThresholdDB)
-        inputGain = static_cast<SampleType>(1.0);
-    if (std::abs(outputGainDB) < unityThresholdDB)
-        outputGain = static_cast<SampleType>(1.0);
-
-    // Quantize mix parameter at extremes (ensures smoothing reaches exact 0/1)
-    // Prevents asymptotic approach causing wet signal bleed at "0%" mix
-    if (mixWet < static_cast<SampleType>(0.005))  // < 0.5%
-        mixWet = static_cast<SampleType>(0.0);
-    else if (mixWet > static_cast<SampleType>(0.995))  // > 99.5%
-        mixWet = static_cast<SampleType>(1.0);
+    const SampleType inputGain = derived.inputGain;
+    const SampleType outputGain = derived.outputGain;
+    const SampleType mixWet = derived.mixWet;
 
     // Update parameter smoother targets (smooth over 20ms to prevent zipper noise)
     smoothedInputGain.setTargetValue(static_cast<float>(inputGain));
     smoothedOutputGain.setTargetValue(static_cast<float>(outputGain));
     smoothedMixWet.setTargetValue(static_cast<float>(mixWet));
 
-    const SampleType hcTrimGain = juce::Decibels::decibelsToGain(hcTrimDB);
-    const SampleType scTrimGain = juce::Decibels::decibelsToGain(scTrimDB);
-    const SampleType slTrimGain = juce::Decibels::decibelsToGain(slTrimDB);
-    const SampleType flTrimGain = juce::Decibels::decibelsToGain(flTrimDB);
-
     // === MODE SWITCHING (LOCK-FREE - safe on audio thread) ===
     // Get current processing mode from parameter (NOT from osManager to detect changes)
-    const int processingMode = static_cast<int>(apvts.getRawParameterValue("PROCESSING_MODE")->load());
+    const int processingMode = routing.processingMode;
 
-    // Check if mode changed - update osManager with lock-free atomic operation
-    if (processingMode != osManager.getProcessingMode())
+    // Check if engine, oversampling factor or per-path factors changed - update osManager with lock-free atomic operation
+    if (processingMode != osManager.getProcessingMode()
+        || OversamplingManager::getFactorIndex(processingMode, routing.oversamplingChoice) != osManager.getFactorIndex()
+        || routing.pathOversampling != xyPathChoices)
     {
         // LOCK-FREE mode switch - NO memory allocation
-        osManager.setMode(processingMode);
+        osManager.setMode(processingMode, routing.oversamplingChoice);
 
         // Recalculate lookahead times based on new processing mode
         double xyProcessorLookaheadMs = 3.0;  // Default
@@ -1367,19 +2161,26 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         // Recalculate lookahead samples at new OS rate
         const double newOsSampleRate = osManager.getOsSampleRate();
         lookaheadSamples = static_cast<int>(std::ceil(newOsSampleRate * xyProcessorLookaheadMs / 1000.0));
+        advancedTPLLookaheadSamples = static_cast<int>(std::ceil(getProtectionOsSampleRate(processingMode) * 2.0 / 1000.0));
+
+        // Re-lay out the XY paths for the new common rate (also clears their resampler history)
+        updateXYPathRates(routing.pathOversampling);
+
+        // The shared transient detector keeps its time constants at the new OS rate
+        xyTransientDetector.setSampleRate(newOsSampleRate);
 
-        // Update latency reporting for new mode
+        // Update latency reporting for new mode (filter latency depends on engine and factor)
         const int osFilterLatency = osManager.getLatencySamples();  // At base rate
         const int xyLookaheadBaseSamples = (processingMode == 0) ? 0 :
             static_cast<int>(std::ceil(currentSampleRate * xyProcessorLookaheadMs / 1000.0));
-        const int newLatency = osFilterLatency + xyLookaheadBaseSamples;
-        setLatencySamples(newLatency);
+        totalLatencySamples = osFilterLatency + xyLookaheadBaseSamples + xyPathAlignment / osManager.getOsMultiplier();
+        setLatencySamples(totalLatencySamples + pipeline.latency);
 
         // Notify host of latency change
         updateHostDisplay(juce::AudioProcessorListener::ChangeDetails().withLatencyChanged(true));
 
         // Reset processor states to clear stale data from previous mode
-        for (int ch = 0; ch < 2; ++ch)
+        for (int ch = 0; ch < numBusChannels; ++ch)
         {
             // Reset lookahead write positions
             hardClipState[ch].lookaheadWritePos = 0;
@@ -1389,18 +2190,83 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
 
             // Clear lookahead buffers (prevent glitches from stale data)
             // NOTE: These are already allocated to max size in prepareToPlay() - no resize needed
-            std::fill(hardClipState[ch].lookaheadBuffer.begin(), hardClipState[ch].lookaheadBuffer.end(), 0.0);
-            std::fill(softClipState[ch].lookaheadBuffer.begin(), softClipState[ch].lookaheadBuffer.end(), 0.0);
-            std::fill(slowLimiterState[ch].lookaheadBuffer.begin(), slowLimiterState[ch].lookaheadBuffer.end(), 0.0);
-            std::fill(fastLimiterState[ch].lookaheadBuffer.begin(), fastLimiterState[ch].lookaheadBuffer.end(), 0.0);
+            hardClipState[ch].lookaheadBuffer.clear();
+            softClipState[ch].lookaheadBuffer.clear();
+            hardClipState[ch].adaa.reset();
+            softClipState[ch].adaa.reset();
+            slowLimiterState[ch].lookaheadBuffer.clear();
+            fastLimiterState[ch].lookaheadBuffer.clear();
 
             // Reset dry delay buffer write position (already allocated to max size)
             // NO RESIZE - buffer is pre-allocated in prepareToPlay()
             dryDelayState[ch].writePos = 0;
             // Clear only the portion we're using for this mode
-            const int clearSize = std::min(lookaheadSamples, static_cast<int>(dryDelayState[ch].delayBuffer.size()));
-            std::fill(dryDelayState[ch].delayBuffer.begin(),
-                     dryDelayState[ch].delayBuffer.begin() + clearSize, 0.0);
+            dryDelayState[ch].delayBuffer.clear(lookaheadSamples + xyPathAlignment);
+        }
+
+        // ADAPTIVE_OS: the new chain starts engaged and has to earn its idle time again
+        adaptiveOs.idle = false;
+        adaptiveOs.quietSamples = 0;
+
+        // MONO DETECTION: likewise (the new engine's right side has not been following)
+        monoDetection = {};
+    }
+
+    // === SILENCE GATE ===
+    // Once the input has been silent for longer than the tail, every lookahead line,
+    // oversampler and resampler holds only zeros and the envelopes have recovered, so the
+    // chain can only output silence: write it directly. Skipped while the display is
+    // capturing so the scope keeps scrolling.
+    //
+    // The gate sits before every gain stage, so "silent" is judged at the output: the
+    // threshold comes down by the most the current settings could amplify the input
+    // (normalization, input gain, the hottest path's trim and emphasis, AGC, output gain).
+    const float pathGainDB = juce::jmax(params.hcTrimDB + juce::jmax(params.hcAttackDB, params.hcSustainDB, 0.0f),
+                                        params.scTrimDB + juce::jmax(params.scAttackDB, params.scSustainDB, 0.0f),
+                                        params.slTrimDB + juce::jmax(params.slAttackDB, params.slSustainDB, 0.0f),
+                                        params.flTrimDB + juce::jmax(params.flAttackDB, params.flSustainDB, 0.0f));
+    const double worstGainDB = (normalizationEnabled ? juce::Decibels::gainToDecibels(computedNormalizationGain) : 0.0)
+                             + static_cast<double>(params.inputGainDB + juce::jmax(pathGainDB, 0.0f))
+                             + (agcEnabled ? maxAgcGainDB : 0.0) + static_cast<double>(params.outputGainDB);
+    const auto gateThreshold = static_cast<SampleType>(silenceThreshold * juce::Decibels::decibelsToGain(-juce::jmax(worstGainDB, 0.0), -400.0));
+
+    SampleType silenceInputPeak = static_cast<SampleType>(0.0);
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        silenceInputPeak = juce::jmax(silenceInputPeak, buffer.getMagnitude(ch, 0, numSamples));
+
+    if (silenceInputPeak > gateThreshold)
+    {
+        silentInputSamples = 0;
+    }
+    else
+    {
+        const int tailSamples = static_cast<int>(std::ceil(computeTailSeconds(params.limitRelMs, params.flReleaseMs)
+                                                           * currentSampleRate));
+        silentInputSamples = juce::jmin(silentInputSamples + numSamples, tailSamples + microBlockSize);
+
+        if (silentInputSamples > tailSamples && !(editorOpen.load() && !displayBufferFrozen.load()))
+        {
+            buffer.clear();
+
+            // Gain smoothers keep moving as if the block had been processed
+            smoothedInputGain.skip(numSamples);
+            smoothedOutputGain.skip(numSamples);
+            smoothedMixWet.skip(numSamples);
+
+            currentGainReductionDB.store(0.0f);
+            currentInputPeak.store(0.0f);
+            currentHardClipPeak.store(0.0f);
+            currentSoftClipPeak.store(0.0f);
+            currentSlowLimitPeak.store(0.0f);
+            currentFastLimitPeak.store(0.0f);
+            currentHardClipGR.store(0.0f);
+            currentSoftClipGR.store(0.0f);
+            currentSlowLimitGR.store(0.0f);
+            currentFastLimitGR.store(0.0f);
+
+            // Meters fall back through the control-rate peak followers (AGC holds)
+            advanceControlRate(numSamples);
+            return false;
         }
     }
 
@@ -1428,13 +2294,49 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
     // 7. Dry/wet mix
     // Result: Adjusting input gain changes drive amount without changing output level (when master comp on)
 
+    // XY blend weights are applied in processXYBlend; here we only need to know if anything is audible
+    const bool allProcessorsMuted = derived.allProcessorsMuted;
+
+    // Display capture only matters while an editor is open and the transport is running
+    const bool displayActive = editorOpen.load() && !displayBufferFrozen.load();
+
+    // The dry copy is only read by the mix, delta mode, the muted passthrough and the display.
+    // Modes 1/2 always need it: the dry channels must keep flowing through the
+    // oversampler so its filter state stays coherent with the wet path
+    const bool mixFullyWet = !smoothedMixWet.isSmoothing()
+                          && static_cast<SampleType>(smoothedMixWet.getTargetValue()) > static_cast<SampleType>(0.999);
+    const bool needsDry = processingMode != 0 || allProcessorsMuted || deltaMode || !mixFullyWet || displayActive;
+
     // === CAPTURE PRISTINE INPUT (BEFORE normalization) ===
-    // Used for dry signal when all processors muted
-    auto& pristineInputBuffer = (std::is_same<SampleType, float>::value)
-        ? reinterpret_cast<juce::AudioBuffer<SampleType>&>(originalInputBufferFloat)
-        : reinterpret_cast<juce::AudioBuffer<SampleType>&>(originalInputBufferDouble);
+    // Dry path: pristine input, NO normalization, NO gains
+    // Mix at 0% should always give pristine input regardless of normalization setting
+    auto dryBuffer = scratch.getBuffer<SampleType>(ScratchArena::Dry, buffer.getNumChannels(), numSamples);
+    SampleType pristinePeak = static_cast<SampleType>(0.0);  // Stands in for the dry copy in the GR meter
+
+    if (needsDry)
+    {
+        ScratchArena::copy(dryBuffer, buffer);
+    }
+    else
+    {
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            pristinePeak = juce::jmax(pristinePeak, buffer.getMagnitude(ch, 0, numSamples));
+    }
 
-    pristineInputBuffer.makeCopyOf(buffer);  // Capture BEFORE normalization
+    // === AGC INPUT RMS MEASUREMENT ===
+    // Accumulate pristine input energy for auto-gain compensation
+    if (agcEnabled)
+    {
+        SampleType inputSumSquares = static_cast<SampleType>(0.0);
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            const auto* data = buffer.getReadPointer(ch);
+            for (int i = 0; i < numSamples; ++i)
+                inputSumSquares += data[i] * data[i];
+        }
+        controlRate.agcInputSumSquares += static_cast<double>(inputSumSquares);
+        controlRate.agcInputCount += numSamples * buffer.getNumChannels();
+    }
 
     // === INPUT NORMALIZATION ===
     // Apply normalization gain FIRST (before everything else)
@@ -1447,9 +2349,7 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
 
     // === CHANNEL MODE: M/S ENCODING ===
     // 0 = Stereo (no change), 1 = Mid-Side
-    const int channelMode = static_cast<int>(apvts.getRawParameterValue("CHANNEL_MODE")->load());
-
-    if (channelMode == 1 && buffer.getNumChannels() >= 2)  // Mid-Side mode
+    if (routing.midSide && buffer.getNumChannels() >= 2)  // Mid-Side mode
     {
         // Encode L/R to M/S: Mid = (L+R)/2, Side = (L-R)/2
         auto* left = buffer.getWritePointer(0);
@@ -1464,31 +2364,27 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
     }
 
     // === CAPTURE NORMALIZED INPUT (After normalization, BEFORE input gain) ===
-    // Used for wet signal when all processors muted, and for normal dry signal
-    auto& normalizedInputBuffer = (std::is_same<SampleType, float>::value)
-        ? reinterpret_cast<juce::AudioBuffer<SampleType>&>(originalInputBufferDouble)
-        : reinterpret_cast<juce::AudioBuffer<SampleType>&>(originalInputBufferFloat);
-
-    normalizedInputBuffer.makeCopyOf(buffer);  // Capture AFTER normalization
+    // Only the muted passthrough uses it (as its wet signal)
+    auto normalizedInputBuffer = scratch.getBuffer<SampleType>(ScratchArena::NormalizedInput, buffer.getNumChannels(), numSamples);
+    if (allProcessorsMuted)
+        ScratchArena::copy(normalizedInputBuffer, buffer);  // Capture AFTER normalization
 
     // === INPUT GAIN (Wet path only - drives saturation) ===
     // Apply manual input gain to WET signal only (smoothed per-sample to prevent zipper noise)
-    SampleType totalInputGainAccumulated = static_cast<SampleType>(0.0);
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    if (smoothedInputGain.isSmoothing())
     {
-        auto* data = buffer.getWritePointer(ch);
-        for (int i = 0; i < numSamples; ++i)
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
         {
-            const SampleType smoothedGain = static_cast<SampleType>(smoothedInputGain.getNextValue());
-            data[i] *= smoothedGain;
-            if (ch == 0)  // Track only once per sample
-                totalInputGainAccumulated += smoothedGain;
+            auto* data = buffer.getWritePointer(ch);
+            for (int i = 0; i < numSamples; ++i)
+                data[i] *= static_cast<SampleType>(smoothedInputGain.getNextValue());
         }
     }
-
-    // Store average total input gain for GR calculation
-    const SampleType avgSmoothedInputGain = totalInputGainAccumulated / static_cast<SampleType>(numSamples);
-    const SampleType totalInputGain = normGain * avgSmoothedInputGain;
+    else if (smoothedInputGain.getTargetValue() != 1.0f)
+    {
+        // Settled: one vectorised multiply instead of a smoother step per sample
+        buffer.applyGain(static_cast<SampleType>(smoothedInputGain.getTargetValue()));
+    }
 
     // === STEREO I/O METERS: MEASURE INPUT SAMPLE PEAK ===
     // Use sample peak for consistent metering with DAWs (true peak can read +3-4dB higher)
@@ -1506,69 +2402,9 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
     }
     if (buffer.getNumChannels() == 1) inPkR = inPkL;
 
-    // Update peak followers with instant attack, ~50ms release
-    auto updatePeak = [](std::atomic<float>& peak, float blockPeak) {
-        float currentPeak = peak.load();
-        if (blockPeak > currentPeak)
-            peak.store(blockPeak);  // Instant attack
-        else
-            peak.store(currentPeak * 0.95f);  // ~50ms release at 48kHz
-    };
-
-    updatePeak(inputPeakL, inPkL);
-    updatePeak(inputPeakR, inPkR);
-
-    // === AGC INPUT RMS MEASUREMENT ===
-    // Measure pristine input RMS for auto-gain compensation
-    if (agcEnabled)
-    {
-        SampleType inputSumSquares = static_cast<SampleType>(0.0);
-        for (int ch = 0; ch < pristineInputBuffer.getNumChannels(); ++ch)
-        {
-            const auto* data = pristineInputBuffer.getReadPointer(ch);
-            for (int i = 0; i < numSamples; ++i)
-                inputSumSquares += data[i] * data[i];
-        }
-        float inputRms = std::sqrt(static_cast<float>(inputSumSquares) /
-                                   static_cast<float>(numSamples * pristineInputBuffer.getNumChannels()));
-        // Smooth input RMS measurement
-        float prevInputRms = agcInputRMS.load();
-        agcInputRMS.store(prevInputRms * 0.9f + inputRms * 0.1f);
-    }
-
-    // Calculate bi-linear blend weights from XY pad
-    // XY Grid Layout: Top-Left=HC, Top-Right=FL, Bottom-Left=SC, Bottom-Right=SL
-    // X-axis: Left=CLIPPING (HC/SC), Right=LIMITING (FL/SL)
-    // Y-axis: Top=HARD/TRANSPARENT (HC/FL), Bottom=SOFT/MUSICAL (SC/SL)
-    // GUI sends: Y=1 for TOP, Y=0 for BOTTOM; X=0 for LEFT, X=1 for RIGHT
-    SampleType wHC = (static_cast<SampleType>(1.0) - xyX) * xyY;  // Top-left (X=0, Y=1)
-    SampleType wFL = xyX * xyY;  // Top-right (X=1, Y=1)
-    SampleType wSC = (static_cast<SampleType>(1.0) - xyX) * (static_cast<SampleType>(1.0) - xyY);  // Bottom-left (X=0, Y=0)
-    SampleType wSL = xyX * (static_cast<SampleType>(1.0) - xyY);  // Bottom-right (X=1, Y=0)
-
-    // Apply mute logic: zero out weights for muted processors
-    if (hcMute) wHC = static_cast<SampleType>(0.0);
-    if (scMute) wSC = static_cast<SampleType>(0.0);
-    if (slMute) wSL = static_cast<SampleType>(0.0);
-    if (flMute) wFL = static_cast<SampleType>(0.0);
-
-    // Renormalize weights to sum to 1.0 (avoid division by zero)
-    const SampleType weightSum = wHC + wSC + wSL + wFL;
-    const bool allProcessorsMuted = (weightSum <= static_cast<SampleType>(1e-10));
-
-    if (!allProcessorsMuted)
-    {
-        const SampleType normFactor = static_cast<SampleType>(1.0) / weightSum;
-        wHC *= normFactor;
-        wSC *= normFactor;
-        wSL *= normFactor;
-        wFL *= normFactor;
-    }
-    else
-    {
-        // All processors muted - weights stay zero (will skip processing and use dry signal)
-        wHC = wSC = wSL = wFL = static_cast<SampleType>(0.0);
-    }
+    // Peak followers are updated at control rate (advanceControlRate)
+    controlRate.inputPeakL = juce::jmax(controlRate.inputPeakL, inPkL);
+    controlRate.inputPeakR = juce::jmax(controlRate.inputPeakR, inPkR);
 
     // === EARLY EXIT: All Processors Muted ===
     // When all processors are muted, skip ALL processing including oversampling
@@ -1583,7 +2419,7 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
         {
             auto* out = buffer.getWritePointer(ch);
-            const auto* pristine = pristineInputBuffer.getReadPointer(ch);      // NO normalization
+            const auto* pristine = dryBuffer.getReadPointer(ch);                // NO normalization
             const auto* normalized = normalizedInputBuffer.getReadPointer(ch);  // HAS normalization
 
             for (int i = 0; i < numSamples; ++i)
@@ -1631,118 +2467,131 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
     // === ARCHITECTURE A: GLOBAL OVERSAMPLING + XY BLEND PROCESSING ===
     // v1.7.6: Both wet and dry MUST go through OS together for phase coherence
     // Problem: Calling oversampler twice (wet, then dry) causes phase misalignment
-    // Solution: 4-channel processing [wetL, wetR, dryL, dryR] through same OS call
-
-    // Store dry signal (pristine input - NO normalization, NO gains, NO processing)
-    // Mix at 0% should always give pristine input regardless of normalization setting
-    dryBuffer.makeCopyOf(pristineInputBuffer);
-
-    if (processingMode == 0)
-    {
-        // MODE 0: No oversampling needed
-        auto osBlock = osManager.upsampleBlock(buffer);
-        const int osNumSamples = static_cast<int>(osBlock.getNumSamples());
-        const int osNumChannels = static_cast<int>(osBlock.getNumChannels());
+    // Solution: each channel's [wet, dry] pair goes through the same OS call
 
-        if (!allProcessorsMuted)
-        {
-            SampleType* channelPointers[2];
-            for (int ch = 0; ch < osNumChannels; ++ch)
-                channelPointers[ch] = osBlock.getChannelPointer(static_cast<size_t>(ch));
+    // Dry signal (pristine input) was captured into dryBuffer before normalization
 
-            juce::AudioBuffer<SampleType> osBuffer(channelPointers, osNumChannels, osNumSamples);
-            processXYBlend(osBuffer, osManager.getOsSampleRate());
-        }
+    // === MONO DETECTION ===
+    // Identical channels (or a silent side in M/S) only need one side of the chain
+    updateMonoDetection(buffer, dryBuffer, processingMode != 0);
 
-        osManager.downsampleBlock(buffer, osBlock);
-        // Dry already pristine, no processing needed
-    }
-    else
+    if (processingMode == 0)
     {
-        // MODES 1/2: 4-channel synchronized OS processing for phase coherence
-        // Both dry and wet through SAME oversampler call
-
-        // Get 4-channel oversampler
-        juce::dsp::Oversampling<SampleType>* oversampler4Ch = nullptr;
-        if (std::is_same<SampleType, float>::value)
+        // MODE 0: No oversampling needed, process the base-rate buffer in place
+        if (!allProcessorsMuted && monoDetection.active == MonoMode::Off)
         {
-            oversampler4Ch = processingMode == 1
-                ? reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChBalancedFloat.get())
-                : reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChLinearFloat.get());
+            processXYBlend(buffer, osManager.getOsSampleRate());
         }
-        else
+        else if (!allProcessorsMuted)
         {
-            oversampler4Ch = processingMode == 1
-                ? reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChBalancedDouble.get())
-                : reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChLinearDouble.get());
-        }
+            // Mono: the left channel alone, then copied into the right (or the silent side kept)
+            SampleType* leftPointer[1] = { buffer.getWritePointer(0) };
+            juce::AudioBuffer<SampleType> leftBuffer(leftPointer, 1, numSamples);
+            processXYBlend(leftBuffer, osManager.getOsSampleRate());
 
-        // Create 4-channel buffer: [wetL, wetR, dryL, dryR]
-        auto& combined4Ch = (std::is_same<SampleType, float>::value)
-            ? reinterpret_cast<juce::AudioBuffer<SampleType>&>(combined4ChFloat)
-            : reinterpret_cast<juce::AudioBuffer<SampleType>&>(combined4ChDouble);
+            if (monoDetection.active == MonoMode::Identical)
+                juce::FloatVectorOperations::copy(buffer.getWritePointer(1), buffer.getReadPointer(0), numSamples);
+            else
+                juce::FloatVectorOperations::clear(buffer.getWritePointer(1), numSamples);
+        }
 
-        combined4Ch.setSize(4, numSamples, false, false, true);
-        for (int ch = 0; ch < 2; ++ch)
+        // Dry already pristine, no processing needed
+    }
+    else
+    {
+        // MODES 1/2: synchronized OS processing of wet and dry for phase coherence
+        // View [wet0..wetN-1, dry0..dryN-1] over the host buffer and dry scratch (no copies)
+        jassert(buffer.getNumChannels() >= numBusChannels);
+        SampleType* wetDryPointers[2 * maxChannels] = {};
+        for (int ch = 0; ch < numBusChannels; ++ch)
         {
-            combined4Ch.copyFrom(ch, 0, buffer, ch, 0, numSamples);           // Wet (0-1)
-            combined4Ch.copyFrom(ch + 2, 0, dryBuffer, ch, 0, numSamples);    // Dry (2-3)
+            wetDryPointers[ch] = buffer.getWritePointer(ch);                    // Wet
+            wetDryPointers[numBusChannels + ch] = dryBuffer.getWritePointer(ch);  // Dry
         }
 
-        // Upsample all 4 channels together (phase-coherent OS filtering)
-        juce::dsp::AudioBlock<SampleType> combined4ChBlock(combined4Ch);
-        auto osBlock4Ch = oversampler4Ch->processSamplesUp(combined4ChBlock);
-        const int osNumSamples = static_cast<int>(osBlock4Ch.getNumSamples());
-
-        // Process ONLY wet channels (0-1) with XY blend (has lookahead)
-        if (!allProcessorsMuted)
+        if (!routing.adaptiveOversampling && !adaptiveOs.idle)
         {
-            SampleType* wetPointers[2] = {
-                osBlock4Ch.getChannelPointer(0),
-                osBlock4Ch.getChannelPointer(1)
-            };
-            juce::AudioBuffer<SampleType> wetBuffer(wetPointers, 2, osNumSamples);
-            processXYBlend(wetBuffer, oversampler4Ch->getOversamplingFactor() * currentSampleRate);
+            processOversampledXY(wetDryPointers, numSamples, !allProcessorsMuted);
         }
-
-        // Delay dry channels (2-3) in OS domain to match wet's XY lookahead
-        const int osLookahead = lookaheadSamples;  // Already at OS rate
-        if (osLookahead > 0)
+        else
         {
-            for (int ch = 0; ch < 2; ++ch)
+            // === ADAPTIVE OVERSAMPLING ===
+            // The idle path is a gain and a delay matching the oversampled chain's latency
+            // exactly, so switching between them moves nothing and the reported latency holds.
+            // The XY processors' lookahead lines delay one OS sample less than the dry line.
+            const double osMultiplier = static_cast<double>(osManager.getOsMultiplier());
+            const double filterLatency = osManager.getExactLatencySamples();
+            adaptiveWetDelay.setDelay(filterLatency + (lookaheadSamples - 1 + xyPathAlignment) / osMultiplier);
+            adaptiveDryDelay.setDelay(filterLatency + (lookaheadSamples + xyPathAlignment) / osMultiplier);
+            adaptiveWetDelay.push(wetDryPointers, numSamples);
+            adaptiveDryDelay.push(wetDryPointers + numBusChannels, numSamples);
+
+            // The meters only follow L/R; the chain has to be linear on every channel
+            float wetPeak = juce::jmax(inPkL, inPkR);
+            for (int ch = 2; ch < numBusChannels; ++ch)
+                wetPeak = juce::jmax(wetPeak, static_cast<float>(buffer.getMagnitude(ch, 0, numSamples)));
+
+            double linearGain = 1.0;
+            const bool linear = isXYChainLinear<SampleType>(wetPeak, linearGain)
+                             && routing.adaptiveOversampling;
+            adaptiveOs.quietSamples = linear ? juce::jmin(adaptiveOs.quietSamples + numSamples, adaptiveOs.holdSamples) : 0;
+
+            auto idleOutput = [&](SampleType* const* destination)
             {
-                auto& delayState = dryDelayState[ch];
-                auto* dryData = osBlock4Ch.getChannelPointer(static_cast<size_t>(ch + 2));
-
-                for (int i = 0; i < osNumSamples; ++i)
+                for (int ch = 0; ch < numBusChannels; ++ch)
                 {
-                    const double delayed = delayState.delayBuffer[delayState.writePos];
-                    delayState.delayBuffer[delayState.writePos] = static_cast<double>(dryData[i]);
-                    delayState.writePos = (delayState.writePos + 1) % osLookahead;
-                    dryData[i] = static_cast<SampleType>(delayed);
+                    adaptiveWetDelay.read(ch, destination[ch], numSamples, linearGain);
+                    adaptiveDryDelay.read(ch, destination[numBusChannels + ch], numSamples);
                 }
-            }
-        }
+            };
 
-        // === DELTA MODE: Deferred to after limiters ===
-        // Delta will be computed after ALL processing (processors + limiters)
-        // For now, keep wet and dry separate through downsampling
-        // (Delta computation happens later at line ~1458)
+            // Linear ramp from one output to the other across the block, into the wet/dry channels
+            auto crossfade = [&](SampleType* const* outgoing, SampleType* const* incoming)
+            {
+                for (int ch = 0; ch < 2 * numBusChannels; ++ch)
+                {
+                    for (int i = 0; i < numSamples; ++i)
+                    {
+                        const auto fade = static_cast<SampleType>(i + 1) / static_cast<SampleType>(numSamples);
+                        wetDryPointers[ch][i] = outgoing[ch][i] + fade * (incoming[ch][i] - outgoing[ch][i]);
+                    }
+                }
+            };
 
-        // Downsample all 4 channels together (phase-coherent)
-        auto& tempBuffer2 = (std::is_same<SampleType, float>::value)
-            ? reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer2Float)
-            : reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer2Double);
+            auto idleBlock = scratch.getBuffer<SampleType>(ScratchArena::AdaptiveOversampling, 2 * numBusChannels, numSamples);
 
-        tempBuffer2.setSize(4, numSamples, false, false, true);
-        juce::dsp::AudioBlock<SampleType> downBlock(tempBuffer2);
-        oversampler4Ch->processSamplesDown(downBlock);
+            if (adaptiveOs.idle && linear)
+            {
+                idleOutput(wetDryPointers);
+            }
+            else if (adaptiveOs.idle)
+            {
+                // Engage: this block's input reaches the output a whole chain latency from now,
+                // so pre-rolling and fading in over this block finishes before it can saturate
+                preRollOversampledXY<SampleType>(numSamples, !allProcessorsMuted);
+                idleOutput(idleBlock.getArrayOfWritePointers());
+                processOversampledXY(wetDryPointers, numSamples, !allProcessorsMuted);
+                crossfade(idleBlock.getArrayOfWritePointers(), wetDryPointers);
+                adaptiveOs.idle = false;
+            }
+            else
+            {
+                processOversampledXY(wetDryPointers, numSamples, !allProcessorsMuted);
 
-        // Extract wet and dry (now perfectly phase-coherent)
-        for (int ch = 0; ch < 2; ++ch)
-        {
-            buffer.copyFrom(ch, 0, tempBuffer2, ch, 0, numSamples);         // Wet: 0-1
-            dryBuffer.copyFrom(ch, 0, tempBuffer2, ch + 2, 0, numSamples);  // Dry: 2-3
+                if (linear && adaptiveOs.quietSamples >= adaptiveOs.holdSamples)
+                {
+                    // Idle: fade from the oversampled output to the delay line over this block
+                    idleOutput(idleBlock.getArrayOfWritePointers());
+                    crossfade(wetDryPointers, idleBlock.getArrayOfWritePointers());
+                    adaptiveOs.idle = true;
+
+                    // Nothing is reducing gain while idle
+                    currentHardClipGR.store(0.0f);
+                    currentSoftClipGR.store(0.0f);
+                    currentSlowLimitGR.store(0.0f);
+                    currentFastLimitGR.store(0.0f);
+                }
+            }
         }
     }
 
@@ -1756,17 +2605,8 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         blockPeak = std::max(blockPeak, magnitude);
     }
 
-    // Update peak follower with fast attack, medium release
-    float currentPeak = meterPeak.load();
-    if (blockPeak > currentPeak)
-    {
-        meterPeak.store(blockPeak);  // Instant attack
-    }
-    else
-    {
-        // ~50ms release at 48kHz (adjust factor based on block size if needed)
-        meterPeak.store(currentPeak * 0.95f);
-    }
+    // Peak follower (fast attack, medium release) is updated at control rate
+    controlRate.transferPeak = juce::jmax(controlRate.transferPeak, blockPeak);
 
     // === PHASE DIFFERENCE LIMITER (DISABLED - Too audible) ===
     // Phase limiting on wet/dry deviation fundamentally changes nonlinear character
@@ -1803,79 +2643,8 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
                 wet[i] *= smoothedOutGain;
             }
         }
-        // Calculate weighted trim gain (same as applied in processXYBlend)
-        // Trims are applied per-processor, then blended, so effective trim = weighted sum
-        const SampleType hcTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(apvts.getRawParameterValue("HC_TRIM")->load()));
-        const SampleType scTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(apvts.getRawParameterValue("SC_TRIM")->load()));
-        const SampleType slTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(apvts.getRawParameterValue("SL_TRIM")->load()));
-        const SampleType flTrimGain = juce::Decibels::decibelsToGain(static_cast<SampleType>(apvts.getRawParameterValue("FL_TRIM")->load()));
-
-        // Get XY blend weights (same calculation as in processBlockInternal)
-        const SampleType xyX = static_cast<SampleType>(apvts.getRawParameterValue("XY_X_PARAM")->load());
-        const SampleType xyY = static_cast<SampleType>(apvts.getRawParameterValue("XY_Y_PARAM")->load());
-        SampleType wHC = (static_cast<SampleType>(1.0) - xyX) * xyY;  // Top-left
-        SampleType wFL = xyX * xyY;  // Top-right
-        SampleType wSC = (static_cast<SampleType>(1.0) - xyX) * (static_cast<SampleType>(1.0) - xyY);  // Bottom-left
-        SampleType wSL = xyX * (static_cast<SampleType>(1.0) - xyY);  // Bottom-right
-
-        // Apply mute and solo logic
-        // Mute takes priority over solo (like an analog console - if it's cut, it's cut)
-        const bool hcMuteParam = apvts.getRawParameterValue("HC_MUTE")->load() > 0.5f;
-        const bool scMuteParam = apvts.getRawParameterValue("SC_MUTE")->load() > 0.5f;
-        const bool slMuteParam = apvts.getRawParameterValue("SL_MUTE")->load() > 0.5f;
-        const bool flMuteParam = apvts.getRawParameterValue("FL_MUTE")->load() > 0.5f;
-
-        const bool hcSolo = apvts.getRawParameterValue("HC_SOLO")->load() > 0.5f;
-        const bool scSolo = apvts.getRawParameterValue("SC_SOLO")->load() > 0.5f;
-        const bool slSolo = apvts.getRawParameterValue("SL_SOLO")->load() > 0.5f;
-        const bool flSolo = apvts.getRawParameterValue("FL_SOLO")->load() > 0.5f;
-
-        // Solo logic: if any processor is soloed, mute all non-soloed processors
-        // BUT explicit mute always takes priority (mute overrides solo)
-        const bool anySolo = hcSolo || scSolo || slSolo || flSolo;
-        bool hcMute = hcMuteParam;  // Explicit mute always applies
-        bool scMute = scMuteParam;
-        bool slMute = slMuteParam;
-        bool flMute = flMuteParam;
-        if (anySolo)
-        {
-            // Only mute non-soloed processors that aren't already explicitly muted
-            if (!hcSolo && !hcMuteParam) hcMute = true;
-            if (!scSolo && !scMuteParam) scMute = true;
-            if (!slSolo && !slMuteParam) slMute = true;
-            if (!flSolo && !flMuteParam) flMute = true;
-        }
-
-        if (hcMute) wHC = static_cast<SampleType>(0.0);
-        if (scMute) wSC = static_cast<SampleType>(0.0);
-        if (slMute) wSL = static_cast<SampleType>(0.0);
-        if (flMute) wFL = static_cast<SampleType>(0.0);
-
-        // Renormalize weights
-        const SampleType weightSum = wHC + wSC + wSL + wFL;
-        const bool allProcessorsMuted = (weightSum <= static_cast<SampleType>(1e-10));
-        SampleType weightedTrimGain = static_cast<SampleType>(1.0);
-        if (!allProcessorsMuted)
-        {
-            const SampleType normFactor = static_cast<SampleType>(1.0) / weightSum;
-            wHC *= normFactor;
-            wSC *= normFactor;
-            wSL *= normFactor;
-            wFL *= normFactor;
-
-            // Calculate effective trim gain (weighted sum of trims)
-            weightedTrimGain = wHC * hcTrimGain + wSC * scTrimGain + wSL * slTrimGain + wFL * flTrimGain;
-
-            // Apply compensation if master comp is enabled (always enabled per comment at line 1290)
-            const bool masterCompEnabled = apvts.getRawParameterValue("MASTER_COMP")->load() > 0.5f;
-            if (masterCompEnabled)
-            {
-                // Master comp applies inverse trim per-processor, then blends
-                // Effective gain = weighted sum of (trim * 1/trim) = weighted sum of 1.0 = 1.0
-                // So no trim compensation needed if master comp is enabled
-                weightedTrimGain = static_cast<SampleType>(1.0);
-            }
-        }
+        // Effective trim of the wet path (weighted sum of per-processor trims, 1.0 with master comp)
+        const SampleType weightedTrimGain = derived.deltaTrimGain;
 
         // Apply gains to dry signal to match wet signal path:
         // 0. Normalization gain (wet has this, dry captured from pristineInputBuffer doesn't)
@@ -1926,7 +2695,7 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         // Apply inverse input gain to wet if master compensation enabled
         // This keeps output level constant as input gain (drive) is adjusted
         // Master Comp auto-enables when Delta Mode is ON, disabled when Delta Mode is OFF
-        const bool masterCompEnabled = apvts.getRawParameterValue("MASTER_COMP")->load() > 0.5f;
+        const bool masterCompEnabled = params.masterComp > 0.5f;
         if (masterCompEnabled && std::abs(inputGain - static_cast<SampleType>(1.0)) > static_cast<SampleType>(1e-6))
         {
             buffer.applyGain(static_cast<SampleType>(1.0) / inputGain);
@@ -1991,33 +2760,57 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         // Delta is now in buffer - limiters will be applied to delta below
     }
 
+    // Everything the output stages need from this block (PIPELINED_ENGINE runs them one
+    // host block later, after this stage has moved on)
+    handoff.routing = routing;
+    handoff.processingMode = osManager.getProcessingMode();
+    handoff.truePeakLookahead = advancedTPLLookaheadSamples;
+    handoff.outputCeilingDB = params.outputCeilingDB;
+    handoff.inputGain = static_cast<double>(inputGain);
+    handoff.pristinePeak = static_cast<double>(pristinePeak);
+    handoff.deltaMode = deltaMode;
+    handoff.agcEnabled = agcEnabled;
+    handoff.needsDry = needsDry;
+    handoff.displayActive = displayActive;
+    return true;
+}
+
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::processMicroBlockLimiters(juce::AudioBuffer<SampleType>& buffer,
+                                                            const MicroBlockHandoff& handoff)
+{
+    const int numSamples = buffer.getNumSamples();
+
+    // The limiters follow the engine this block went through, not one the input stage
+    // may have switched to since
+    outputLimiterMode = handoff.processingMode;
+    outputLimiterLookahead = handoff.truePeakLookahead;
+
     // === SIMPLIFIED OUTPUT LIMITING ===
     // Both limiters share the same ceiling
-    const bool overshootEnabled = apvts.getRawParameterValue("OVERSHOOT_ENABLE")->load() > 0.5f;
-    // True Peak Limiter is disabled in Zero Latency mode (requires lookahead)
-    const bool truePeakEnabled = (processingMode != 0) &&
-                                 (apvts.getRawParameterValue("TRUE_PEAK_ENABLE")->load() > 0.5f);
-    const SampleType outputCeilingDB = static_cast<SampleType>(apvts.getRawParameterValue("OUTPUT_CEILING")->load());
-    const bool overshootDeltaMode = apvts.getRawParameterValue("OVERSHOOT_DELTA_MODE")->load() > 0.5f;
-    const bool truePeakDeltaMode = apvts.getRawParameterValue("TRUE_PEAK_DELTA_MODE")->load() > 0.5f;
+    const bool overshootEnabled = handoff.routing.overshootEnabled;
+    const bool truePeakEnabled = handoff.routing.truePeakEnabled;
+    const SampleType outputCeilingDB = static_cast<SampleType>(handoff.outputCeilingDB);
+    const bool overshootDeltaMode = handoff.routing.overshootDeltaMode;
+    const bool truePeakDeltaMode = handoff.routing.truePeakDeltaMode;
 
     // Process limiters and capture their artifacts for main Delta mode
     // When main Delta mode is ON, we want to include limiter GR in the overall artifact signal
-    auto& limiterRefBuffer = tempBuffer4;
+    auto limiterRefBuffer = scratch.getBuffer<SampleType>(ScratchArena::LimiterReference, buffer.getNumChannels(), numSamples);
 
     // Save pre-limiter state if in main delta mode (to capture limiter artifacts)
-    if (deltaMode && (overshootEnabled || truePeakEnabled))
+    if (handoff.routing.captureLimiterReference)
     {
-        limiterRefBuffer.makeCopyOf(buffer);
+        ScratchArena::copy(limiterRefBuffer, buffer);
     }
 
     // Process limiters (independent delta modes are separate from main delta)
     // In delta mode, limiters process the delta signal itself
-    if (!deltaMode || (overshootEnabled || truePeakEnabled))
+    if (handoff.routing.runLimiters)
     {
         // === SPECIAL CASE: BOTH LIMITERS ENABLED ===
         // Use combined processing path to avoid double oversampling artifacts
-        if (overshootEnabled && truePeakEnabled && !overshootDeltaMode && !truePeakDeltaMode)
+        if (handoff.routing.combinedLimiters)
         {
             // Process both limiters in single oversample cycle: upsample → overshoot → truepeak → downsample
             processCombinedLimiters(buffer, outputCeilingDB, currentSampleRate);
@@ -2030,7 +2823,7 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
             {
                 if (overshootDeltaMode)
                 {
-                    limiterRefBuffer.makeCopyOf(buffer);
+                    ScratchArena::copy(limiterRefBuffer, buffer);
                     processOvershootSuppression(buffer, outputCeilingDB, currentSampleRate, true, &limiterRefBuffer);
 
                     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
@@ -2053,7 +2846,7 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
             {
                 if (truePeakDeltaMode)
                 {
-                    limiterRefBuffer.makeCopyOf(buffer);
+                    ScratchArena::copy(limiterRefBuffer, buffer);
                     processAdvancedTPL(buffer, outputCeilingDB, currentSampleRate, &limiterRefBuffer);
 
                     for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
@@ -2071,11 +2864,25 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
             }
         }
     }
+}
+
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::processMicroBlockOutput(juce::AudioBuffer<SampleType>& buffer,
+                                                          const juce::AudioBuffer<SampleType>& dryBuffer,
+                                                          const MicroBlockHandoff& handoff)
+{
+    const int numSamples = buffer.getNumSamples();
+    const bool deltaMode = handoff.deltaMode;
+    const bool agcEnabled = handoff.agcEnabled;
+    const bool needsDry = handoff.needsDry;
+    const bool displayActive = handoff.displayActive;
+    const auto inputGain = static_cast<SampleType>(handoff.inputGain);
+    const auto pristinePeak = static_cast<SampleType>(handoff.pristinePeak);
 
     // === CHANNEL MODE: M/S DECODING ===
     // Convert back from M/S to L/R for output (if M/S mode was used)
     // Must happen AFTER all processing but BEFORE output metering
-    if (channelMode == 1 && buffer.getNumChannels() >= 2)  // Mid-Side mode - decode back to L/R
+    if (handoff.routing.midSide && buffer.getNumChannels() >= 2)  // Mid-Side mode - decode back to L/R
     {
         // Decode M/S to L/R: Left = Mid + Side, Right = Mid - Side
         auto* mid = buffer.getWritePointer(0);
@@ -2092,9 +2899,10 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
 
     // === AGC (AUTO-GAIN COMPENSATION) ===
     // Match output loudness to input for honest A/B comparison
+    // (loudness estimates and the gain target are updated at control rate)
     if (agcEnabled && !deltaMode)
     {
-        // Measure output RMS
+        // Accumulate output energy
         SampleType outputSumSquares = static_cast<SampleType>(0.0);
         for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
         {
@@ -2102,26 +2910,11 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
             for (int i = 0; i < numSamples; ++i)
                 outputSumSquares += data[i] * data[i];
         }
-        float outputRms = std::sqrt(static_cast<float>(outputSumSquares) /
-                                    static_cast<float>(numSamples * buffer.getNumChannels()));
+        controlRate.agcOutputSumSquares += static_cast<double>(outputSumSquares);
+        controlRate.agcOutputCount += numSamples * buffer.getNumChannels();
 
-        // Smooth output RMS measurement
-        float prevOutputRms = agcOutputRMS.load();
-        agcOutputRMS.store(prevOutputRms * 0.9f + outputRms * 0.1f);
-
-        // Calculate and apply AGC gain
-        float smoothedInputRms = agcInputRMS.load();
-        float smoothedOutputRms = agcOutputRMS.load();
-
-        if (smoothedOutputRms > 0.0001f && smoothedInputRms > 0.0001f)
+        if (agcOutputRMS.load() > 0.0001f && agcInputRMS.load() > 0.0001f)
         {
-            float targetAgcGain = smoothedInputRms / smoothedOutputRms;
-            // Clamp AGC gain to reasonable range (±12dB)
-            targetAgcGain = juce::jlimit(0.25f, 4.0f, targetAgcGain);
-
-            // Update smoothed AGC gain
-            smoothedAgcGain.setTargetValue(targetAgcGain);
-
             // Apply smoothed AGC gain per-sample to prevent zipper noise
             for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
             {
@@ -2139,10 +2932,13 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         smoothedAgcGain.setCurrentAndTargetValue(1.0f);
         agcInputRMS.store(0.0f);
         agcOutputRMS.store(0.0f);
+        controlRate.agcInputSumSquares = controlRate.agcOutputSumSquares = 0.0;
+        controlRate.agcInputCount = controlRate.agcOutputCount = 0;
     }
 
     // === STEREO I/O METERS: MEASURE OUTPUT SAMPLE PEAK ===
     // Use sample peak for consistent metering with DAWs (true peak can read +3-4dB higher)
+    // Also feeds the final output peak meters (after delta, mix, output gain, protection)
     float outPkL = 0.0f;
     float outPkR = 0.0f;
     for (int i = 0; i < numSamples; ++i)
@@ -2157,34 +2953,14 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
     }
     if (buffer.getNumChannels() == 1) outPkR = outPkL;
 
-    updatePeak(outputPeakL, outPkL);
-    updatePeak(outputPeakR, outPkR);
+    controlRate.outputPeakL = juce::jmax(controlRate.outputPeakL, outPkL);
+    controlRate.outputPeakR = juce::jmax(controlRate.outputPeakR, outPkR);
 
     // === MAIN DELTA MODE: DELTA ALREADY COMPUTED ===
     // Delta was computed BEFORE limiters (above), then limiters were applied to delta
     // This ensures no timing issues from lookahead buffers
     // Delta now shows only processor artifacts (gain reduction/distortion), with limiters applied for safety
 
-    // === UPDATE OUTPUT PEAK METERS ===
-    // Capture the final output level after ALL processing (delta, mix, output gain, protection)
-    float peakL = 0.0f;
-    float peakR = 0.0f;
-    for (int i = 0; i < numSamples; ++i)
-    {
-        if (buffer.getNumChannels() > 0)
-        {
-            float absVal = static_cast<float>(std::abs(buffer.getReadPointer(0)[i]));
-            if (absVal > peakL) peakL = absVal;
-        }
-        if (buffer.getNumChannels() > 1)
-        {
-            float absVal = static_cast<float>(std::abs(buffer.getReadPointer(1)[i]));
-            if (absVal > peakR) peakR = absVal;
-        }
-    }
-    currentOutputPeakL.store(peakL);
-    currentOutputPeakR.store(peakR);
-
     // === FINAL VISUALIZATION DATA CAPTURE ===
     // CRITICAL: GR and waveform MUST be captured from SAME processed signal
     // This happens AFTER all processing: XY blend, mix, output gain, AND protection limiters
@@ -2193,19 +2969,29 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
     // Calculate final gain reduction (compares final output to normalized input)
     SampleType maxInputLevel = static_cast<SampleType>(0.0);
     SampleType maxOutputLevel = static_cast<SampleType>(0.0);
-    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+    if (needsDry)
     {
-        const auto* output = buffer.getReadPointer(ch);
-        const auto* input = dryBuffer.getReadPointer(ch);  // Dry = normalized input before processing
-
-        for (int i = 0; i < numSamples; ++i)
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
         {
-            // Input level = normalized input × input gain (what we fed to processors)
-            maxInputLevel = juce::jmax(maxInputLevel, std::abs(input[i] * inputGain));
-            // Output level = final output after ALL processing including True Peak
-            maxOutputLevel = juce::jmax(maxOutputLevel, std::abs(output[i]));
+            const auto* output = buffer.getReadPointer(ch);
+            const auto* input = dryBuffer.getReadPointer(ch);  // Dry = normalized input before processing
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                // Input level = normalized input × input gain (what we fed to processors)
+                maxInputLevel = juce::jmax(maxInputLevel, std::abs(input[i] * inputGain));
+                // Output level = final output after ALL processing including True Peak
+                maxOutputLevel = juce::jmax(maxOutputLevel, std::abs(output[i]));
+            }
         }
     }
+    else
+    {
+        // No dry copy this block: the dry would equal the pristine input, whose peak we kept
+        maxInputLevel = std::abs(pristinePeak * inputGain);
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+            maxOutputLevel = juce::jmax(maxOutputLevel, buffer.getMagnitude(ch, 0, numSamples));
+    }
 
     float grDB = 0.0f;
     if (maxInputLevel > static_cast<SampleType>(0.00001) && maxOutputLevel > static_cast<SampleType>(0.00001))
@@ -2217,13 +3003,19 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
 
     // === WAVEFORM + GR DISPLAY DATA CAPTURE ===
     // Write synchronized waveform and GR data to unified display buffer
-    // Only update display buffer when transport is playing (not frozen)
-    if (!displayBufferFrozen.load())
+    // Only update display buffer when an editor is open and transport is playing (not frozen)
+    if (displayActive)
     {
         int writePos = oscilloscopeWritePos.load();
         int oscSize = oscilloscopeSize.load();
         int displayWrite = displayWritePos.load();
 
+        // Per-processor block peaks (targets for the envelope followers below)
+        const float targetHC = currentHardClipPeak.load();
+        const float targetSC = currentSoftClipPeak.load();
+        const float targetSL = currentSlowLimitPeak.load();
+        const float targetFL = currentFastLimitPeak.load();
+
         for (int i = 0; i < numSamples; ++i)
         {
             // Get stereo samples (OUTPUT)
@@ -2310,11 +3102,6 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
 
             // Calculate envelope-smoothed per-processor outputs from block peaks
             // The block peaks give us the "target" - envelope followers smooth the transition
-            float targetHC = currentHardClipPeak.load();
-            float targetSC = currentSoftClipPeak.load();
-            float targetSL = currentSlowLimitPeak.load();
-            float targetFL = currentFastLimitPeak.load();
-
             processorEnvelope[0].processEnvelope(processorEnvelope[0].hardClipEnv, targetHC);
             processorEnvelope[0].processEnvelope(processorEnvelope[0].softClipEnv, targetSC);
             processorEnvelope[0].processEnvelope(processorEnvelope[0].slowLimitEnv, targetSL);
@@ -2364,14 +3151,17 @@ void QuadBlendDriveAudioProcessor::processBlockInternal(juce::AudioBuffer<Sample
         if (oscSize > 0)
             oscilloscopeWritePos.store(writePos);
         displayWritePos.store(displayWrite);
+        displaySamplesWritten.store(displaySamplesWritten.load() + static_cast<uint64_t>(numSamples), std::memory_order_release);
     }
+
+    advanceControlRate(numSamples);
 }
 
 //==============================================================================
 // Template DSP Processing Functions
 
 // Hard Clipping - Pure digital clipping at threshold (like Ableton Saturator Digital Clip mode)
-// v1.5.0 Pristine Essentials: Simple jlimit clipping, oversampling is the ONLY anti-aliasing
+// Anti-aliasing comes from oversampling, optionally helped by ADAA (CLIP_ANTIALIAS)
 // MODE 0: Direct processing (no oversampling, no lookahead)
 // MODE 1: 8× oversampling + 3ms lookahead
 // MODE 2: 16× oversampling + 3ms lookahead
@@ -2382,60 +3172,84 @@ void QuadBlendDriveAudioProcessor::processHardClip(juce::AudioBuffer<SampleType>
     // Mode 0: Buffer at base rate (1× multiplier)
     // Mode 1: Buffer at 8× OS rate
     // Mode 2: Buffer at 16× OS rate
+    using Kernel = void (QuadBlendDriveAudioProcessor::*)(juce::AudioBuffer<SampleType>&, double);
+    static constexpr Kernel kernels[2][3] = {
+        { &QuadBlendDriveAudioProcessor::hardClipKernel<SampleType, false, ADAA::Off>,
+          &QuadBlendDriveAudioProcessor::hardClipKernel<SampleType, false, ADAA::FirstOrder>,
+          &QuadBlendDriveAudioProcessor::hardClipKernel<SampleType, false, ADAA::SecondOrder> },
+        { &QuadBlendDriveAudioProcessor::hardClipKernel<SampleType, true, ADAA::Off>,
+          &QuadBlendDriveAudioProcessor::hardClipKernel<SampleType, true, ADAA::FirstOrder>,
+          &QuadBlendDriveAudioProcessor::hardClipKernel<SampleType, true, ADAA::SecondOrder> }
+    };
 
-    const int processingMode = osManager.getProcessingMode();
-    const double thresholdD = static_cast<double>(threshold);
+    const bool oversampled = osManager.getProcessingMode() != 0;
+    (this->*kernels[oversampled][routing.clipAntiAliasOrder])(buffer, static_cast<double>(threshold));
+}
 
-    // MODE 0: Zero Latency - Direct hard clip, NO lookahead
-    if (processingMode == 0)
-    {
-        for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), 2); ++ch)
-        {
-            auto* data = buffer.getWritePointer(ch);
-            for (int i = 0; i < buffer.getNumSamples(); ++i)
-            {
-                const double x = static_cast<double>(data[i]);
-                const double output = juce::jlimit(-thresholdD, thresholdD, x);
-                data[i] = static_cast<SampleType>(output);
-            }
-        }
-        return;
-    }
+template<typename SampleType, bool Oversampled, int AntiAlias>
+void QuadBlendDriveAudioProcessor::hardClipKernel(juce::AudioBuffer<SampleType>& buffer, double threshold)
+{
+    // ADAA shapes clip at +/-1, so run them on the threshold-normalised signal
+    const double invThreshold = 1.0 / threshold;
+    const int lookahead = xyPathRates[HardClipPath].lookahead;
 
-    // MODE 1 & 2: Balanced or Linear Phase - Process with lookahead (already at OS rate)
     const int numSamples = buffer.getNumSamples();
-    for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), 2); ++ch)
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
     {
         auto* data = buffer.getWritePointer(ch);
         auto& state = hardClipState[ch];
-        auto& lookaheadBuffer = state.lookaheadBuffer;
-        int& writePos = state.lookaheadWritePos;
 
-        for (int i = 0; i < numSamples; ++i)
+        // Sub-threshold fast path: if no sample this block outputs (inputs from one lookahead
+        // delay ago) is over the threshold, the clipper is a pure delay. The count is kept in
+        // every ADAA mode so it is valid the moment ADAA is switched off, and only holds
+        // against the threshold it was counted with: a lower one starts it over, since samples
+        // already in the lookahead line may sit between the two.
+        if (threshold < state.countedThreshold)
+            state.samplesSinceOver = 0;
+        state.countedThreshold = threshold;
+
+        if (blockPeak(data, numSamples) <= threshold)
+        {
+            state.samplesSinceOver = juce::jmin(state.samplesSinceOver + numSamples, 1 << 30);
+        }
+        else
         {
-            const double currentSample = static_cast<double>(data[i]);
+            int last = numSamples - 1;
+            while (std::abs(static_cast<double>(data[last])) <= threshold)
+                --last;
+            state.samplesSinceOver = numSamples - 1 - last;
+        }
 
-            // Store current sample in lookahead buffer
-            if (writePos >= 0 && writePos < static_cast<int>(lookaheadBuffer.size()))
-                lookaheadBuffer[writePos] = currentSample;
+        // Not with ADAA, which averages neighbouring samples even below the threshold
+        if constexpr (AntiAlias == ADAA::Off)
+        {
+            const int delay = Oversampled ? lookahead - 1 : 0;
+            if (state.samplesSinceOver >= numSamples + delay)
+            {
+                if constexpr (Oversampled)
+                    pushLookaheadBlock(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, data, numSamples);
+                continue;
+            }
+        }
 
-            // Read delayed sample for phase alignment
-            int readPos = (writePos + 1) % lookaheadSamples;
-            double delayedSample = currentSample;
-            if (readPos >= 0 && readPos < static_cast<int>(lookaheadBuffer.size()))
-                delayedSample = lookaheadBuffer[readPos];
+        for (int i = 0; i < numSamples; ++i)
+        {
+            double x = static_cast<double>(data[i]);
 
-            writePos = (writePos + 1) % lookaheadSamples;
+            // Modes 1/2: clip the sample from 3ms ago (phase alignment with the other paths)
+            if constexpr (Oversampled)
+                x = pushLookahead(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, x);
 
-            // Hard clip processing (osManager's oversampling handles anti-aliasing)
-            const double output = juce::jlimit(-thresholdD, thresholdD, delayedSample);
-            data[i] = static_cast<SampleType>(output);
+            if constexpr (AntiAlias == ADAA::Off)
+                data[i] = static_cast<SampleType>(juce::jlimit(-threshold, threshold, x));
+            else
+                data[i] = static_cast<SampleType>(ADAA::process<ADAA::HardClip, AntiAlias>(state.adaa, x * invThreshold) * threshold);
         }
     }
 }
 
 // Soft Clipping - Tanh saturation with dynamic drive
-// v1.5.0 Pristine Essentials: Simple tanh processing, oversampling is the ONLY anti-aliasing
+// Anti-aliasing comes from oversampling, optionally helped by ADAA (CLIP_ANTIALIAS)
 // MODE 0: Direct processing (no oversampling, no lookahead)
 // MODE 1: 8× oversampling + 3ms lookahead
 // MODE 2: 16× oversampling + 3ms lookahead
@@ -2445,69 +3259,65 @@ void QuadBlendDriveAudioProcessor::processSoftClip(juce::AudioBuffer<SampleType>
                                                      SampleType knee,
                                                      double sampleRate)
 {
-    // Get current processing mode from osManager
-    const int processingMode = osManager.getProcessingMode();
+    using Kernel = void (QuadBlendDriveAudioProcessor::*)(juce::AudioBuffer<SampleType>&, double, double, double);
+    static constexpr Kernel kernels[2][3] = {
+        { &QuadBlendDriveAudioProcessor::softClipKernel<SampleType, false, ADAA::Off>,
+          &QuadBlendDriveAudioProcessor::softClipKernel<SampleType, false, ADAA::FirstOrder>,
+          &QuadBlendDriveAudioProcessor::softClipKernel<SampleType, false, ADAA::SecondOrder> },
+        { &QuadBlendDriveAudioProcessor::softClipKernel<SampleType, true, ADAA::Off>,
+          &QuadBlendDriveAudioProcessor::softClipKernel<SampleType, true, ADAA::FirstOrder>,
+          &QuadBlendDriveAudioProcessor::softClipKernel<SampleType, true, ADAA::SecondOrder> }
+    };
+
+    const bool oversampled = osManager.getProcessingMode() != 0;
 
-    const double ceilingD = static_cast<double>(ceiling);
     const double color = static_cast<double>(knee);  // knee is already normalized to 0-1
-    const double drive = 1.0 + (color * 3.0);  // Drive: 1.0 to 4.0
+    if (color != softClipCoeffs.knee)
+    {
+        softClipCoeffs.knee = color;
+        softClipCoeffs.drive = 1.0 + (color * 3.0);  // Drive: 1.0 to 4.0
 
-    // Makeup gain: normalize so output reaches ceiling (matches Hard Clip/Limiters)
-    // tanh(drive) gives the max output, so divide by it to reach 1.0 at ceiling
-    const double makeup = 1.0 / std::tanh(drive);
+        // Makeup gain: normalize so output reaches ceiling (matches Hard Clip/Limiters)
+        // tanh(drive) gives the max output, so divide by it to reach 1.0 at ceiling
+        softClipCoeffs.makeup = 1.0 / std::tanh(softClipCoeffs.drive);
+    }
 
     // In oversampled modes, reduce makeup gain slightly to account for inter-sample peaks
     // The interpolation filter creates peaks ~0.5 dB higher than input samples
     // Hard Clip/Limiters handle this via peak detection, but Soft Clip needs compensation
-    const double oversampleCompensation = (processingMode == 0) ? 1.0 : 0.944;  // -0.5 dB
-    const double compensatedMakeup = makeup * oversampleCompensation;
-
-    // MODE 0: Zero Latency - Direct tanh, NO oversampling, NO lookahead
-    // Accept minimal aliasing as tradeoff for true zero latency
-    if (processingMode == 0)
-    {
-        for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), 2); ++ch)
-        {
-            auto* data = buffer.getWritePointer(ch);
+    const double oversampleCompensation = oversampled ? 0.944 : 1.0;  // -0.5 dB
+    const double compensatedMakeup = softClipCoeffs.makeup * oversampleCompensation;
 
-            for (int i = 0; i < buffer.getNumSamples(); ++i)
-            {
-                const double x = static_cast<double>(data[i]) / ceilingD;
-                const double output = std::tanh(x * drive) * compensatedMakeup;
-                data[i] = static_cast<SampleType>(output * ceilingD);
-            }
-        }
-        return;
-    }
+    (this->*kernels[oversampled][routing.clipAntiAliasOrder])(buffer, static_cast<double>(ceiling), softClipCoeffs.drive, compensatedMakeup);
+}
 
-    // MODE 1 & 2: Architecture A - Process with lookahead (buffer already at OS rate)
+template<typename SampleType, bool Oversampled, int AntiAlias>
+void QuadBlendDriveAudioProcessor::softClipKernel(juce::AudioBuffer<SampleType>& buffer,
+                                                    double ceiling, double drive, double makeup)
+{
+    // Mode 0 accepts minimal aliasing as the tradeoff for true zero latency
+    const int lookahead = xyPathRates[SoftClipPath].lookahead;
     const int numSamples = buffer.getNumSamples();
-    for (int ch = 0; ch < juce::jmin(buffer.getNumChannels(), 2); ++ch)
+    for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
     {
         auto* data = buffer.getWritePointer(ch);
-        auto& lookaheadBuffer = softClipState[ch].lookaheadBuffer;
-        int& writePos = softClipState[ch].lookaheadWritePos;
+        auto& state = softClipState[ch];
 
         for (int i = 0; i < numSamples; ++i)
         {
-            const double currentSample = static_cast<double>(data[i]);
-
-            // Store current sample in lookahead buffer
-            if (writePos >= 0 && writePos < static_cast<int>(lookaheadBuffer.size()))
-                lookaheadBuffer[writePos] = currentSample;
+            double sample = static_cast<double>(data[i]);
 
-            // Read delayed sample (3ms lookahead)
-            int readPos = (writePos + 1) % lookaheadSamples;
-            double delayedSample = currentSample;
-            if (readPos >= 0 && readPos < static_cast<int>(lookaheadBuffer.size()))
-                delayedSample = lookaheadBuffer[readPos];
+            // Modes 1/2: saturate the sample from 3ms ago
+            if constexpr (Oversampled)
+                sample = pushLookahead(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, sample);
 
-            writePos = (writePos + 1) % lookaheadSamples;
-
-            // Tanh processing (osManager's oversampling handles anti-aliasing)
-            const double x = delayedSample / ceilingD;
-            const double output = std::tanh(x * drive) * compensatedMakeup;
-            data[i] = static_cast<SampleType>(output * ceilingD);
+            const double x = sample / ceiling;
+            double output;
+            if constexpr (AntiAlias == ADAA::Off)
+                output = std::tanh(x * drive) * makeup;
+            else
+                output = ADAA::process<ADAA::Tanh, AntiAlias>(state.adaa, x * drive) * makeup;
+            data[i] = static_cast<SampleType>(output * ceiling);
         }
     }
 }
@@ -2516,7 +3326,7 @@ void QuadBlendDriveAudioProcessor::processSoftClip(juce::AudioBuffer<SampleType>
 // Fast release (20-40ms) for transients, slow release (200-600ms) for sustained material
 // Dynamically blended based on signal crest factor with exponential smoothing
 // MODE-AWARE: Zero Latency = no oversampling, Balanced/Linear Phase = 8x oversampling
-// CHANNEL LINKING: 0% = dual mono (independent), 100% = fully linked (max of both channels)
+// CHANNEL LINKING: 0% = dual mono (independent), 100% = fully linked (max of the linked channels)
 template<typename SampleType>
 void QuadBlendDriveAudioProcessor::processSlowLimit(juce::AudioBuffer<SampleType>& buffer,
                                                       SampleType threshold,
@@ -2524,265 +3334,332 @@ void QuadBlendDriveAudioProcessor::processSlowLimit(juce::AudioBuffer<SampleType
                                                       SampleType attackMs,
                                                       double sampleRate)
 {
-    // Get current processing mode from osManager
-    const int processingMode = osManager.getProcessingMode();
+    using Kernel = void (QuadBlendDriveAudioProcessor::*)(juce::AudioBuffer<SampleType>&, double);
+    static constexpr Kernel kernels[2][2] = {
+        { &QuadBlendDriveAudioProcessor::slowLimitKernel<SampleType, false, false>,
+          &QuadBlendDriveAudioProcessor::slowLimitKernel<SampleType, false, true> },
+        { &QuadBlendDriveAudioProcessor::slowLimitKernel<SampleType, true, false>,
+          &QuadBlendDriveAudioProcessor::slowLimitKernel<SampleType, true, true> }
+    };
+
+    const bool oversampled = osManager.getProcessingMode() != 0;
 
     // Get channel linking amount (0% = dual mono, 100% = fully linked)
-    const float channelLink = apvts.getRawParameterValue("CHANNEL_LINK")->load() / 100.0f;
-    const bool isStereo = buffer.getNumChannels() >= 2;
+    const float channelLink = params.channelLinkPercent / 100.0f;
+    const bool linked = buffer.getNumChannels() >= 2 && channelLink > 0.0f;
 
     // Fixed parameters for Slow Limiter
     const double attackMsD = static_cast<double>(attackMs);  // User-adjustable attack
     const double kneeDB = 3.0;                                // 3dB soft knee
 
-    // Base release time scales the adaptive release ranges
-    // Default: 100ms → fast(20-40ms), slow(300-800ms)
-    // User can scale overall release speed via LIMIT_REL parameter
-    const double baseReleaseScale = static_cast<double>(baseReleaseMs) / 100.0;  // Normalize to default
-    const double fastReleaseMinMs = 20.0 * baseReleaseScale;    // Fast release min (for transients)
-    const double fastReleaseMaxMs = 40.0 * baseReleaseScale;    // Fast release max
-    const double slowReleaseMinMs = 300.0 * baseReleaseScale;   // Slow release min (for sustained)
-    const double slowReleaseMaxMs = 800.0 * baseReleaseScale;   // Slow release max
-
     // Time constants for envelope followers
     // MODE 0: direct sample rate, MODE 1-2: oversampled rate
     const double safeSampleRate = (sampleRate > 0.0) ? sampleRate : 44100.0;
-    const double effectiveRate = (processingMode == 0) ? safeSampleRate : (safeSampleRate * 8.0);
+    const double effectiveRate = oversampled ? (safeSampleRate * 8.0) : safeSampleRate;
     const double rmsTimeMs = 50.0;                 // RMS averaging time
     const double peakTimeMs = 10.0;                // Peak tracking time
     const double crestSmoothTimeMs = 100.0;        // Crest factor smoothing time
+    const double thresholdD = static_cast<double>(threshold);
 
-    const double attackCoeff = std::exp(-1.0 / (attackMsD * 0.001 * effectiveRate));
-    const double rmsCoeff = std::exp(-1.0 / (rmsTimeMs * 0.001 * effectiveRate));
-    const double peakCoeff = std::exp(-1.0 / (peakTimeMs * 0.001 * effectiveRate));
-    const double crestSmoothCoeff = std::exp(-1.0 / (crestSmoothTimeMs * 0.001 * effectiveRate));
+    // LIMIT_CONTROL_RATE: one detector step per base-rate sample of this path
+    const int controlDecimation = (oversampled && routing.limiterControlRate)
+                                      ? juce::jmax(1, juce::roundToInt(sampleRate / currentSampleRate)) : 1;
 
-    const double thresholdD = static_cast<double>(threshold);
-    const double kneeStart = thresholdD * std::pow(10.0, -kneeDB / 20.0);  // 3dB below threshold
+    auto& coeffs = slowLimitCoeffs;
+    if (attackMsD != coeffs.attackMs || static_cast<double>(baseReleaseMs) != coeffs.baseReleaseMs
+        || thresholdD != coeffs.threshold || effectiveRate != coeffs.effectiveRate
+        || controlDecimation != coeffs.controlDecimation)
+    {
+        coeffs.attackMs = attackMsD;
+        coeffs.baseReleaseMs = static_cast<double>(baseReleaseMs);
+        coeffs.threshold = thresholdD;
+        coeffs.effectiveRate = effectiveRate;
+        coeffs.controlDecimation = controlDecimation;
+
+        // Envelope followers step at the detector rate; the gain smoother stays at the path rate
+        const double detectorRate = effectiveRate / controlDecimation;
+        coeffs.detectorRate = detectorRate;
+
+        // Base release time scales the adaptive release ranges
+        // Default: 100ms → fast(20-40ms), slow(300-800ms)
+        // User can scale overall release speed via LIMIT_REL parameter
+        const double baseReleaseScale = static_cast<double>(baseReleaseMs) / 100.0;  // Normalize to default
+        coeffs.fastReleaseMinMs = 20.0 * baseReleaseScale;    // Fast release min (for transients)
+        coeffs.fastReleaseMaxMs = 40.0 * baseReleaseScale;    // Fast release max
+        coeffs.slowReleaseMinMs = 300.0 * baseReleaseScale;   // Slow release min (for sustained)
+        coeffs.slowReleaseMaxMs = 800.0 * baseReleaseScale;   // Slow release max
+
+        coeffs.attackCoeff = std::exp(-1.0 / (attackMsD * 0.001 * detectorRate));
+        coeffs.rmsCoeff = std::exp(-1.0 / (rmsTimeMs * 0.001 * detectorRate));
+        coeffs.peakCoeff = std::exp(-1.0 / (peakTimeMs * 0.001 * detectorRate));
+        coeffs.crestSmoothCoeff = std::exp(-1.0 / (crestSmoothTimeMs * 0.001 * detectorRate));
+        coeffs.kneeStart = thresholdD * std::pow(10.0, -kneeDB / 20.0);  // 3dB below threshold
+
+        // Gain smoothing filter coefficient to prevent control signal aliasing
+        // Cutoff ~20kHz at the effective sample rate (prevents GR signal from aliasing)
+        const double gainSmoothCutoff = 20000.0;  // 20 kHz cutoff
+        coeffs.gainSmoothCoeff = std::exp(-2.0 * juce::MathConstants<double>::pi * gainSmoothCutoff / effectiveRate);
+    }
 
-    // Gain smoothing filter coefficient to prevent control signal aliasing
-    // Cutoff ~20kHz at the effective sample rate (prevents GR signal from aliasing)
-    const double gainSmoothCutoff = 20000.0;  // 20 kHz cutoff
-    const double gainSmoothCoeff = std::exp(-2.0 * juce::MathConstants<double>::pi * gainSmoothCutoff / effectiveRate);
+    (this->*kernels[oversampled][linked])(buffer, static_cast<double>(channelLink));
+}
 
-    // MODE 0: Zero Latency - NO oversampling, NO lookahead, direct processing
-    // With channel linking support: 0% = dual mono, 100% = fully linked (max of both)
-    if (processingMode == 0)
+template<typename SampleType, bool Oversampled, bool Linked>
+void QuadBlendDriveAudioProcessor::slowLimitKernel(juce::AudioBuffer<SampleType>& buffer, double channelLink)
+{
+    const auto& c = slowLimitCoeffs;
+    const int lookahead = xyPathRates[SlowLimitPath].lookahead;
+    const double thresholdD = c.threshold;
+    const double kneeRange = thresholdD - c.kneeStart;
+
+    // Envelope follower with crest-factor adaptive release; returns the channel's envelope
+    // (at control rate the inputs are the peak and mean square of one control period)
+    auto detect = [&c, thresholdD](SlowLimiterState& state, double inputAbs, double inputSquared)
     {
-        const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
-        const int numSamples = buffer.getNumSamples();
+        // Track RMS for crest factor calculation
+        state.rmsEnvelope = c.rmsCoeff * state.rmsEnvelope + (1.0 - c.rmsCoeff) * inputSquared;
+        const double rmsValue = std::sqrt(juce::jmax(1e-10, state.rmsEnvelope));
+
+        // Calculate and smooth crest factor
+        const double instantCrestFactor = inputAbs / rmsValue;
+        state.smoothedCrestFactor = c.crestSmoothCoeff * state.smoothedCrestFactor +
+                                    (1.0 - c.crestSmoothCoeff) * instantCrestFactor;
+
+        // Map crest factor to release time
+        const double crestNorm = juce::jlimit(0.0, 1.0, (state.smoothedCrestFactor - 1.0) / 9.0);
+        const double minRelease = c.fastReleaseMinMs + crestNorm * (c.slowReleaseMinMs - c.fastReleaseMinMs);
+        const double maxRelease = c.fastReleaseMaxMs + crestNorm * (c.slowReleaseMaxMs - c.fastReleaseMaxMs);
+
+        const double overAmount = juce::jmax(0.0, inputAbs - thresholdD);
+        const double adaptiveFactor = overAmount / (thresholdD + 1e-10);
+        const double adaptiveReleaseMs = juce::jlimit(minRelease, maxRelease,
+                                                     minRelease + (maxRelease - minRelease) * adaptiveFactor);
+
+        const double releaseCoeff = std::exp(-1.0 / (adaptiveReleaseMs * 0.001 * c.detectorRate));
+
+        // Attack/release envelope follower
+        if (inputAbs > state.envelope)
+            state.envelope = c.attackCoeff * state.envelope + (1.0 - c.attackCoeff) * inputAbs;
+        else
+            state.envelope = releaseCoeff * state.envelope + (1.0 - releaseCoeff) * inputAbs;
+
+        return state.envelope;
+    };
 
-        // Process sample-by-sample for proper channel linking
+    // detect() over a block that stays under the knee start: nothing is over the threshold,
+    // so the release is the crest-dependent minimum. Like detect() it follows the crest factor
+    // sample by sample, but only pays for the exp() on samples that actually release
+    auto detectBelowKnee = [&c](SlowLimiterState& state, const SampleType* data, int numSamples)
+    {
         for (int i = 0; i < numSamples; ++i)
         {
-            // === PHASE 1: Detect input levels on all channels ===
-            double channelInputEnv[2] = {0.0, 0.0};
-            double channelEnvelope[2] = {0.0, 0.0};
-
-            for (int ch = 0; ch < numChannels; ++ch)
-            {
-                auto* data = buffer.getWritePointer(ch);
-                double& envelope = slowLimiterState[ch].envelope;
-                double& rmsEnvelope = slowLimiterState[ch].rmsEnvelope;
-                double& smoothedCrestFactor = slowLimiterState[ch].smoothedCrestFactor;
+            const double x = static_cast<double>(data[i]);
+            const double inputAbs = std::abs(x);
 
-                const double currentSample = static_cast<double>(data[i]);
-                const double inputAbs = std::abs(currentSample);
-                channelInputEnv[ch] = inputAbs;
-
-                // Track RMS for crest factor calculation
-                const double inputSquared = currentSample * currentSample;
-                rmsEnvelope = rmsCoeff * rmsEnvelope + (1.0 - rmsCoeff) * inputSquared;
-                const double rmsValue = std::sqrt(juce::jmax(1e-10, rmsEnvelope));
-
-                // Calculate crest factor
-                const double instantCrestFactor = inputAbs / rmsValue;
-                smoothedCrestFactor = crestSmoothCoeff * smoothedCrestFactor +
-                                      (1.0 - crestSmoothCoeff) * instantCrestFactor;
-
-                // Map crest factor to release time
-                const double crestNorm = juce::jlimit(0.0, 1.0, (smoothedCrestFactor - 1.0) / 9.0);
-                const double minRelease = fastReleaseMinMs + crestNorm * (slowReleaseMinMs - fastReleaseMinMs);
-                const double maxRelease = fastReleaseMaxMs + crestNorm * (slowReleaseMaxMs - fastReleaseMaxMs);
-
-                const double overAmount = juce::jmax(0.0, inputAbs - thresholdD);
-                const double adaptiveFactor = overAmount / (thresholdD + 1e-10);
-                const double adaptiveReleaseMs = juce::jlimit(minRelease, maxRelease,
-                                                             minRelease + (maxRelease - minRelease) * adaptiveFactor);
-
-                const double releaseCoeff = std::exp(-1.0 / (adaptiveReleaseMs * 0.001 * effectiveRate));
-
-                // Attack/release envelope follower
-                if (inputAbs > envelope)
-                    envelope = attackCoeff * envelope + (1.0 - attackCoeff) * inputAbs;
-                else
-                    envelope = releaseCoeff * envelope + (1.0 - releaseCoeff) * inputAbs;
+            state.rmsEnvelope = c.rmsCoeff * state.rmsEnvelope + (1.0 - c.rmsCoeff) * (x * x);
+            const double rmsValue = std::sqrt(juce::jmax(1e-10, state.rmsEnvelope));
+            state.smoothedCrestFactor = c.crestSmoothCoeff * state.smoothedCrestFactor +
+                                        (1.0 - c.crestSmoothCoeff) * (inputAbs / rmsValue);
 
-                channelEnvelope[ch] = envelope;
+            if (inputAbs > state.envelope)
+            {
+                state.envelope = c.attackCoeff * state.envelope + (1.0 - c.attackCoeff) * inputAbs;
             }
-
-            // === PHASE 2: Compute linked envelope ===
-            // 0% link = dual mono (each channel uses own envelope)
-            // 100% link = fully linked (both channels use max envelope)
-            double maxEnvelope = 0.0;
-            if (isStereo && numChannels >= 2)
+            else
             {
-                maxEnvelope = juce::jmax(channelEnvelope[0], channelEnvelope[1]);
+                const double crestNorm = juce::jlimit(0.0, 1.0, (state.smoothedCrestFactor - 1.0) / 9.0);
+                const double releaseMs = c.fastReleaseMinMs + crestNorm * (c.slowReleaseMinMs - c.fastReleaseMinMs);
+                const double releaseCoeff = std::exp(-1.0 / (releaseMs * 0.001 * c.detectorRate));
+                state.envelope = releaseCoeff * state.envelope + (1.0 - releaseCoeff) * inputAbs;
             }
+        }
+    };
 
-            // === PHASE 3: Calculate and apply gain reduction ===
-            for (int ch = 0; ch < numChannels; ++ch)
-            {
-                auto* data = buffer.getWritePointer(ch);
-                const double currentSample = static_cast<double>(data[i]);
+    // Soft-knee gain computer (3dB knee below threshold)
+    auto gainFor = [&c, thresholdD, kneeRange](double detectionEnvelope)
+    {
+        if (detectionEnvelope <= c.kneeStart)
+            return 1.0;
 
-                // Blend between channel's own envelope and max envelope based on link amount
-                double detectionEnvelope = channelEnvelope[ch];
-                if (isStereo && channelLink > 0.0f)
-                {
-                    detectionEnvelope = channelEnvelope[ch] + static_cast<double>(channelLink) * (maxEnvelope - channelEnvelope[ch]);
-                }
+        if (detectionEnvelope < thresholdD && kneeRange > 1e-10)
+        {
+            // Guard against division by zero when knee is very small
+            const double kneePos = (detectionEnvelope - c.kneeStart) / kneeRange;
+            const double compressionAmount = kneePos * kneePos;
+            return 1.0 - compressionAmount * (1.0 - thresholdD / detectionEnvelope);
+        }
 
-                // Calculate gain reduction with soft knee
-                double targetGain = 1.0;
-                const double kneeRange = thresholdD - kneeStart;
-                if (detectionEnvelope <= kneeStart)
-                {
-                    targetGain = 1.0;
-                }
-                else if (detectionEnvelope < thresholdD && kneeRange > 1e-10)
-                {
-                    // Guard against division by zero when knee is very small
-                    const double kneePos = (detectionEnvelope - kneeStart) / kneeRange;
-                    const double compressionAmount = kneePos * kneePos;
-                    targetGain = 1.0 - compressionAmount * (1.0 - thresholdD / detectionEnvelope);
-                }
-                else if (detectionEnvelope > 1e-10)
-                {
-                    targetGain = thresholdD / detectionEnvelope;
-                }
+        if (detectionEnvelope > 1e-10)
+            return thresholdD / detectionEnvelope;
 
-                // Apply gain directly (MODE 0: no smoothing needed)
-                const double limitedSample = currentSample * targetGain;
-                data[i] = static_cast<SampleType>(limitedSample);
-            }
-        }
-        return;
-    }
+        return 1.0;
+    };
 
-    // MODE 1 & 2: Architecture A - Process with lookahead (buffer already at OS rate)
-    // With channel linking support: 0% = dual mono, 100% = fully linked (max of both)
+    // Mode 0 applies the gain directly to the current sample; modes 1/2 smooth it
+    // (prevents control signal aliasing) and apply it to the sample from 3ms ago
+    auto apply = [&c](SlowLimiterState& state, double currentSample, double delayedSample, double targetGain)
     {
-        const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
-        const int numSamples = buffer.getNumSamples();
+        juce::ignoreUnused(c, currentSample, delayedSample);
 
-        // Process sample-by-sample for proper channel linking
-        for (int i = 0; i < numSamples; ++i)
+        if constexpr (Oversampled)
         {
-            // === PHASE 1: Handle lookahead buffers and detect levels ===
-            double channelEnvelope[2] = {0.0, 0.0};
-            double delayedSamples[2] = {0.0, 0.0};
+            state.smoothedGain = c.gainSmoothCoeff * state.smoothedGain + (1.0 - c.gainSmoothCoeff) * targetGain;
+            return delayedSample * state.smoothedGain;
+        }
+        else
+        {
+            return currentSample * targetGain;
+        }
+    };
 
-            for (int ch = 0; ch < numChannels; ++ch)
-            {
-                auto* data = buffer.getWritePointer(ch);
-                double& envelope = slowLimiterState[ch].envelope;
-                double& rmsEnvelope = slowLimiterState[ch].rmsEnvelope;
-                double& smoothedCrestFactor = slowLimiterState[ch].smoothedCrestFactor;
-                auto& lookaheadBuffer = slowLimiterState[ch].lookaheadBuffer;
-                int& writePos = slowLimiterState[ch].lookaheadWritePos;
+    const int numSamples = buffer.getNumSamples();
 
-                const double currentSample = static_cast<double>(data[i]);
+    // Sub-threshold fast path: while the block and the envelope both stay under the knee start
+    // the gain is exactly 1 (the envelope only moves between the two), so once the smoothed
+    // gain has settled the limiter is a pure delay and only the detector has to run
+    auto belowKnee = [&c, numSamples](const SlowLimiterState& state, const SampleType* data)
+    {
+        return state.envelope <= c.kneeStart && blockPeak(data, numSamples) <= c.kneeStart
+            && (!Oversampled || state.smoothedGain > 1.0 - unityGainTolerance);
+    };
 
-                // Store current sample in lookahead buffer
-                if (writePos >= 0 && writePos < static_cast<int>(lookaheadBuffer.size()))
-                    lookaheadBuffer[writePos] = currentSample;
+    if constexpr (Oversampled)
+    {
+        // LIMIT_CONTROL_RATE: detect on the peak and mean square of each control period
+        // and ramp the gain across it
+        const int decimation = c.controlDecimation;
+        if (decimation > 1)
+        {
+            const int numChannels = buffer.getNumChannels();
+            SampleType* const* data = buffer.getArrayOfWritePointers();
+
+            bool unityGain = true;
+            for (int ch = 0; ch < numChannels; ++ch)
+                unityGain = unityGain && belowKnee(slowLimiterState[ch], data[ch]) && slowLimiterState[ch].controlGain == 1.0;
 
-                // Read delayed sample (3ms ago)
-                int readPos = (writePos + 1) % lookaheadSamples;
-                delayedSamples[ch] = currentSample;
-                if (readPos >= 0 && readPos < static_cast<int>(lookaheadBuffer.size()))
-                    delayedSamples[ch] = lookaheadBuffer[readPos];
+            for (int start = 0; start < numSamples; start += decimation)
+            {
+                const int length = juce::jmin(decimation, numSamples - start);
+                double peak[maxChannels] = {}, meanSquare[maxChannels] = {}, envelope[maxChannels] = {};
 
-                writePos = (writePos + 1) % lookaheadSamples;
+                for (int ch = 0; ch < numChannels; ++ch)
+                {
+                    for (int i = start; i < start + length; ++i)
+                    {
+                        const double x = static_cast<double>(data[ch][i]);
+                        peak[ch] = juce::jmax(peak[ch], std::abs(x));
+                        meanSquare[ch] += x * x;
+                    }
+                    meanSquare[ch] /= length;
+                    envelope[ch] = detect(slowLimiterState[ch], peak[ch], meanSquare[ch]);
+                }
 
-                const double inputAbs = std::abs(currentSample);
+                if (unityGain)
+                    continue;
 
-                // Track RMS for crest factor calculation
-                const double inputSquared = currentSample * currentSample;
-                rmsEnvelope = rmsCoeff * rmsEnvelope + (1.0 - rmsCoeff) * inputSquared;
-                const double rmsValue = std::sqrt(juce::jmax(1e-10, rmsEnvelope));
+                double groupMax[maxChannels];
+                linkedMaxima(envelope, numChannels, groupMax);
+                for (int ch = 0; ch < numChannels; ++ch)
+                {
+                    double detection = envelope[ch];
+                    if constexpr (Linked)
+                        if (const int group = linkGroup[static_cast<size_t>(ch)]; group >= 0)
+                            detection += channelLink * (groupMax[group] - detection);
 
-                // Calculate and smooth crest factor
-                const double instantCrestFactor = inputAbs / rmsValue;
-                smoothedCrestFactor = crestSmoothCoeff * smoothedCrestFactor +
-                                      (1.0 - crestSmoothCoeff) * instantCrestFactor;
+                    applyControlRateGain(slowLimiterState[ch], data[ch] + start, length, lookahead,
+                                         c.gainSmoothCoeff, gainFor(detection));
+                }
+            }
 
-                // Map crest factor to release time
-                const double crestNorm = juce::jlimit(0.0, 1.0, (smoothedCrestFactor - 1.0) / 9.0);
-                const double minRelease = fastReleaseMinMs + crestNorm * (slowReleaseMinMs - fastReleaseMinMs);
-                const double maxRelease = fastReleaseMaxMs + crestNorm * (slowReleaseMaxMs - fastReleaseMaxMs);
+            if (unityGain)
+            {
+                for (int ch = 0; ch < numChannels; ++ch)
+                    pushLookaheadBlock(slowLimiterState[ch].lookaheadBuffer, slowLimiterState[ch].lookaheadWritePos,
+                                       lookahead, data[ch], numSamples);
+            }
+            return;
+        }
+    }
 
-                const double overAmount = juce::jmax(0.0, inputAbs - thresholdD);
-                const double adaptiveFactor = overAmount / (thresholdD + 1e-10);
-                const double adaptiveReleaseMs = juce::jlimit(minRelease, maxRelease,
-                                                             minRelease + (maxRelease - minRelease) * adaptiveFactor);
+    if constexpr (Linked)
+    {
+        // Linked: every channel's envelope is needed before any gain can be computed
+        const int numChannels = buffer.getNumChannels();
+        SampleType* const* data = buffer.getArrayOfWritePointers();
 
-                const double releaseCoeff = std::exp(-1.0 / (adaptiveReleaseMs * 0.001 * effectiveRate));
+        bool allBelowKnee = true;
+        for (int ch = 0; ch < numChannels; ++ch)
+            allBelowKnee = allBelowKnee && belowKnee(slowLimiterState[ch], data[ch]);
 
-                // Attack/release envelope follower
-                if (inputAbs > envelope)
-                    envelope = attackCoeff * envelope + (1.0 - attackCoeff) * inputAbs;
-                else
-                    envelope = releaseCoeff * envelope + (1.0 - releaseCoeff) * inputAbs;
+        if (allBelowKnee)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+            {
+                auto& state = slowLimiterState[ch];
+                detectBelowKnee(state, data[ch], numSamples);
 
-                channelEnvelope[ch] = envelope;
+                if constexpr (Oversampled)
+                    pushLookaheadBlock(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, data[ch], numSamples);
             }
+            return;
+        }
 
-            // === PHASE 2: Compute linked envelope ===
-            double maxEnvelope = 0.0;
-            if (isStereo && numChannels >= 2)
+        for (int i = 0; i < numSamples; ++i)
+        {
+            double current[maxChannels], delayed[maxChannels], envelope[maxChannels];
+            for (int ch = 0; ch < numChannels; ++ch)
             {
-                maxEnvelope = juce::jmax(channelEnvelope[0], channelEnvelope[1]);
+                auto& state = slowLimiterState[ch];
+                current[ch] = static_cast<double>(data[ch][i]);
+                delayed[ch] = current[ch];
+                if constexpr (Oversampled)
+                    delayed[ch] = pushLookahead(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, current[ch]);
+
+                envelope[ch] = detect(state, std::abs(current[ch]), current[ch] * current[ch]);
             }
 
-            // === PHASE 3: Calculate and apply gain reduction ===
+            // Blend between each channel's own envelope and the loudest one of its link group
+            // based on link amount: 0% link = dual mono, 100% link = the group moves as one
+            double groupMax[maxChannels];
+            linkedMaxima(envelope, numChannels, groupMax);
             for (int ch = 0; ch < numChannels; ++ch)
             {
-                auto* data = buffer.getWritePointer(ch);
-                double& smoothedGain = slowLimiterState[ch].smoothedGain;
+                const int group = linkGroup[static_cast<size_t>(ch)];
+                const double detection = group >= 0
+                                       ? envelope[ch] + channelLink * (groupMax[group] - envelope[ch])
+                                       : envelope[ch];
+                data[ch][i] = static_cast<SampleType>(apply(slowLimiterState[ch], current[ch], delayed[ch], gainFor(detection)));
+            }
+        }
+    }
+    else
+    {
+        juce::ignoreUnused(channelLink);
 
-                // Blend between channel's own envelope and max envelope based on link amount
-                double detectionEnvelope = channelEnvelope[ch];
-                if (isStereo && channelLink > 0.0f)
-                {
-                    detectionEnvelope = channelEnvelope[ch] + static_cast<double>(channelLink) * (maxEnvelope - channelEnvelope[ch]);
-                }
+        // Unlinked (dual mono or single channel): channels are independent
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer(ch);
+            auto& state = slowLimiterState[ch];
 
-                // Calculate gain reduction with soft knee
-                double targetGain = 1.0;
-                const double kneeRange = thresholdD - kneeStart;
-                if (detectionEnvelope <= kneeStart)
-                {
-                    targetGain = 1.0;
-                }
-                else if (detectionEnvelope < thresholdD && kneeRange > 1e-10)
-                {
-                    // Guard against division by zero when knee is very small
-                    const double kneePos = (detectionEnvelope - kneeStart) / kneeRange;
-                    const double compressionAmount = kneePos * kneePos;
-                    targetGain = 1.0 - compressionAmount * (1.0 - thresholdD / detectionEnvelope);
-                }
-                else if (detectionEnvelope > 1e-10)
-                {
-                    targetGain = thresholdD / detectionEnvelope;
-                }
+            if (belowKnee(state, data))
+            {
+                detectBelowKnee(state, data, numSamples);
 
-                // Apply gain smoothing (prevents control signal aliasing with oversampling)
-                smoothedGain = gainSmoothCoeff * smoothedGain + (1.0 - gainSmoothCoeff) * targetGain;
+                if constexpr (Oversampled)
+                    pushLookaheadBlock(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, data, numSamples);
+                continue;
+            }
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const double currentSample = static_cast<double>(data[i]);
+                double delayedSample = currentSample;
+                if constexpr (Oversampled)
+                    delayedSample = pushLookahead(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, currentSample);
 
-                const double limitedSample = delayedSamples[ch] * smoothedGain;
-                data[i] = static_cast<SampleType>(limitedSample);
+                const double envelope = detect(state, std::abs(currentSample), currentSample * currentSample);
+                data[i] = static_cast<SampleType>(apply(state, currentSample, delayedSample, gainFor(envelope)));
             }
         }
     }
@@ -2791,7 +3668,7 @@ void QuadBlendDriveAudioProcessor::processSlowLimit(juce::AudioBuffer<SampleType
 // Fast Limiting - Hard knee limiting with user-adjustable release
 // Attack: 0.01-10ms, Release: 5-100ms, Hard knee, Lookahead: 3ms
 // MODE-AWARE: Zero Latency = no oversampling, Balanced/Linear Phase = 8x oversampling
-// CHANNEL LINKING: 0% = dual mono (independent), 100% = fully linked (max of both channels)
+// CHANNEL LINKING: 0% = dual mono (independent), 100% = fully linked (max of the linked channels)
 template<typename SampleType>
 void QuadBlendDriveAudioProcessor::processFastLimit(juce::AudioBuffer<SampleType>& buffer,
                                                       SampleType threshold,
@@ -2799,173 +3676,244 @@ void QuadBlendDriveAudioProcessor::processFastLimit(juce::AudioBuffer<SampleType
                                                       SampleType releaseMs,
                                                       double sampleRate)
 {
-    // Get current processing mode from osManager
-    const int processingMode = osManager.getProcessingMode();
+    using Kernel = void (QuadBlendDriveAudioProcessor::*)(juce::AudioBuffer<SampleType>&, double, double);
+    static constexpr Kernel kernels[2][2] = {
+        { &QuadBlendDriveAudioProcessor::fastLimitKernel<SampleType, false, false>,
+          &QuadBlendDriveAudioProcessor::fastLimitKernel<SampleType, false, true> },
+        { &QuadBlendDriveAudioProcessor::fastLimitKernel<SampleType, true, false>,
+          &QuadBlendDriveAudioProcessor::fastLimitKernel<SampleType, true, true> }
+    };
+
+    const bool oversampled = osManager.getProcessingMode() != 0;
 
     // Get channel linking amount (0% = dual mono, 100% = fully linked)
-    const float channelLink = apvts.getRawParameterValue("CHANNEL_LINK")->load() / 100.0f;
-    const bool isStereo = buffer.getNumChannels() >= 2;
+    const float channelLink = params.channelLinkPercent / 100.0f;
+    const bool linked = buffer.getNumChannels() >= 2 && channelLink > 0.0f;
 
     // User-adjustable parameters for Fast Limiter
     const double attackMsD = static_cast<double>(attackMs);
     const double releaseMsD = static_cast<double>(releaseMs);
 
     // MODE 0: direct sample rate, MODE 1-2: oversampled rate
+    // A path running below the common OS rate sees proportionally fewer samples
     const double safeSampleRate = (currentSampleRate > 0.0) ? currentSampleRate : 44100.0;
-    const double effectiveRate = (processingMode == 0) ? safeSampleRate : (safeSampleRate * 8.0);
+    const double pathRateScale = sampleRate / osManager.getOsSampleRate();
+    const double effectiveRate = (oversampled ? (safeSampleRate * 8.0) : safeSampleRate) * pathRateScale;
 
-    const double attackCoeff = std::exp(-1.0 / (attackMsD * 0.001 * effectiveRate));
-    const double releaseCoeff = std::exp(-1.0 / (releaseMsD * 0.001 * effectiveRate));
-    const double thresholdD = static_cast<double>(threshold);
+    // LIMIT_CONTROL_RATE: one detector step per base-rate sample of this path
+    const int controlDecimation = (oversampled && routing.limiterControlRate)
+                                      ? juce::jmax(1, juce::roundToInt(sampleRate / safeSampleRate)) : 1;
+
+    auto& coeffs = fastLimitCoeffs;
+    if (attackMsD != coeffs.attackMs || releaseMsD != coeffs.releaseMs || effectiveRate != coeffs.effectiveRate
+        || controlDecimation != coeffs.controlDecimation)
+    {
+        coeffs.attackMs = attackMsD;
+        coeffs.releaseMs = releaseMsD;
+        coeffs.effectiveRate = effectiveRate;
+        coeffs.controlDecimation = controlDecimation;
+
+        // The envelope steps at the detector rate; the gain smoother stays at the path rate
+        const double detectorRate = effectiveRate / controlDecimation;
+        coeffs.attackCoeff = std::exp(-1.0 / (attackMsD * 0.001 * detectorRate));
+        coeffs.releaseCoeff = std::exp(-1.0 / (releaseMsD * 0.001 * detectorRate));
+
+        // Gain smoothing filter coefficient to prevent control signal aliasing
+        const double gainSmoothCutoff = 20000.0;
+        coeffs.gainSmoothCoeff = std::exp(-2.0 * juce::MathConstants<double>::pi * gainSmoothCutoff / effectiveRate);
+    }
+
+    (this->*kernels[oversampled][linked])(buffer, static_cast<double>(threshold), static_cast<double>(channelLink));
+}
+
+template<typename SampleType, bool Oversampled, bool Linked>
+void QuadBlendDriveAudioProcessor::fastLimitKernel(juce::AudioBuffer<SampleType>& buffer,
+                                                     double threshold, double channelLink)
+{
+    const auto& c = fastLimitCoeffs;
+    const int lookahead = xyPathRates[FastLimitPath].lookahead;
+
+    // Envelope follower with attack/release
+    auto detect = [&c](FastLimiterState& state, double inputAbs)
+    {
+        if (inputAbs > state.envelope)
+            state.envelope = c.attackCoeff * state.envelope + (1.0 - c.attackCoeff) * inputAbs;
+        else
+            state.envelope = c.releaseCoeff * state.envelope + (1.0 - c.releaseCoeff) * inputAbs;
+
+        state.envelope = juce::jlimit(0.0, 10.0, state.envelope);
+        return state.envelope;
+    };
 
-    // Gain smoothing filter coefficient to prevent control signal aliasing
-    const double gainSmoothCutoff = 20000.0;
-    const double gainSmoothCoeff = std::exp(-2.0 * juce::MathConstants<double>::pi * gainSmoothCutoff / effectiveRate);
+    // Hard knee gain computer
+    auto gainFor = [threshold](double detectionEnvelope)
+    {
+        double targetGain = 1.0;
+        if (detectionEnvelope > threshold)
+            targetGain = threshold / detectionEnvelope;
+        return juce::jlimit(0.01, 1.0, targetGain);
+    };
 
-    // MODE 0: Zero Latency - NO oversampling, NO lookahead, direct processing
-    // With channel linking support
-    if (processingMode == 0)
+    // Mode 0 applies the gain directly to the current sample; modes 1/2 smooth it
+    // and apply it to the sample from 3ms ago
+    auto apply = [&c](FastLimiterState& state, double currentSample, double delayedSample, double targetGain)
     {
-        const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
-        const int numSamples = buffer.getNumSamples();
+        juce::ignoreUnused(c, currentSample, delayedSample);
 
-        for (int i = 0; i < numSamples; ++i)
+        if constexpr (Oversampled)
         {
-            // === PHASE 1: Detect envelope on all channels ===
-            double channelEnvelope[2] = {0.0, 0.0};
-
-            for (int ch = 0; ch < numChannels; ++ch)
-            {
-                auto* data = buffer.getWritePointer(ch);
-                double& envelope = fastLimiterState[ch].envelope;
-
-                const double currentSample = static_cast<double>(data[i]);
-                const double inputAbs = std::abs(currentSample);
+            state.smoothedGain = c.gainSmoothCoeff * state.smoothedGain + (1.0 - c.gainSmoothCoeff) * targetGain;
+            return delayedSample * state.smoothedGain;
+        }
+        else
+        {
+            return currentSample * targetGain;
+        }
+    };
 
-                // Envelope follower with attack/release
-                if (inputAbs > envelope)
-                    envelope = attackCoeff * envelope + (1.0 - attackCoeff) * inputAbs;
-                else
-                    envelope = releaseCoeff * envelope + (1.0 - releaseCoeff) * inputAbs;
+    const int numSamples = buffer.getNumSamples();
 
-                envelope = juce::jlimit(0.0, 10.0, envelope);
-                channelEnvelope[ch] = envelope;
-            }
+    // Sub-threshold fast path: block and envelope under the threshold mean unity gain
+    // throughout, so once the smoothed gain has settled only the envelope has to run
+    auto belowThreshold = [threshold, numSamples](const FastLimiterState& state, const SampleType* data)
+    {
+        return state.envelope <= threshold && blockPeak(data, numSamples) <= threshold
+            && (!Oversampled || state.smoothedGain > 1.0 - unityGainTolerance);
+    };
 
-            // === PHASE 2: Compute linked envelope ===
-            double maxEnvelope = 0.0;
-            if (isStereo && numChannels >= 2)
-            {
-                maxEnvelope = juce::jmax(channelEnvelope[0], channelEnvelope[1]);
-            }
+    if constexpr (Oversampled)
+    {
+        // LIMIT_CONTROL_RATE: detect on the peak of each control period and ramp the gain across it
+        const int decimation = c.controlDecimation;
+        if (decimation > 1)
+        {
+            const int numChannels = buffer.getNumChannels();
+            SampleType* const* data = buffer.getArrayOfWritePointers();
 
-            // === PHASE 3: Calculate and apply gain reduction ===
+            bool unityGain = true;
             for (int ch = 0; ch < numChannels; ++ch)
+                unityGain = unityGain && belowThreshold(fastLimiterState[ch], data[ch]) && fastLimiterState[ch].controlGain == 1.0;
+
+            for (int start = 0; start < numSamples; start += decimation)
             {
-                auto* data = buffer.getWritePointer(ch);
-                const double currentSample = static_cast<double>(data[i]);
+                const int length = juce::jmin(decimation, numSamples - start);
+                double envelope[maxChannels] = {};
 
-                // Blend between channel's own envelope and max envelope
-                double detectionEnvelope = channelEnvelope[ch];
-                if (isStereo && channelLink > 0.0f)
+                for (int ch = 0; ch < numChannels; ++ch)
                 {
-                    detectionEnvelope = channelEnvelope[ch] + static_cast<double>(channelLink) * (maxEnvelope - channelEnvelope[ch]);
+                    double peak = 0.0;
+                    for (int i = start; i < start + length; ++i)
+                        peak = juce::jmax(peak, std::abs(static_cast<double>(data[ch][i])));
+                    envelope[ch] = detect(fastLimiterState[ch], peak);
                 }
 
-                // Calculate gain reduction - hard knee
-                double targetGain = 1.0;
-                if (detectionEnvelope > thresholdD)
+                if (unityGain)
+                    continue;
+
+                double groupMax[maxChannels];
+                linkedMaxima(envelope, numChannels, groupMax);
+                for (int ch = 0; ch < numChannels; ++ch)
                 {
-                    targetGain = thresholdD / detectionEnvelope;
+                    double detection = envelope[ch];
+                    if constexpr (Linked)
+                        if (const int group = linkGroup[static_cast<size_t>(ch)]; group >= 0)
+                            detection += channelLink * (groupMax[group] - detection);
+
+                    applyControlRateGain(fastLimiterState[ch], data[ch] + start, length, lookahead,
+                                         c.gainSmoothCoeff, gainFor(detection));
                 }
-                targetGain = juce::jlimit(0.01, 1.0, targetGain);
+            }
 
-                // Apply gain directly (MODE 0: no smoothing needed)
-                const double limitedSample = currentSample * targetGain;
-                data[i] = static_cast<SampleType>(limitedSample);
+            if (unityGain)
+            {
+                for (int ch = 0; ch < numChannels; ++ch)
+                    pushLookaheadBlock(fastLimiterState[ch].lookaheadBuffer, fastLimiterState[ch].lookaheadWritePos,
+                                       lookahead, data[ch], numSamples);
             }
+            return;
         }
-        return;
     }
 
-    // MODE 1 & 2: Architecture A - Process with lookahead (buffer already at OS rate)
-    // With channel linking support
+    if constexpr (Linked)
     {
-        const int numChannels = juce::jmin(buffer.getNumChannels(), 2);
-        const int numSamples = buffer.getNumSamples();
+        // Linked: every channel's envelope is needed before any gain can be computed
+        const int numChannels = buffer.getNumChannels();
+        SampleType* const* data = buffer.getArrayOfWritePointers();
 
-        for (int i = 0; i < numSamples; ++i)
-        {
-            // === PHASE 1: Handle lookahead and detect envelope ===
-            double channelEnvelope[2] = {0.0, 0.0};
-            double delayedSamples[2] = {0.0, 0.0};
+        bool allBelowThreshold = true;
+        for (int ch = 0; ch < numChannels; ++ch)
+            allBelowThreshold = allBelowThreshold && belowThreshold(fastLimiterState[ch], data[ch]);
 
+        if (allBelowThreshold)
+        {
             for (int ch = 0; ch < numChannels; ++ch)
             {
-                auto* data = buffer.getWritePointer(ch);
-                double& envelope = fastLimiterState[ch].envelope;
-                auto& lookaheadBuffer = fastLimiterState[ch].lookaheadBuffer;
-                int& writePos = fastLimiterState[ch].lookaheadWritePos;
-
-                const double currentSample = static_cast<double>(data[i]);
-
-                // Store current sample in lookahead buffer
-                if (writePos >= 0 && writePos < static_cast<int>(lookaheadBuffer.size()))
-                    lookaheadBuffer[writePos] = currentSample;
-
-                // Read delayed sample (3ms ago)
-                int readPos = (writePos + 1) % lookaheadSamples;
-                delayedSamples[ch] = currentSample;
-                if (readPos >= 0 && readPos < static_cast<int>(lookaheadBuffer.size()))
-                    delayedSamples[ch] = lookaheadBuffer[readPos];
-
-                writePos = (writePos + 1) % lookaheadSamples;
-
-                const double inputAbs = std::abs(currentSample);
-
-                // Envelope follower
-                if (inputAbs > envelope)
-                    envelope = attackCoeff * envelope + (1.0 - attackCoeff) * inputAbs;
-                else
-                    envelope = releaseCoeff * envelope + (1.0 - releaseCoeff) * inputAbs;
+                auto& state = fastLimiterState[ch];
+                for (int i = 0; i < numSamples; ++i)
+                    detect(state, std::abs(static_cast<double>(data[ch][i])));
 
-                envelope = juce::jlimit(0.0, 10.0, envelope);
-                channelEnvelope[ch] = envelope;
+                if constexpr (Oversampled)
+                    pushLookaheadBlock(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, data[ch], numSamples);
             }
+            return;
+        }
 
-            // === PHASE 2: Compute linked envelope ===
-            double maxEnvelope = 0.0;
-            if (isStereo && numChannels >= 2)
+        for (int i = 0; i < numSamples; ++i)
+        {
+            double current[maxChannels], delayed[maxChannels], envelope[maxChannels];
+            for (int ch = 0; ch < numChannels; ++ch)
             {
-                maxEnvelope = juce::jmax(channelEnvelope[0], channelEnvelope[1]);
+                auto& state = fastLimiterState[ch];
+                current[ch] = static_cast<double>(data[ch][i]);
+                delayed[ch] = current[ch];
+                if constexpr (Oversampled)
+                    delayed[ch] = pushLookahead(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, current[ch]);
+
+                envelope[ch] = detect(state, std::abs(current[ch]));
             }
 
-            // === PHASE 3: Calculate and apply gain reduction ===
+            // Blend between each channel's own envelope and the loudest linked one
+            double groupMax[maxChannels];
+            linkedMaxima(envelope, numChannels, groupMax);
             for (int ch = 0; ch < numChannels; ++ch)
             {
-                auto* data = buffer.getWritePointer(ch);
-                double& smoothedGain = fastLimiterState[ch].smoothedGain;
+                const int group = linkGroup[static_cast<size_t>(ch)];
+                const double detection = group >= 0
+                                       ? envelope[ch] + channelLink * (groupMax[group] - envelope[ch])
+                                       : envelope[ch];
+                data[ch][i] = static_cast<SampleType>(apply(fastLimiterState[ch], current[ch], delayed[ch], gainFor(detection)));
+            }
+        }
+    }
+    else
+    {
+        juce::ignoreUnused(channelLink);
 
-                // Blend between channel's own envelope and max envelope
-                double detectionEnvelope = channelEnvelope[ch];
-                if (isStereo && channelLink > 0.0f)
-                {
-                    detectionEnvelope = channelEnvelope[ch] + static_cast<double>(channelLink) * (maxEnvelope - channelEnvelope[ch]);
-                }
+        // Unlinked (dual mono or single channel): channels are independent
+        for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
+        {
+            auto* data = buffer.getWritePointer(ch);
+            auto& state = fastLimiterState[ch];
 
-                // Calculate gain reduction - hard knee
-                double targetGain = 1.0;
-                if (detectionEnvelope > thresholdD)
-                {
-                    targetGain = thresholdD / detectionEnvelope;
-                }
-                targetGain = juce::jlimit(0.01, 1.0, targetGain);
+            if (belowThreshold(state, data))
+            {
+                for (int i = 0; i < numSamples; ++i)
+                    detect(state, std::abs(static_cast<double>(data[i])));
+
+                if constexpr (Oversampled)
+                    pushLookaheadBlock(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, data, numSamples);
+                continue;
+            }
 
-                // Apply gain smoothing
-                smoothedGain = gainSmoothCoeff * smoothedGain + (1.0 - gainSmoothCoeff) * targetGain;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                const double currentSample = static_cast<double>(data[i]);
+                double delayedSample = currentSample;
+                if constexpr (Oversampled)
+                    delayedSample = pushLookahead(state.lookaheadBuffer, state.lookaheadWritePos, lookahead, currentSample);
 
-                const double limitedSample = delayedSamples[ch] * smoothedGain;
-                data[i] = static_cast<SampleType>(limitedSample);
+                const double envelope = detect(state, std::abs(currentSample));
+                data[i] = static_cast<SampleType>(apply(state, currentSample, delayedSample, gainFor(envelope)));
             }
         }
     }
@@ -2989,7 +3937,7 @@ void QuadBlendDriveAudioProcessor::processOvershootSuppression(juce::AudioBuffer
     const double overshootThreshold = ceilingLinear * std::pow(10.0, -overshootMarginDB / 20.0);
 
     // Get current processing mode from osManager (consistent with Architecture A)
-    const int processingMode = osManager.getProcessingMode();
+    const int processingMode = outputLimiterMode;
 
     // MODE 0 (Zero Latency): NO oversampling for protection (flat frequency response)
     // MODE 1/2: Use pre-allocated 2-channel oversamplers (NO allocation on audio thread!)
@@ -3001,35 +3949,32 @@ void QuadBlendDriveAudioProcessor::processOvershootSuppression(juce::AudioBuffer
         if (std::is_same<SampleType, float>::value)
         {
             if (processingMode == 1)
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChBalancedFloat.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionBalancedFloat.get());
             else  // processingMode == 2
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChLinearFloat.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionLinearFloat.get());
         }
         else
         {
             if (processingMode == 1)
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChBalancedDouble.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionBalancedDouble.get());
             else  // processingMode == 2
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChLinearDouble.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionLinearDouble.get());
         }
     }
 
     // If reference buffer provided, process both through oversampling together for perfect alignment
     if (referenceBuffer != nullptr && useOversampling)
     {
-        // Use pre-allocated buffer (NO allocation on audio thread)
-        auto& combinedBuffer = std::is_same_v<SampleType, float>
-            ? reinterpret_cast<juce::AudioBuffer<SampleType>&>(protectionDeltaCombined4ChFloat)
-            : reinterpret_cast<juce::AudioBuffer<SampleType>&>(protectionDeltaCombined4ChDouble);
-        combinedBuffer.setSize(4, buffer.getNumSamples(), false, false, true);
-
-        // Copy main buffer to first 2 channels
-        for (int ch = 0; ch < 2; ++ch)
-            combinedBuffer.copyFrom(ch, 0, buffer, ch, 0, buffer.getNumSamples());
-
-        // Copy reference buffer to last 2 channels
-        for (int ch = 0; ch < 2; ++ch)
-            combinedBuffer.copyFrom(ch + 2, 0, *referenceBuffer, ch, 0, buffer.getNumSamples());
+        // View [main..., ref...] over both buffers (no copies)
+        const int numChannels = numBusChannels;
+        SampleType* combinedPointers[2 * maxChannels] = {};
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            combinedPointers[ch] = buffer.getWritePointer(ch);
+            combinedPointers[numChannels + ch] = referenceBuffer->getWritePointer(ch);
+        }
+        juce::dsp::AudioBlock<SampleType> combinedBlock(combinedPointers, static_cast<size_t>(2 * numChannels),
+                                                        static_cast<size_t>(buffer.getNumSamples()));
 
         // Select delta oversampler matching current processing mode (NO allocation on audio thread!)
         // Mode 1 (Balanced): 8×, Mode 2 (Linear Phase): 16×
@@ -3038,22 +3983,21 @@ void QuadBlendDriveAudioProcessor::processOvershootSuppression(juce::AudioBuffer
             if (std::is_same_v<SampleType, float>)
             {
                 return (processingMode == 2)
-                    ? reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChDelta16xFloat.get())
-                    : reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChDeltaFloat.get());
+                    ? reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingDelta16xFloat.get())
+                    : reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingDeltaFloat.get());
             }
             else
             {
                 return (processingMode == 2)
-                    ? reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChDelta16xDouble.get())
-                    : reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling4ChDeltaDouble.get());
+                    ? reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingDelta16xDouble.get())
+                    : reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingDeltaDouble.get());
             }
         }();
 
         // Process combined buffer through oversampling
-        juce::dsp::AudioBlock<SampleType> combinedBlock(combinedBuffer);
         auto oversampledCombined = oversamplingDelta->processSamplesUp(combinedBlock);
 
-        // Apply parameter-interpolated processor ONLY to first 2 channels (main signal)
+        // Apply parameter-interpolated processor ONLY to the main channels (first half)
         // Fixed blend for simplified design (0 = clean/gentle, 1 = punchy/aggressive)
         // Using 0.3 = slightly transparent character
         const double blend = 0.3;  // 0 = Clean, 1 = Punchy
@@ -3081,7 +4025,7 @@ void QuadBlendDriveAudioProcessor::processOvershootSuppression(juce::AudioBuffer
         // Scale knee width by ceiling
         const double kneeWidth = ceilingLinear * kneeWidthNormalized;
 
-        for (size_t ch = 0; ch < 2; ++ch)
+        for (size_t ch = 0; ch < static_cast<size_t>(numChannels); ++ch)
         {
             auto* data = oversampledCombined.getChannelPointer(ch);
             const size_t numSamples = oversampledCombined.getNumSamples();
@@ -3125,18 +4069,11 @@ void QuadBlendDriveAudioProcessor::processOvershootSuppression(juce::AudioBuffer
                 }
             }
         }
-        // Channels 2-3 (reference) pass through unchanged
+        // The reference channels pass through unchanged
 
-        // Downsample together
+        // Downsample together, straight back into buffer and *referenceBuffer
         oversamplingDelta->processSamplesDown(combinedBlock);
 
-        // Copy results back
-        for (int ch = 0; ch < 2; ++ch)
-            buffer.copyFrom(ch, 0, combinedBuffer, ch, 0, buffer.getNumSamples());
-
-        for (int ch = 0; ch < 2; ++ch)
-            referenceBuffer->copyFrom(ch, 0, combinedBuffer, ch + 2, 0, buffer.getNumSamples());
-
         return;
     }
 
@@ -3275,7 +4212,7 @@ void QuadBlendDriveAudioProcessor::processAdvancedTPL(juce::AudioBuffer<SampleTy
     const double ceilingLinear = std::pow(10.0, static_cast<double>(ceilingDB) / 20.0);
 
     // Get current processing mode from osManager (consistent with Architecture A)
-    const int processingMode = osManager.getProcessingMode();
+    const int processingMode = outputLimiterMode;
 
     // MODE 0 (Zero Latency): NO oversampling for protection (flat frequency response)
     // MODE 1/2: Use pre-allocated 2-channel oversamplers (NO allocation on audio thread!)
@@ -3287,16 +4224,16 @@ void QuadBlendDriveAudioProcessor::processAdvancedTPL(juce::AudioBuffer<SampleTy
         if (std::is_same<SampleType, float>::value)
         {
             if (processingMode == 1)
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChBalancedFloat.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionBalancedFloat.get());
             else  // processingMode == 2
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChLinearFloat.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionLinearFloat.get());
         }
         else
         {
             if (processingMode == 1)
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChBalancedDouble.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionBalancedDouble.get());
             else  // processingMode == 2
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChLinearDouble.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionLinearDouble.get());
         }
     }
 
@@ -3307,7 +4244,7 @@ void QuadBlendDriveAudioProcessor::processAdvancedTPL(juce::AudioBuffer<SampleTy
         : block;
 
     const size_t oversampledSamples = processingBlock.getNumSamples();
-    const int lookahead = advancedTPLLookaheadSamples;
+    const int lookahead = outputLimiterLookahead;
 
     // Guard against division by zero
     if (lookahead <= 0)
@@ -3341,6 +4278,7 @@ void QuadBlendDriveAudioProcessor::processAdvancedTPL(juce::AudioBuffer<SampleTy
     {
         auto* data = processingBlock.getChannelPointer(ch);
         auto& state = advancedTPLState[ch];
+        const auto& coeffs = advancedTPLCoeffs;
 
         for (size_t i = 0; i < oversampledSamples; ++i)
         {
@@ -3359,20 +4297,20 @@ void QuadBlendDriveAudioProcessor::processAdvancedTPL(juce::AudioBuffer<SampleTy
             const double inSample = inputSample;
 
             // Low band (<200 Hz) - 2-pole lowpass
-            const double lowOut = state.lowB0 * inSample + state.lowB1 * state.lowZ1 + state.lowB2 * state.lowZ2
-                                - state.lowA1 * state.lowZ1 - state.lowA2 * state.lowZ2;
+            const double lowOut = coeffs.lowB0 * inSample + coeffs.lowB1 * state.lowZ1 + coeffs.lowB2 * state.lowZ2
+                                - coeffs.lowA1 * state.lowZ1 - coeffs.lowA2 * state.lowZ2;
             state.lowZ2 = state.lowZ1;
             state.lowZ1 = inSample;
 
             // Mid band (200-4000 Hz) - 2-pole bandpass
-            const double midOut = state.midB0 * inSample + state.midB1 * state.midZ1 + state.midB2 * state.midZ2
-                                - state.midA1 * state.midZ1 - state.midA2 * state.midZ2;
+            const double midOut = coeffs.midB0 * inSample + coeffs.midB1 * state.midZ1 + coeffs.midB2 * state.midZ2
+                                - coeffs.midA1 * state.midZ1 - coeffs.midA2 * state.midZ2;
             state.midZ2 = state.midZ1;
             state.midZ1 = inSample;
 
             // High band (>4000 Hz) - 2-pole highpass
-            const double highOut = state.highB0 * inSample + state.highB1 * state.highZ1 + state.highB2 * state.highZ2
-                                 - state.highA1 * state.highZ1 - state.highA2 * state.highZ2;
+            const double highOut = coeffs.highB0 * inSample + coeffs.highB1 * state.highZ1 + coeffs.highB2 * state.highZ2
+                                 - coeffs.highA1 * state.highZ1 - coeffs.highA2 * state.highZ2;
             state.highZ2 = state.highZ1;
             state.highZ1 = inSample;
 
@@ -3466,7 +4404,7 @@ void QuadBlendDriveAudioProcessor::processCombinedLimiters(juce::AudioBuffer<Sam
     // ========================================================================
 
     const double ceilingLinear = std::pow(10.0, static_cast<double>(ceilingDB) / 20.0);
-    const int processingMode = osManager.getProcessingMode();
+    const int processingMode = outputLimiterMode;
     const bool useOversampling = (processingMode != 0);
 
     // Get oversampling pointer based on mode
@@ -3476,16 +4414,16 @@ void QuadBlendDriveAudioProcessor::processCombinedLimiters(juce::AudioBuffer<Sam
         if (std::is_same<SampleType, float>::value)
         {
             if (processingMode == 1)
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChBalancedFloat.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionBalancedFloat.get());
             else  // processingMode == 2
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChLinearFloat.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionLinearFloat.get());
         }
         else
         {
             if (processingMode == 1)
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChBalancedDouble.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionBalancedDouble.get());
             else  // processingMode == 2
-                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversampling2ChLinearDouble.get());
+                oversamplingPtr = reinterpret_cast<juce::dsp::Oversampling<SampleType>*>(oversamplingProtectionLinearDouble.get());
         }
     }
 
@@ -3554,7 +4492,7 @@ void QuadBlendDriveAudioProcessor::processCombinedLimiters(juce::AudioBuffer<Sam
 
     // === STAGE 2: TRUE PEAK LIMITER (ITU-R BS.1770-4 Compliance) ===
     {
-        const int lookahead = advancedTPLLookaheadSamples;
+        const int lookahead = outputLimiterLookahead;
 
         if (lookahead > 0)
         {
@@ -3568,6 +4506,7 @@ void QuadBlendDriveAudioProcessor::processCombinedLimiters(juce::AudioBuffer<Sam
             {
                 auto* data = processingBlock.getChannelPointer(ch);
                 auto& state = advancedTPLState[ch];
+                const auto& coeffs = advancedTPLCoeffs;
 
                 for (size_t i = 0; i < oversampledSamples; ++i)
                 {
@@ -3584,18 +4523,18 @@ void QuadBlendDriveAudioProcessor::processCombinedLimiters(juce::AudioBuffer<Sam
                     // Multiband analysis for intelligent release
                     const double inSample = inputSample;
 
-                    const double lowOut = state.lowB0 * inSample + state.lowB1 * state.lowZ1 + state.lowB2 * state.lowZ2
-                                        - state.lowA1 * state.lowZ1 - state.lowA2 * state.lowZ2;
+                    const double lowOut = coeffs.lowB0 * inSample + coeffs.lowB1 * state.lowZ1 + coeffs.lowB2 * state.lowZ2
+                                        - coeffs.lowA1 * state.lowZ1 - coeffs.lowA2 * state.lowZ2;
                     state.lowZ2 = state.lowZ1;
                     state.lowZ1 = inSample;
 
-                    const double midOut = state.midB0 * inSample + state.midB1 * state.midZ1 + state.midB2 * state.midZ2
-                                        - state.midA1 * state.midZ1 - state.midA2 * state.midZ2;
+                    const double midOut = coeffs.midB0 * inSample + coeffs.midB1 * state.midZ1 + coeffs.midB2 * state.midZ2
+                                        - coeffs.midA1 * state.midZ1 - coeffs.midA2 * state.midZ2;
                     state.midZ2 = state.midZ1;
                     state.midZ1 = inSample;
 
-                    const double highOut = state.highB0 * inSample + state.highB1 * state.highZ1 + state.highB2 * state.highZ2
-                                         - state.highA1 * state.highZ1 - state.highA2 * state.highZ2;
+                    const double highOut = coeffs.highB0 * inSample + coeffs.highB1 * state.highZ1 + coeffs.highB2 * state.highZ2
+                                         - coeffs.highA1 * state.highZ1 - coeffs.highA2 * state.highZ2;
                     state.highZ2 = state.highZ1;
                     state.highZ1 = inSample;
 
@@ -3681,175 +4620,158 @@ void QuadBlendDriveAudioProcessor::processXYBlend(juce::AudioBuffer<SampleType>&
 {
     const int numSamples = buffer.getNumSamples();  // Already in OS domain
 
-    // Get correct temp buffers for this precision
-    auto& tempBuffer1 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer1Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer1Double);
-    auto& tempBuffer2 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer2Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer2Double);
-    auto& tempBuffer3 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer3Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer3Double);
-    auto& tempBuffer4 = std::is_same<SampleType, float>::value ?
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer4Float) :
-                        reinterpret_cast<juce::AudioBuffer<SampleType>&>(tempBuffer4Double);
-
-    // Ensure temp buffers are sized for OS domain
-    tempBuffer1.setSize(2, numSamples, false, false, true);
-    tempBuffer2.setSize(2, numSamples, false, false, true);
-    tempBuffer3.setSize(2, numSamples, false, false, true);
-    tempBuffer4.setSize(2, numSamples, false, false, true);
-
-    // Read parameters (same as before, but at OS rate)
-    const SampleType xyX = static_cast<SampleType>(apvts.getRawParameterValue("XY_X_PARAM")->load());
-    const SampleType xyY = static_cast<SampleType>(apvts.getRawParameterValue("XY_Y_PARAM")->load());
-    const SampleType thresholdDB = static_cast<SampleType>(apvts.getRawParameterValue("THRESHOLD")->load());
-    const SampleType scKneePercent = static_cast<SampleType>(apvts.getRawParameterValue("SC_KNEE")->load());
-    const SampleType limitRelMs = static_cast<SampleType>(apvts.getRawParameterValue("LIMIT_REL")->load());
-    const SampleType slAttackMs = static_cast<SampleType>(apvts.getRawParameterValue("SL_LIMIT_ATTACK")->load());
-    const SampleType flAttackMs = static_cast<SampleType>(apvts.getRawParameterValue("FL_LIMIT_ATTACK")->load());
-    const SampleType flReleaseMs = static_cast<SampleType>(apvts.getRawParameterValue("FL_LIMIT_RELEASE")->load());
-
-    const SampleType hcTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("HC_TRIM")->load());
-    const SampleType scTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("SC_TRIM")->load());
-    const SampleType slTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("SL_TRIM")->load());
-    const SampleType flTrimDB = static_cast<SampleType>(apvts.getRawParameterValue("FL_TRIM")->load());
-
-    // === ENVELOPE SHAPING PARAMETERS ===
-    // Read attack/sustain emphasis for each drive type
-    const float hcAttackDB = apvts.getRawParameterValue("HC_ATTACK")->load();
-    const float hcSustainDB = apvts.getRawParameterValue("HC_SUSTAIN")->load();
-    const float scAttackDB = apvts.getRawParameterValue("SC_ATTACK")->load();
-    const float scSustainDB = apvts.getRawParameterValue("SC_SUSTAIN")->load();
-    const float slAttackDB = apvts.getRawParameterValue("SL_ATTACK")->load();
-    const float slSustainDB = apvts.getRawParameterValue("SL_SUSTAIN")->load();
-    const float flAttackDB = apvts.getRawParameterValue("FL_ATTACK")->load();
-    const float flSustainDB = apvts.getRawParameterValue("FL_SUSTAIN")->load();
-
-    // Update envelope shapers with current parameter values
-    hardClipShaper.setAttackEmphasis(hcAttackDB);
-    hardClipShaper.setSustainEmphasis(hcSustainDB);
-    softClipShaper.setAttackEmphasis(scAttackDB);
-    softClipShaper.setSustainEmphasis(scSustainDB);
-    slowLimitShaper.setAttackEmphasis(slAttackDB);
-    slowLimitShaper.setSustainEmphasis(slSustainDB);
-    fastLimitShaper.setAttackEmphasis(flAttackDB);
-    fastLimitShaper.setSustainEmphasis(flSustainDB);
-
-    // Read mute and solo states
-    // Mute takes priority over solo (like an analog console - if it's cut, it's cut)
-    const bool hcMuteParam = apvts.getRawParameterValue("HC_MUTE")->load() > 0.5f;
-    const bool scMuteParam = apvts.getRawParameterValue("SC_MUTE")->load() > 0.5f;
-    const bool slMuteParam = apvts.getRawParameterValue("SL_MUTE")->load() > 0.5f;
-    const bool flMuteParam = apvts.getRawParameterValue("FL_MUTE")->load() > 0.5f;
+    // Derived gains and weights were updated for this block in processBlockInternal
+    // (envelope shaper emphasis is pushed there too, only when it changes)
+    const auto& derived = getDerivedParameters<SampleType>();
 
-    const bool hcSolo = apvts.getRawParameterValue("HC_SOLO")->load() > 0.5f;
-    const bool scSolo = apvts.getRawParameterValue("SC_SOLO")->load() > 0.5f;
-    const bool slSolo = apvts.getRawParameterValue("SL_SOLO")->load() > 0.5f;
-    const bool flSolo = apvts.getRawParameterValue("FL_SOLO")->load() > 0.5f;
+    if (derived.allProcessorsMuted)
+        return;  // All processors muted - buffer unchanged (pristine passthrough)
 
-    // Solo logic: if any processor is soloed, mute all non-soloed processors
-    // BUT explicit mute always takes priority (mute overrides solo)
-    const bool anySolo = hcSolo || scSolo || slSolo || flSolo;
-    bool hcMute = hcMuteParam;  // Explicit mute always applies
-    bool scMute = scMuteParam;
-    bool slMute = slMuteParam;
-    bool flMute = flMuteParam;
-    if (anySolo)
-    {
-        // Only mute non-soloed processors that aren't already explicitly muted
-        if (!hcSolo && !hcMuteParam) hcMute = true;
-        if (!scSolo && !scMuteParam) scMute = true;
-        if (!slSolo && !slMuteParam) slMute = true;
-        if (!flSolo && !flMuteParam) flMute = true;
-    }
+    const SampleType threshold = derived.threshold;
+    const SampleType scKnee = derived.scKnee;
+    const SampleType limitRelMs = static_cast<SampleType>(params.limitRelMs);
+    const SampleType slAttackMs = static_cast<SampleType>(params.slAttackMs);
+    const SampleType flAttackMs = static_cast<SampleType>(params.flAttackMs);
+    const SampleType flReleaseMs = static_cast<SampleType>(params.flReleaseMs);
+
+    const SampleType hcTrimGain = derived.hcTrimGain;
+    const SampleType scTrimGain = derived.scTrimGain;
+    const SampleType slTrimGain = derived.slTrimGain;
+    const SampleType flTrimGain = derived.flTrimGain;
+
+    const SampleType wHC = derived.wHC;
+    const SampleType wSC = derived.wSC;
+    const SampleType wSL = derived.wSL;
+    const SampleType wFL = derived.wFL;
+
+    // Copy input to the four path buffers (OS-domain scratch) for parallel processing
+    auto tempBuffer1 = scratch.getCopyOf(ScratchArena::XYHardClip, buffer);
+    auto tempBuffer2 = scratch.getCopyOf(ScratchArena::XYSoftClip, buffer);
+    auto tempBuffer3 = scratch.getCopyOf(ScratchArena::XYSlowLimit, buffer);
+    auto tempBuffer4 = scratch.getCopyOf(ScratchArena::XYFastLimit, buffer);
 
-    const SampleType threshold = juce::Decibels::decibelsToGain(thresholdDB);
-    const SampleType scKnee = scKneePercent / static_cast<SampleType>(100.0);
-    const SampleType hcTrimGain = juce::Decibels::decibelsToGain(hcTrimDB);
-    const SampleType scTrimGain = juce::Decibels::decibelsToGain(scTrimDB);
-    const SampleType slTrimGain = juce::Decibels::decibelsToGain(slTrimDB);
-    const SampleType flTrimGain = juce::Decibels::decibelsToGain(flTrimDB);
+    // === ENVELOPE SHAPING: Apply dynamic gain based on transient detection ===
+    // One shared detection pass, then each path's shaper maps it to its own gain
+    // NOTE: Envelope detection is MONO (uses left channel for stereo analysis)
+    float* transientness = envelopeScratch.getWritePointer(0);
+    float* shaperGain = envelopeScratch.getWritePointer(1);
+    const auto* inputL = buffer.getReadPointer(0);
+    for (int i = 0; i < numSamples; ++i)
+        transientness[i] = static_cast<float>(inputL[i]);
 
-    // Calculate bi-linear blend weights from XY pad
-    // XY Grid Layout: Top-Left=HC, Top-Right=FL, Bottom-Left=SC, Bottom-Right=SL
-    SampleType wHC = (static_cast<SampleType>(1.0) - xyX) * xyY;  // Top-left
-    SampleType wFL = xyX * xyY;  // Top-right
-    SampleType wSC = (static_cast<SampleType>(1.0) - xyX) * (static_cast<SampleType>(1.0) - xyY);  // Bottom-left
-    SampleType wSL = xyX * (static_cast<SampleType>(1.0) - xyY);  // Bottom-right
+    // ENVELOPE_CONTROL_RATE: step the detector once per base-rate sample
+    xyTransientDetector.setDecimation(routing.envelopeControlRate ? osManager.getOsMultiplier() : 1);
+    xyTransientDetector.process(transientness, transientness, numSamples);
 
-    // Apply mute logic
-    if (hcMute) wHC = static_cast<SampleType>(0.0);
-    if (scMute) wSC = static_cast<SampleType>(0.0);
-    if (slMute) wSL = static_cast<SampleType>(0.0);
-    if (flMute) wFL = static_cast<SampleType>(0.0);
+    auto applyShaper = [&](EnvelopeShaper& shaper, juce::AudioBuffer<SampleType>& pathBuffer)
+    {
+        shaper.process(transientness, shaperGain, numSamples);
 
-    // Renormalize weights
-    const SampleType weightSum = wHC + wSC + wSL + wFL;
-    const bool allProcessorsMuted = (weightSum <= static_cast<SampleType>(1e-10));
+        // Apply envelope shaping gain to every channel (one in mono)
+        for (int ch = 0; ch < pathBuffer.getNumChannels(); ++ch)
+        {
+            auto* data = pathBuffer.getWritePointer(ch);
+            for (int i = 0; i < numSamples; ++i)
+                data[i] *= static_cast<SampleType>(shaperGain[i]);
+        }
+    };
 
-    if (allProcessorsMuted)
-        return;  // All processors muted - buffer unchanged (pristine passthrough)
+    applyShaper(hardClipShaper, tempBuffer1);
+    applyShaper(softClipShaper, tempBuffer2);
+    applyShaper(slowLimitShaper, tempBuffer3);
+    applyShaper(fastLimitShaper, tempBuffer4);
 
-    const SampleType normFactor = static_cast<SampleType>(1.0) / weightSum;
-    wHC *= normFactor;
-    wSC *= normFactor;
-    wSL *= normFactor;
-    wFL *= normFactor;
+    // Run one path at its own rate (HC/SC/SL/FL_OVERSAMPLING): decimate, process, interpolate
+    // back to the common rate, then pad it to the common XY latency so all four paths
+    // blend sample-aligned. Paths at the common rate skip straight to processing.
+    const int commonFactorIndex = osManager.getFactorIndex();
+    auto runPath = [&](XYPath path, juce::AudioBuffer<SampleType>& pathBuffer, auto&& process)
+    {
+        auto& rate = xyPathRates[path];
+        const int numPathChannels = pathBuffer.getNumChannels();
 
-    // Copy input to temp buffers for parallel processing
-    tempBuffer1.makeCopyOf(buffer);
-    tempBuffer2.makeCopyOf(buffer);
-    tempBuffer3.makeCopyOf(buffer);
-    tempBuffer4.makeCopyOf(buffer);
+        if (rate.divisor == 1)
+        {
+            process(pathBuffer, osSampleRate);
+        }
+        else
+        {
+            auto& resampler = xyPathResamplers[path];
+            const int pathSamples = resampler.decimate(pathBuffer, numSamples, commonFactorIndex, rate.factorIndex);
 
-    // === ENVELOPE SHAPING: Apply dynamic gain based on transient detection ===
-    // Process each buffer with its corresponding envelope shaper
-    // NOTE: Envelope detection is MONO (uses left channel for stereo analysis)
-    for (int i = 0; i < numSamples; ++i)
-    {
-        // Use left channel for envelope detection (mono detection, stereo application)
-        const float inputSampleL = static_cast<float>(tempBuffer1.getSample(0, i));
+            juce::AudioBuffer<SampleType> pathRateBuffer(pathBuffer.getArrayOfWritePointers(), numPathChannels, pathSamples);
+            process(pathRateBuffer, osSampleRate / rate.divisor);
 
-        // Calculate envelope-based gains for each drive type
-        const float hcEnvGain = hardClipShaper.processEnvelope(inputSampleL);
-        const float scEnvGain = softClipShaper.processEnvelope(inputSampleL);
-        const float slEnvGain = slowLimitShaper.processEnvelope(inputSampleL);
-        const float flEnvGain = fastLimitShaper.processEnvelope(inputSampleL);
+            resampler.interpolate(pathBuffer, pathSamples, commonFactorIndex, rate.factorIndex);
+        }
 
-        // Apply envelope shaping gain to both channels
-        for (int ch = 0; ch < 2; ++ch)
+        if (rate.alignDelay > 0)
         {
-            tempBuffer1.setSample(ch, i, tempBuffer1.getSample(ch, i) * static_cast<SampleType>(hcEnvGain));
-            tempBuffer2.setSample(ch, i, tempBuffer2.getSample(ch, i) * static_cast<SampleType>(scEnvGain));
-            tempBuffer3.setSample(ch, i, tempBuffer3.getSample(ch, i) * static_cast<SampleType>(slEnvGain));
-            tempBuffer4.setSample(ch, i, tempBuffer4.getSample(ch, i) * static_cast<SampleType>(flEnvGain));
+            for (int ch = 0; ch < numPathChannels; ++ch)
+            {
+                auto& line = rate.alignBuffer[ch];
+                int& writePos = rate.alignWritePos[ch];
+                auto* data = pathBuffer.getWritePointer(ch);
+
+                for (int i = 0; i < numSamples; ++i)
+                {
+                    const double delayed = line[writePos];
+                    line[writePos] = static_cast<double>(data[i]);
+                    if (++writePos == rate.alignDelay)
+                        writePos = 0;
+                    data[i] = static_cast<SampleType>(delayed);
+                }
+            }
         }
-    }
+    };
 
-    // Process all 4 paths (now at OS rate - no internal oversampling needed)
+    // Process all 4 paths (in the OS domain - no internal oversampling needed)
     // Apply trim gain AFTER envelope shaping
-    tempBuffer1.applyGain(hcTrimGain);
-    processHardClip(tempBuffer1, threshold, osSampleRate);
-
-    tempBuffer2.applyGain(scTrimGain);
-    processSoftClip(tempBuffer2, threshold, scKnee, osSampleRate);
-
-    tempBuffer3.applyGain(slTrimGain);
-    processSlowLimit(tempBuffer3, threshold, limitRelMs, slAttackMs, osSampleRate);
+    auto processPath = [&](int path)
+    {
+        switch (path)
+        {
+            case HardClipPath:
+                tempBuffer1.applyGain(hcTrimGain);
+                runPath(HardClipPath, tempBuffer1, [&](auto& p, double rate) { processHardClip(p, threshold, rate); });
+                break;
+            case SoftClipPath:
+                tempBuffer2.applyGain(scTrimGain);
+                runPath(SoftClipPath, tempBuffer2, [&](auto& p, double rate) { processSoftClip(p, threshold, scKnee, rate); });
+                break;
+            case SlowLimitPath:
+                tempBuffer3.applyGain(slTrimGain);
+                runPath(SlowLimitPath, tempBuffer3, [&](auto& p, double rate) { processSlowLimit(p, threshold, limitRelMs, slAttackMs, rate); });
+                break;
+            case FastLimitPath:
+                tempBuffer4.applyGain(flTrimGain);
+                runPath(FastLimitPath, tempBuffer4, [&](auto& p, double rate) { processFastLimit(p, threshold, flAttackMs, flReleaseMs, rate); });
+                break;
+            default:
+                break;
+        }
+    };
 
-    tempBuffer4.applyGain(flTrimGain);
-    processFastLimit(tempBuffer4, threshold, flAttackMs, flReleaseMs, osSampleRate);
+    // PARALLEL_PATHS: each path only touches its own buffer, state and resampler, so they
+    // can run on the worker pool. Base-rate blocks are too short to repay the handoff.
+    if (routing.parallelPaths && numSamples >= minParallelPathSamples)
+    {
+        xyWorkers.run(numXYPaths, processPath);
+    }
+    else
+    {
+        for (int path = 0; path < numXYPaths; ++path)
+            processPath(path);
+    }
 
     // Apply compensation gains if enabled
-    const bool masterCompEnabled = apvts.getRawParameterValue("MASTER_COMP")->load() > 0.5f;
+    const bool masterCompEnabled = params.masterComp > 0.5f;
     if (masterCompEnabled)
     {
-        const bool hcCompEnabled = apvts.getRawParameterValue("HC_COMP")->load() > 0.5f;
-        const bool scCompEnabled = apvts.getRawParameterValue("SC_COMP")->load() > 0.5f;
-        const bool slCompEnabled = apvts.getRawParameterValue("SL_COMP")->load() > 0.5f;
-        const bool flCompEnabled = apvts.getRawParameterValue("FL_COMP")->load() > 0.5f;
+        const bool hcCompEnabled = params.hcComp > 0.5f;
+        const bool scCompEnabled = params.scComp > 0.5f;
+        const bool slCompEnabled = params.slComp > 0.5f;
+        const bool flCompEnabled = params.flComp > 0.5f;
 
         if (hcCompEnabled && std::abs(hcTrimGain - static_cast<SampleType>(1.0)) > static_cast<SampleType>(1e-6))
             tempBuffer1.applyGain(static_cast<SampleType>(1.0) / hcTrimGain);
@@ -3972,11 +4894,328 @@ void QuadBlendDriveAudioProcessor::processXYBlend(juce::AudioBuffer<SampleType>&
     }
 }
 
+//==============================================================================
+// Modes 1/2: the whole oversampled XY chain for one micro-block of [wet..., dry...]
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::processOversampledXY(SampleType* const* wetDry, int numSamples, bool processWet)
+{
+    // One oversampler per channel, [wet, dry] each, with identical filters (phase-coherent).
+    // In mono only the left side runs.
+    const bool mono = monoDetection.active != MonoMode::Off;
+    const int numChannels = mono ? 1 : numBusChannels;
+
+    SampleType* channelPointers[maxChannels][2] = {};
+    juce::dsp::Oversampling<SampleType>* oversamplers[maxChannels] = {};
+    juce::dsp::AudioBlock<SampleType> channelBlocks[maxChannels], osBlocks[maxChannels];
+
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        channelPointers[ch][0] = wetDry[ch];
+        channelPointers[ch][1] = wetDry[numBusChannels + ch];
+
+        oversamplers[ch] = osManager.getOversampler<SampleType>(ch);
+        jassert(oversamplers[ch] != nullptr);
+
+        channelBlocks[ch] = juce::dsp::AudioBlock<SampleType>(channelPointers[ch], 2, static_cast<size_t>(numSamples));
+        osBlocks[ch] = oversamplers[ch]->processSamplesUp(channelBlocks[ch]);
+    }
+
+    const int osNumSamples = static_cast<int>(osBlocks[0].getNumSamples());
+    if (mono)
+        monoInputHistory.push(channelPointers[0], numSamples);
+
+    // Process ONLY the wet channels with XY blend (has lookahead)
+    if (processWet)
+    {
+        SampleType* wetPointers[maxChannels] = {};
+        for (int ch = 0; ch < numChannels; ++ch)
+            wetPointers[ch] = osBlocks[ch].getChannelPointer(0);
+
+        juce::AudioBuffer<SampleType> wetBuffer(wetPointers, numChannels, osNumSamples);
+        processXYBlend(wetBuffer, oversamplers[0]->getOversamplingFactor() * currentSampleRate);
+    }
+
+    // Delay dry channels in OS domain to match wet's XY lookahead (and path alignment)
+    const int osLookahead = lookaheadSamples + xyPathAlignment;  // Already at OS rate
+    if (osLookahead > 0)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& delayState = dryDelayState[ch];
+            auto* dryData = osBlocks[ch].getChannelPointer(1);
+
+            for (int i = 0; i < osNumSamples; ++i)
+            {
+                const double delayed = delayState.delayBuffer[delayState.writePos];
+                delayState.delayBuffer[delayState.writePos] = static_cast<double>(dryData[i]);
+                delayState.writePos = (delayState.writePos + 1) % osLookahead;
+                dryData[i] = static_cast<SampleType>(delayed);
+            }
+        }
+    }
+
+    if (mono)
+    {
+        const SampleType* osPointers[2] = { osBlocks[0].getChannelPointer(0), osBlocks[0].getChannelPointer(1) };
+        monoOsHistory.push(osPointers, osNumSamples);
+    }
+
+    // === DELTA MODE: Deferred to after limiters ===
+    // Delta will be computed after ALL processing (processors + limiters)
+    // For now, keep wet and dry separate through downsampling
+
+    // Downsample each channel (phase-coherent)
+    // Written straight back into the wet/dry channels, now perfectly phase-coherent
+    for (int ch = 0; ch < numChannels; ++ch)
+        oversamplers[ch]->processSamplesDown(channelBlocks[ch]);
+
+    if (mono)
+    {
+        // Mono detection only runs on stereo buses, so this is [wetL, wetR, dryL, dryR].
+        // The dry pair is identical in both mono modes; the wet right side is either the
+        // left one or (silent side) nothing
+        juce::FloatVectorOperations::copy(wetDry[3], wetDry[2], numSamples);
+        if (monoDetection.active == MonoMode::Identical)
+            juce::FloatVectorOperations::copy(wetDry[1], wetDry[0], numSamples);
+        else
+            juce::FloatVectorOperations::clear(wetDry[1], numSamples);
+    }
+}
+
+// ADAPTIVE_OS: every path passes the block's peak unchanged apart from a gain
+template<typename SampleType>
+bool QuadBlendDriveAudioProcessor::isXYChainLinear(float wetPeak, double& linearGain)
+{
+    const auto& derived = getDerivedParameters<SampleType>();
+    const double threshold = static_cast<double>(derived.threshold);
+    const double wHC = static_cast<double>(derived.wHC), wSC = static_cast<double>(derived.wSC);
+    const double wSL = static_cast<double>(derived.wSL), wFL = static_cast<double>(derived.wFL);
+    const double hcTrim = static_cast<double>(derived.hcTrimGain), scTrim = static_cast<double>(derived.scTrimGain);
+    const double slTrim = static_cast<double>(derived.slTrimGain), flTrim = static_cast<double>(derived.flTrimGain);
+
+    // Soft clip slope at zero: drive * makeup, with the oversampled -0.5 dB compensation
+    const double scDrive = 1.0 + 3.0 * static_cast<double>(derived.scKnee);
+    const double scSlope = scDrive / std::tanh(scDrive) * 0.944;
+
+    // Master comp undoes each enabled path's trim after processing
+    const bool masterComp = params.masterComp > 0.5f;
+    auto outputTrim = [masterComp](double trim, float comp) { return (masterComp && comp > 0.5f) ? 1.0 : trim; };
+
+    linearGain = wHC * outputTrim(hcTrim, params.hcComp)
+               + wSC * outputTrim(scTrim, params.scComp) * scSlope
+               + wSL * outputTrim(slTrim, params.slComp)
+               + wFL * outputTrim(flTrim, params.flComp);
+
+    // Attack/sustain emphasis makes every path's gain signal-dependent
+    if (params.hcAttackDB != 0.0f || params.hcSustainDB != 0.0f || params.scAttackDB != 0.0f || params.scSustainDB != 0.0f
+        || params.slAttackDB != 0.0f || params.slSustainDB != 0.0f || params.flAttackDB != 0.0f || params.flSustainDB != 0.0f)
+        return false;
+
+    // ADAA delays the clippers by a fraction of a sample relative to the other paths
+    if (routing.clipAntiAliasOrder != ADAA::Off && (wHC > 0.0 || wSC > 0.0))
+        return false;
+
+    // Inter-sample peaks at the OS rate can exceed the base-rate sample peak, so keep 6 dB clear
+    const double peak = 2.0 * static_cast<double>(wetPeak);
+    const double slowKneeStart = threshold * juce::Decibels::decibelsToGain(-3.0);  // slowLimitKernel's knee
+    constexpr double softClipLinearLimit = 0.05;  // tanh(u) within 0.1% (-60 dB) of u below this
+    constexpr double releasedGain = 0.99999;
+
+    if (wHC > 0.0 && peak * hcTrim > threshold)
+        return false;
+
+    if (wSC > 0.0 && peak * scTrim * scDrive / threshold > softClipLinearLimit)
+        return false;
+
+    // The limiters also have to have released down to the signal (or 40 dB under their
+    // knee), so their detectors resume from about where they would have settled anyway
+    if ((wSL > 0.0 && peak * slTrim > slowKneeStart) || (wFL > 0.0 && peak * flTrim > threshold))
+        return false;
+
+    const double slLevel = juce::jmax(peak * slTrim, 0.01 * slowKneeStart);
+    const double flLevel = juce::jmax(peak * flTrim, 0.01 * threshold);
+
+    // In mono the right side's state is frozen; only the left one is running
+    const int numActiveChannels = monoDetection.active == MonoMode::Off ? numBusChannels : 1;
+    for (int ch = 0; ch < numActiveChannels; ++ch)
+    {
+        const auto& slow = slowLimiterState[ch];
+        if (wSL > 0.0 && (slow.envelope > slLevel || slow.rmsEnvelope > slLevel * slLevel || slow.smoothedGain < releasedGain))
+            return false;
+
+        const auto& fast = fastLimiterState[ch];
+        if (wFL > 0.0 && (fast.envelope > flLevel || fast.smoothedGain < releasedGain))
+            return false;
+    }
+
+    return true;
+}
+
+// ADAPTIVE_OS: run the chain over enough idle history to flush everything it remembers
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::preRollOversampledXY(int currentBlockSamples, bool processWet)
+{
+    // Up and down filter cascades (about twice their combined latency) plus the XY
+    // lookahead/alignment, in whole micro-blocks
+    const int osMultiplier = osManager.getOsMultiplier();
+    const int chainMemory = 2 * static_cast<int>(std::ceil(osManager.getExactLatencySamples()))
+                          + (lookaheadSamples + xyPathAlignment + osMultiplier - 1) / osMultiplier;
+    const int preRollSamples = (chainMemory + microBlockSize - 1) / microBlockSize * microBlockSize;
+
+    auto preRoll = scratch.getBuffer<SampleType>(ScratchArena::AdaptiveOversampling, 2 * numBusChannels, microBlockSize);
+
+    for (int start = 0; start < preRollSamples; start += microBlockSize)
+    {
+        const int samplesAgo = currentBlockSamples + preRollSamples - start;
+        for (int ch = 0; ch < numBusChannels; ++ch)
+        {
+            adaptiveWetDelay.copyHistory(ch, preRoll.getWritePointer(ch), samplesAgo, microBlockSize);
+            adaptiveDryDelay.copyHistory(ch, preRoll.getWritePointer(numBusChannels + ch), samplesAgo, microBlockSize);
+        }
+
+        processOversampledXY(preRoll.getArrayOfWritePointers(), microBlockSize, processWet);
+    }
+}
+
+// MONO DETECTION: mono once the candidate has held for the tail, stereo as soon as it breaks
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::updateMonoDetection(const juce::AudioBuffer<SampleType>& wet,
+                                                       const juce::AudioBuffer<SampleType>& dry, bool compareDry)
+{
+    const int numSamples = wet.getNumSamples();
+    const size_t numBytes = sizeof(SampleType) * static_cast<size_t>(numSamples);
+
+    // Only a stereo pair can collapse to one side (wider buses keep every channel running)
+    auto candidate = MonoMode::Off;
+    if (numBusChannels == 2 && wet.getNumChannels() == 2)
+    {
+        const bool dryIdentical = !compareDry
+                               || std::memcmp(dry.getReadPointer(0), dry.getReadPointer(1), numBytes) == 0;
+
+        if (dryIdentical && std::memcmp(wet.getReadPointer(0), wet.getReadPointer(1), numBytes) == 0)
+            candidate = MonoMode::Identical;
+        else if (dryIdentical && routing.midSide && wet.getMagnitude(1, 0, numSamples) == static_cast<SampleType>(0.0))
+            candidate = MonoMode::SilentSide;
+    }
+
+    if (candidate != monoDetection.candidate)
+    {
+        monoDetection.candidate = candidate;
+        monoDetection.candidateSamples = 0;
+    }
+
+    // The same hold as the silence gate: by then the right side's envelopes, lookahead
+    // lines and filters carry nothing the left side's do not
+    const int holdSamples = static_cast<int>(std::ceil(computeTailSeconds(params.limitRelMs, params.flReleaseMs)
+                                                       * currentSampleRate));
+    monoDetection.candidateSamples = juce::jmin(monoDetection.candidateSamples + numSamples, holdSamples);
+
+    if (monoDetection.active != MonoMode::Off && monoDetection.active != candidate)
+        leaveMonoProcessing<SampleType>();
+
+    if (monoDetection.active == MonoMode::Off && candidate != MonoMode::Off
+        && monoDetection.candidateSamples >= holdSamples)
+    {
+        monoDetection.active = candidate;
+        monoInputHistory.reset();
+        monoOsHistory.reset();
+    }
+}
+
+template<typename SampleType>
+void QuadBlendDriveAudioProcessor::leaveMonoProcessing()
+{
+    const bool silentSide = monoDetection.active == MonoMode::SilentSide;
+    monoDetection.active = MonoMode::Off;
+
+    auto copyLine = [](const DelayLine& source, DelayLine& destination)
+    {
+        std::copy(source.data, source.data + juce::jmin(source.length, destination.length), destination.data);
+    };
+
+    // The dry pair was identical either way
+    copyLine(dryDelayState[0].delayBuffer, dryDelayState[1].delayBuffer);
+    dryDelayState[1].writePos = dryDelayState[0].writePos;
+
+    // Identical input: the right processors would have followed the left ones exactly.
+    // A silent side has left them at rest, where they still are.
+    if (!silentSide)
+    {
+        auto copyState = [&copyLine](auto& states)
+        {
+            const DelayLine rightLine = states[1].lookaheadBuffer;
+            states[1] = states[0];
+            states[1].lookaheadBuffer = rightLine;
+            copyLine(states[0].lookaheadBuffer, states[1].lookaheadBuffer);
+        };
+
+        copyState(hardClipState);
+        copyState(softClipState);
+        copyState(slowLimiterState);
+        copyState(fastLimiterState);
+
+        for (int path = 0; path < numXYPaths; ++path)
+        {
+            auto& rate = xyPathRates[path];
+            copyLine(rate.alignBuffer[0], rate.alignBuffer[1]);
+            rate.alignWritePos[1] = rate.alignWritePos[0];
+            xyPathResamplers[path].copyChannel(0, 1);
+        }
+    }
+
+    // Replay the right oversampler through everything the left one was fed (the wet side
+    // as silence for a silent side), so its filters end up where they would have been
+    auto* oversampler = osManager.getOversampler<SampleType>(1);
+    if (oversampler == nullptr)
+        return;
+
+    const int factor = osManager.getOsMultiplier();
+    const int replaySamples = monoInputHistory.getNumStored();
+    jassert(replaySamples * factor <= monoOsHistory.getNumStored());
+
+    for (int start = 0; start < replaySamples; start += microBlockSize)
+    {
+        const int length = juce::jmin(microBlockSize, replaySamples - start);
+        auto replay = scratch.getBuffer<SampleType>(ScratchArena::MonoReplay, 2, length);
+        juce::dsp::AudioBlock<SampleType> block(replay);
+
+        if (silentSide)
+            replay.clear(0, 0, length);
+        else
+            monoInputHistory.copy(0, replay.getWritePointer(0), replaySamples - start, length);
+        monoInputHistory.copy(1, replay.getWritePointer(1), replaySamples - start, length);
+
+        auto osBlock = oversampler->processSamplesUp(block);
+        const int osSamplesAgo = (replaySamples - start) * factor;
+        if (silentSide)
+            osBlock.getSingleChannelBlock(0).clear();
+        else
+            monoOsHistory.copy(0, osBlock.getChannelPointer(0), osSamplesAgo, length * factor);
+        monoOsHistory.copy(1, osBlock.getChannelPointer(1), osSamplesAgo, length * factor);
+
+        oversampler->processSamplesDown(block);
+    }
+}
+
 //==============================================================================
 // Explicit template instantiations
 template void QuadBlendDriveAudioProcessor::processXYBlend<float>(juce::AudioBuffer<float>&, double);
 template void QuadBlendDriveAudioProcessor::processXYBlend<double>(juce::AudioBuffer<double>&, double);
 
+template void QuadBlendDriveAudioProcessor::processOversampledXY<float>(float* const*, int, bool);
+template void QuadBlendDriveAudioProcessor::processOversampledXY<double>(double* const*, int, bool);
+
+template bool QuadBlendDriveAudioProcessor::isXYChainLinear<float>(float, double&);
+template bool QuadBlendDriveAudioProcessor::isXYChainLinear<double>(float, double&);
+
+template void QuadBlendDriveAudioProcessor::preRollOversampledXY<float>(int, bool);
+template void QuadBlendDriveAudioProcessor::preRollOversampledXY<double>(int, bool);
+
+template void QuadBlendDriveAudioProcessor::updateMonoDetection<float>(const juce::AudioBuffer<float>&, const juce::AudioBuffer<float>&, bool);
+template void QuadBlendDriveAudioProcessor::updateMonoDetection<double>(const juce::AudioBuffer<double>&, const juce::AudioBuffer<double>&, bool);
+template void QuadBlendDriveAudioProcessor::leaveMonoProcessing<float>();
+template void QuadBlendDriveAudioProcessor::leaveMonoProcessing<double>();
+
 template void QuadBlendDriveAudioProcessor::processHardClip<float>(juce::AudioBuffer<float>&, float, double);
 template void QuadBlendDriveAudioProcessor::processHardClip<double>(juce::AudioBuffer<double>&, double, double);
 
@@ -3998,6 +5237,19 @@ template void QuadBlendDriveAudioProcessor::processAdvancedTPL<double>(juce::Aud
 template void QuadBlendDriveAudioProcessor::processBlockInternal<float>(juce::AudioBuffer<float>&, juce::MidiBuffer&);
 template void QuadBlendDriveAudioProcessor::processBlockInternal<double>(juce::AudioBuffer<double>&, juce::MidiBuffer&);
 
+template void QuadBlendDriveAudioProcessor::processMicroBlock<float>(juce::AudioBuffer<float>&);
+template void QuadBlendDriveAudioProcessor::processMicroBlock<double>(juce::AudioBuffer<double>&);
+
+template void QuadBlendDriveAudioProcessor::processPipelineStep<float>(juce::AudioBuffer<float>&, int, int);
+template void QuadBlendDriveAudioProcessor::processPipelineStep<double>(juce::AudioBuffer<double>&, int, int);
+
+template bool QuadBlendDriveAudioProcessor::processMicroBlockInput<float>(juce::AudioBuffer<float>&, MicroBlockHandoff&);
+template bool QuadBlendDriveAudioProcessor::processMicroBlockInput<double>(juce::AudioBuffer<double>&, MicroBlockHandoff&);
+template void QuadBlendDriveAudioProcessor::processMicroBlockLimiters<float>(juce::AudioBuffer<float>&, const MicroBlockHandoff&);
+template void QuadBlendDriveAudioProcessor::processMicroBlockLimiters<double>(juce::AudioBuffer<double>&, const MicroBlockHandoff&);
+template void QuadBlendDriveAudioProcessor::processMicroBlockOutput<float>(juce::AudioBuffer<float>&, const juce::AudioBuffer<float>&, const MicroBlockHandoff&);
+template void QuadBlendDriveAudioProcessor::processMicroBlockOutput<double>(juce::AudioBuffer<double>&, const juce::AudioBuffer<double>&, const MicroBlockHandoff&);
+
 //==============================================================================
 juce::AudioProcessorEditor* QuadBlendDriveAudioProcessor::createEditor()
 {
@@ -4,6 +4,17 @@
 #include <juce_dsp/juce_dsp.h>
 #include "OversamplingManager.h"
 #include "DSP/EnvelopeShaper.h"
+#include "DSP/ADAA.h"
+#include "DSP/ChannelHistory.h"
+#include "DSP/DelayMemory.h"
+#include "DSP/LatencyMatchedDelay.h"
+#include "DSP/PathResampler.h"
+#include "DSP/RealtimeWorkerPool.h"
+#include "DSP/ScratchArena.h"
+#include <array>
+#include <cstring>
+#include <utility>
+#include <vector>
 
 /**
  * @brief User-configurable processor colors for UI visualization
@@ -53,7 +64,9 @@ struct ProcessorColors
     }
 };
 
-class QuadBlendDriveAudioProcessor : public juce::AudioProcessor
+class QuadBlendDriveAudioProcessor : public juce::AudioProcessor,
+                                     private juce::AudioProcessorValueTreeState::Listener,
+                                     private juce::AsyncUpdater
 {
 public:
     QuadBlendDriveAudioProcessor();
@@ -62,6 +75,9 @@ public:
     void prepareToPlay(double sampleRate, int samplesPerBlock) override;
     void releaseResources() override;
 
+    // Any layout up to maxChannels (stereo, 5.1, 7.1.4, ...), the same on input and output
+    bool isBusesLayoutSupported(const BusesLayout& layouts) const override;
+
     // Template processBlock to support both float and double
     void processBlock(juce::AudioBuffer<float>&, juce::MidiBuffer&) override;
     void processBlock(juce::AudioBuffer<double>&, juce::MidiBuffer&) override;
@@ -72,8 +88,8 @@ public:
     const juce::String getName() const override { return JucePlugin_Name; }
     bool acceptsMidi() const override { return false; }
     bool producesMidi() const override { return false; }
-    double getTailLengthSeconds() const override { return 1.0; }  // 800ms slow limiter release + margin
-    int getLatencySamples() const { return totalLatencySamples; }  // 3ms + 4ms = 7ms total
+    double getTailLengthSeconds() const override;  // Engine latency + slowest limiter release
+    int getLatencySamples() const { return totalLatencySamples + pipeline.latency; }  // 3ms + 4ms = 7ms total
 
     int getNumPrograms() override { return 1; }
     int getCurrentProgram() override { return 0; }
@@ -194,6 +210,10 @@ public:
     static constexpr int displayBufferSize = 196608;  // 4.096 seconds at 48kHz
     std::array<DisplaySample, displayBufferSize> displayBuffer;
     std::atomic<int> displayWritePos{0};
+    std::atomic<uint32_t> displayBufferGeneration{0};  // Bumped whenever the ring is cleared/rewound
+    // Samples written to the ring since construction, published after each block's writes. It
+    // never goes back (a rewind rounds it up), and always equals displayWritePos modulo the size
+    std::atomic<uint64_t> displaySamplesWritten{0};
 
     // Decimated display cache for efficient 60fps GUI rendering
     // Each segment stores min/max envelope for accurate peak representation
@@ -231,6 +251,11 @@ public:
     std::array<DecimatedSegment, decimatedDisplaySize> decimatedDisplay;
     std::atomic<bool> decimatedDisplayReady{false};
 
+    // Running count of segments appended to decimatedDisplay (GUI thread only)
+    // Scrolling views diff this between frames to know how far the data moved;
+    // a full rebuild advances it by decimatedDisplaySize
+    uint64_t decimatedSegmentsWritten = 0;
+
     // === TRANSPORT SYNC FOR DISPLAY ===
     std::atomic<bool> isPlaying{false};
     std::atomic<bool> wasPlaying{false};
@@ -240,8 +265,10 @@ public:
 
     // Display buffer write control
     std::atomic<bool> displayBufferFrozen{false};  // True when stopped
+    std::atomic<bool> editorOpen{false};           // Set by the editor; display capture is skipped while closed
 
     // Update decimated display cache (called from GUI thread)
+    // Only segments completed since the previous call are decimated; the rest are scrolled
     void updateDecimatedDisplay();
 
     // Update transport state and sync display (called from audio thread)
@@ -267,14 +294,110 @@ public:
 private:
     static juce::AudioProcessorValueTreeState::ParameterLayout createParameterLayout();
 
-    // Template processing function
+    // Template processing function: per host block work, then the chain per micro-block
     template<typename SampleType>
     void processBlockInternal(juce::AudioBuffer<SampleType>& buffer, juce::MidiBuffer& midiMessages);
 
+    template<typename SampleType>
+    void processMicroBlock(juce::AudioBuffer<SampleType>& buffer);
+
+    // The three stages of a micro-block. The input stage (up to the mixed wet signal, and
+    // the delta) returns false when it already finished the block (bypass, silence gate).
+    // The output limiters and the output stage (M/S decode, AGC, meters, display) only
+    // read what it left in the handoff, so PIPELINED_ENGINE can run them a host block later.
+    struct MicroBlockHandoff;
+
+    template<typename SampleType>
+    bool processMicroBlockInput(juce::AudioBuffer<SampleType>& buffer, MicroBlockHandoff& handoff);
+
+    template<typename SampleType>
+    void processMicroBlockLimiters(juce::AudioBuffer<SampleType>& buffer, const MicroBlockHandoff& handoff);
+
+    template<typename SampleType>
+    void processMicroBlockOutput(juce::AudioBuffer<SampleType>& buffer, const juce::AudioBuffer<SampleType>& dryBuffer,
+                                 const MicroBlockHandoff& handoff);
+
+    // PIPELINED_ENGINE: one step of at most pipeline.latency samples of the host block
+    template<typename SampleType>
+    void processPipelineStep(juce::AudioBuffer<SampleType>& buffer, int startSample, int numSamples);
+
+    // Host blocks are processed in slices of at most this many base-rate samples
+    // (2048 oversampled samples per channel at 32x)
+    static constexpr int microBlockSize = 64;
+    static constexpr int maxOversamplingFactor = OversamplingManager::maxFactor;
+    static constexpr int maxChannels = DelayMemory::maxChannels;
+
+    // Main bus channels the chain runs on (set in prepareToPlay)
+    int numBusChannels = 2;
+
+    // CHANNEL_LINK_GROUPS: which channels share limiter detection when CHANNEL_LINK links them
+    enum class LinkGroups
+    {
+        All,            // Every channel but the LFE
+        BedAndHeights,  // The bed and the height (top/bottom) layer each linked on their own
+        StereoPairs     // L/R, Ls/Rs, Ltf/Rtf, ... linked as pairs; centres stay unlinked
+    };
+
+    // Channel types of the main bus (set in prepareToPlay)
+    std::array<juce::AudioChannelSet::ChannelType, maxChannels> busChannelTypes{};
+
+    // CHANNEL_LINK group of each channel (0 .. maxChannels - 1): channels of one group link to
+    // the group's loudest envelope. -1 is never linked: the LFE, whose level has nothing to
+    // do with the rest of the mix, and channels StereoPairs finds no partner for.
+    std::array<int, maxChannels> linkGroup{};
+    void updateLinkGroups(LinkGroups groups);
+
+    // Output limiters (overshoot/TPL) keep their own oversamplers at the engine's default
+    // factor (8x Balanced, 16x Linear Phase, 1x Zero Latency), whatever OVERSAMPLING says
+    double getProtectionOsSampleRate(int processingMode) const
+    {
+        return currentSampleRate * (1 << OversamplingManager::getFactorIndex(processingMode, 0));
+    }
+
+    // XY blend paths, in blend order
+    enum XYPath
+    {
+        HardClipPath,
+        SoftClipPath,
+        SlowLimitPath,
+        FastLimitPath,
+        numXYPaths
+    };
+
+    // Lay out each XY path's rate, lookahead and alignment delay for the active engine/factor
+    // (audio-thread safe: only picks stages and lengths inside pre-allocated memory)
+    void updateXYPathRates(const std::array<int, numXYPaths>& choices);
+
     // Architecture A: XY Blend processing (runs entirely in OS domain)
     template<typename SampleType>
     void processXYBlend(juce::AudioBuffer<SampleType>& buffer, double osSampleRate);
 
+    // Modes 1/2: up-sample [wet0..wetN-1, dry0..dryN-1] (one oversampler per channel), run
+    // the XY blend on the wet channels (unless processWet is false), delay the dry ones to
+    // match, down-sample in place. In mono only the left side runs and the right is copied.
+    template<typename SampleType>
+    void processOversampledXY(SampleType* const* wetDry, int numSamples, bool processWet);
+
+    // MONO DETECTION: classify the block entering the XY chain and decide whether it runs
+    // one side or both (compareDry: the dry pair goes through the chain too)
+    template<typename SampleType>
+    void updateMonoDetection(const juce::AudioBuffer<SampleType>& wet, const juce::AudioBuffer<SampleType>& dry,
+                             bool compareDry);
+
+    // MONO DETECTION: bring the right side back in step with the left before stereo resumes
+    template<typename SampleType>
+    void leaveMonoProcessing();
+
+    // ADAPTIVE_OS: whether the XY chain is linear for a block with this wet peak; linearGain
+    // is always set to its small-signal gain (blend of the path trims and soft clip slope)
+    template<typename SampleType>
+    bool isXYChainLinear(float wetPeak, double& linearGain);
+
+    // ADAPTIVE_OS: refill the oversampled chain from the idle history ending just before
+    // the current micro-block, so it re-engages without a transient
+    template<typename SampleType>
+    void preRollOversampledXY(int currentBlockSamples, bool processWet);
+
     // Processing functions for each type (templated for float/double)
     template<typename SampleType>
     void processHardClip(juce::AudioBuffer<SampleType>& buffer, SampleType threshold, double sampleRate);
@@ -288,6 +411,107 @@ private:
     template<typename SampleType>
     void processFastLimit(juce::AudioBuffer<SampleType>& buffer, SampleType threshold, SampleType attackMs, SampleType releaseMs, double sampleRate);
 
+    // Per-sample kernels behind the four processors, specialised at compile time so the inner
+    // loops carry no mode or link branches. Oversampled = modes 1/2 (3ms lookahead, smoothed
+    // limiter gain); 8x and 16x differ only in coefficients. Linked = stereo link above 0%.
+    // AntiAlias = ADAA order for the clippers (ADAA::Off/FirstOrder/SecondOrder).
+    // Oversampled limiter kernels switch to a control-rate loop under LIMIT_CONTROL_RATE.
+    // The hard clip and limiter kernels reduce blocks that provably stay below their knee
+    // to a block copy through the lookahead (limiter detectors keep running).
+    // The process* functions above pick one per block from a function table.
+    template<typename SampleType, bool Oversampled, int AntiAlias>
+    void hardClipKernel(juce::AudioBuffer<SampleType>& buffer, double threshold);
+
+    template<typename SampleType, bool Oversampled, int AntiAlias>
+    void softClipKernel(juce::AudioBuffer<SampleType>& buffer, double ceiling, double drive, double makeup);
+
+    template<typename SampleType, bool Oversampled, bool Linked>
+    void slowLimitKernel(juce::AudioBuffer<SampleType>& buffer, double channelLink);
+
+    template<typename SampleType, bool Oversampled, bool Linked>
+    void fastLimitKernel(juce::AudioBuffer<SampleType>& buffer, double threshold, double channelLink);
+
+    // One step of a processor's lookahead delay: stores x, returns the sample from length ago
+    static double pushLookahead(DelayLine& line, int& writePos, int length, double x)
+    {
+        if (writePos >= 0 && writePos < line.length)
+            line.data[writePos] = x;
+
+        const int readPos = (writePos + 1) % length;
+        double delayed = x;
+        if (readPos >= 0 && readPos < line.length)
+            delayed = line.data[readPos];
+
+        writePos = (writePos + 1) % length;
+        return delayed;
+    }
+
+    // pushLookahead() over a whole block in place: same delay and ring state, without the
+    // per-sample modulo (sub-threshold fast paths, where the processor is a pure delay)
+    template<typename SampleType>
+    static void pushLookaheadBlock(DelayLine& line, int& writePos, int length, SampleType* data, int numSamples)
+    {
+        if (writePos < 0 || writePos >= length || length > line.length)
+        {
+            for (int i = 0; i < numSamples; ++i)
+                data[i] = static_cast<SampleType>(pushLookahead(line, writePos, length, static_cast<double>(data[i])));
+            return;
+        }
+
+        int pos = writePos;
+        for (int i = 0; i < numSamples; ++i)
+        {
+            const int readPos = (pos + 1 == length) ? 0 : pos + 1;
+            line.data[pos] = static_cast<double>(data[i]);
+            data[i] = static_cast<SampleType>(line.data[readPos]);
+            pos = readPos;
+        }
+        writePos = pos;
+    }
+
+    // Largest magnitude in a block (vectorised min/max scan)
+    template<typename SampleType>
+    static double blockPeak(const SampleType* data, int numSamples)
+    {
+        const auto range = juce::FloatVectorOperations::findMinAndMax(data, numSamples);
+        return juce::jmax(-static_cast<double>(range.getStart()), static_cast<double>(range.getEnd()));
+    }
+
+    // Loudest envelope of each CHANNEL_LINK group (see linkGroup), indexed by group
+    void linkedMaxima(const double* envelopes, int numChannels, double* maxima) const
+    {
+        std::fill(maxima, maxima + numChannels, 0.0);
+        for (int ch = 0; ch < numChannels; ++ch)
+            if (const int group = linkGroup[static_cast<size_t>(ch)]; group >= 0)
+                maxima[group] = juce::jmax(maxima[group], envelopes[ch]);
+    }
+
+    // Smoothed limiter gains settle a few ulps under 1 (a fixed point of the smoother), so
+    // "no gain reduction" is tested with this tolerance rather than == 1
+    static constexpr double unityGainTolerance = 1.0e-12;
+
+    // Limiter gain at control rate (LIMIT_CONTROL_RATE): ramps from the previous control
+    // gain to targetGain across one control period of oversampled samples, through the
+    // usual gain smoother, and applies it to the lookahead-delayed signal
+    template<typename LimiterState, typename SampleType>
+    static void applyControlRateGain(LimiterState& state, SampleType* data, int numSamples, int lookahead,
+                                     double gainSmoothCoeff, double targetGain)
+    {
+        const double step = (targetGain - state.controlGain) / numSamples;
+        double gain = state.controlGain;
+
+        for (int i = 0; i < numSamples; ++i)
+        {
+            gain += step;
+            const double delayed = pushLookahead(state.lookaheadBuffer, state.lookaheadWritePos, lookahead,
+                                                 static_cast<double>(data[i]));
+            state.smoothedGain = gainSmoothCoeff * state.smoothedGain + (1.0 - gainSmoothCoeff) * gain;
+            data[i] = static_cast<SampleType>(delayed * state.smoothedGain);
+        }
+
+        state.controlGain = targetGain;
+    }
+
     // Overshoot suppression (true-peak safety with 8x oversampling)
     template<typename SampleType>
     void processOvershootSuppression(juce::AudioBuffer<SampleType>& buffer, SampleType ceilingDB, double sampleRate, bool enabled = true, juce::AudioBuffer<SampleType>* referenceBuffer = nullptr);
@@ -308,85 +532,283 @@ private:
     // Normalization helper
     void calculateNormalizationGain();
 
+    // Min/max decimation of one display segment starting at ring position readPos
+    void decimateDisplaySegment(int readPos, DecimatedSegment& seg) const;
+
+    // Incremental decimation bookkeeping (GUI thread only)
+    int decimatedReadPos = -1;                // Ring position of the next undecimated segment (-1 = full rebuild)
+    uint64_t decimatedSamplesRead = 0;        // displaySamplesWritten at decimatedReadPos
+    uint32_t decimatedGeneration = 0;         // displayBufferGeneration seen by the last rebuild
+
+    // === COMPILED PARAMETER SNAPSHOT (audio thread) ===
+    // Every parameter the audio thread needs, copied once per block from raw APVTS
+    // pointers that are resolved in the constructor (no string lookups per block)
+    struct ParameterSnapshot
+    {
+        // XY pad and drive
+        float xyX = 0.5f, xyY = 0.5f;
+        float thresholdDB = 0.0f;
+        float scKneePercent = 0.0f;
+        float limitRelMs = 100.0f, slAttackMs = 1.0f, flAttackMs = 1.0f, flReleaseMs = 100.0f;
+
+        // Global gains
+        float inputGainDB = 0.0f, outputGainDB = 0.0f, mixWetPercent = 100.0f;
+
+        // Per-processor trims, mute/solo, compensation and envelope shaping
+        float hcTrimDB = 0.0f, scTrimDB = 0.0f, slTrimDB = 0.0f, flTrimDB = 0.0f;
+        float hcMute = 0.0f, scMute = 0.0f, slMute = 0.0f, flMute = 0.0f;
+        float hcSolo = 0.0f, scSolo = 0.0f, slSolo = 0.0f, flSolo = 0.0f;
+        float hcComp = 0.0f, scComp = 0.0f, slComp = 0.0f, flComp = 0.0f;
+        float hcAttackDB = 0.0f, hcSustainDB = 0.0f, scAttackDB = 0.0f, scSustainDB = 0.0f;
+        float slAttackDB = 0.0f, slSustainDB = 0.0f, flAttackDB = 0.0f, flSustainDB = 0.0f;
+        float hcOversampling = 0.0f, scOversampling = 0.0f, slOversampling = 0.0f, flOversampling = 0.0f;
+
+        // Modes and switches (bools stored raw, tested with > 0.5f)
+        float bypass = 0.0f, deltaMode = 0.0f, masterComp = 0.0f, agcEnable = 0.0f;
+        float processingMode = 0.0f, channelMode = 0.0f, channelLinkPercent = 0.0f, channelLinkGroups = 0.0f;
+        float clipAntiAlias = 0.0f, oversampling = 0.0f, limiterControlRate = 0.0f, envelopeControlRate = 0.0f;
+        float adaptiveOversampling = 0.0f, parallelPaths = 0.0f;
+
+        // Output limiters
+        float overshootEnable = 0.0f, truePeakEnable = 0.0f, outputCeilingDB = 0.0f;
+        float overshootDeltaMode = 0.0f, truePeakDeltaMode = 0.0f;
+
+        bool operator==(const ParameterSnapshot& other) const { return std::memcmp(this, &other, sizeof(*this)) == 0; }
+        bool operator!=(const ParameterSnapshot& other) const { return !(*this == other); }
+    };
+
+    // Values derived from the snapshot (dB->gain, blend weights, mute/solo),
+    // recomputed only when the snapshot changes. One set per processing precision.
+    template<typename SampleType>
+    struct DerivedParameters
+    {
+        uint32_t generation = 0;    // parameterGeneration these values were computed from
+        bool valid = false;
+
+        SampleType threshold{}, inputGain{}, outputGain{}, mixWet{}, scKnee{};
+        SampleType hcTrimGain{}, scTrimGain{}, slTrimGain{}, flTrimGain{};
+
+        // Normalised XY blend weights with mute/solo applied
+        SampleType wHC{}, wSC{}, wSL{}, wFL{};
+        bool allProcessorsMuted = false;
+
+        // Effective trim of the blended wet path, for delta-mode dry compensation
+        SampleType deltaTrimGain{};
+    };
+
+    // Which stages of processBlock run, decided once per parameter change
+    // instead of re-testing switches every block
+    struct RoutingPlan
+    {
+        bool bypass = false;
+        bool deltaMode = false;
+        bool agcEnabled = false;
+        bool midSide = false;                 // Channel mode 1: encode/decode M/S around processing
+        int processingMode = 0;
+        int oversamplingChoice = 0;           // 0 = engine default, 1..5 = 2x..32x
+        int clipAntiAliasOrder = ADAA::Off;   // Hard/soft clip ADAA order (0 = off)
+        std::array<int, numXYPaths> pathOversampling{};  // Per XY path: 0 = common rate, 1..5 = 1x..16x
+        bool limiterControlRate = false;      // Slow/fast limiter detection at the base rate
+        bool envelopeControlRate = false;     // Shared transient detection at the base rate
+        bool adaptiveOversampling = false;    // Idle the oversampled XY chain while it is linear
+        bool parallelPaths = false;           // Run the four XY paths on the worker pool
+        LinkGroups linkGroups = LinkGroups::All;  // Which channels CHANNEL_LINK links
+
+        bool overshootEnabled = false;
+        bool truePeakEnabled = false;         // Already gated off in Zero Latency mode
+        bool overshootDeltaMode = false;
+        bool truePeakDeltaMode = false;
+        bool combinedLimiters = false;        // Both limiters in one oversampling pass
+        bool runLimiters = false;
+        bool captureLimiterReference = false; // Main delta needs the pre-limiter signal
+    };
+
+    // Per micro-block state the output stages take over from the input stage
+    struct MicroBlockHandoff
+    {
+        RoutingPlan routing;                  // Plan the block was processed with
+        int processingMode = 0;               // Engine the block went through
+        int truePeakLookahead = 0;            // advancedTPLLookaheadSamples for that engine
+        float outputCeilingDB = 0.0f;
+        double inputGain = 0.0;               // Exact in either precision
+        double pristinePeak = 0.0;            // Stands in for the dry copy when there is none
+        bool deltaMode = false;
+        bool agcEnabled = false;
+        bool needsDry = false;                // The block's dry copy is valid
+        bool displayActive = false;
+        int numSamples = 0;                   // PIPELINED_ENGINE: length of the parked block
+        bool runOutputStages = false;         // PIPELINED_ENGINE: processMicroBlockInput() returned true
+    };
+
+    // Meter and AGC measurements accumulated between control-rate updates, so their
+    // ballistics (and atomic traffic) follow time rather than the host block size
+    struct ControlRateState
+    {
+        int samplesUntilUpdate = 0;
+        float inputPeakL = 0.0f, inputPeakR = 0.0f;
+        float outputPeakL = 0.0f, outputPeakR = 0.0f;
+        float transferPeak = 0.0f;
+
+        double agcInputSumSquares = 0.0, agcOutputSumSquares = 0.0;
+        int agcInputCount = 0, agcOutputCount = 0;
+
+        void clearWindow()
+        {
+            inputPeakL = inputPeakR = outputPeakL = outputPeakR = transferPeak = 0.0f;
+            agcInputSumSquares = agcOutputSumSquares = 0.0;
+            agcInputCount = agcOutputCount = 0;
+        }
+    };
+
+    // Constants of the slow/fast limiters and soft clip, recomputed only when their inputs change
+    struct SlowLimitCoefficients
+    {
+        double attackMs = -1.0, baseReleaseMs = -1.0, threshold = -1.0, effectiveRate = -1.0;  // Inputs
+        int controlDecimation = 0;                              // Input: oversampled samples per detector step
+        double detectorRate = 0.0;                              // effectiveRate / controlDecimation
+        double attackCoeff = 0.0, rmsCoeff = 0.0, peakCoeff = 0.0, crestSmoothCoeff = 0.0;
+        double kneeStart = 0.0, gainSmoothCoeff = 0.0;
+        double fastReleaseMinMs = 0.0, fastReleaseMaxMs = 0.0;  // Adaptive release ranges (scaled by LIMIT_REL)
+        double slowReleaseMinMs = 0.0, slowReleaseMaxMs = 0.0;
+    };
+
+    struct FastLimitCoefficients
+    {
+        double attackMs = -1.0, releaseMs = -1.0, effectiveRate = -1.0;  // Inputs
+        int controlDecimation = 0;                                        // Input: oversampled samples per detector step
+        double attackCoeff = 0.0, releaseCoeff = 0.0, gainSmoothCoeff = 0.0;
+    };
+
+    struct SoftClipCoefficients
+    {
+        double knee = -1.0;  // Input
+        double drive = 1.0, makeup = 1.0;
+    };
+
+    // PARALLEL_PATHS / PIPELINED_ENGINE: each worker pool only has threads while its switch
+    // is on. A change is handed to the message thread, which starts or stops the pool.
+    void parameterChanged(const juce::String& parameterID, float newValue) override;
+    void handleAsyncUpdate() override;
+    void updateWorkerPools();
+
+    // Copy all bound parameters into 'params' (start of every block); when anything
+    // changed, bumps parameterGeneration and rebuilds the routing plan
+    void readParameterSnapshot();
+    void updateRoutingPlan();
+
+    // Publish accumulated meter/AGC measurements once per controlRateSamples
+    // Returns true on blocks where an update happened
+    bool advanceControlRate(int numSamples);
+
+    // Derived values for the current snapshot, recomputing them if it changed
+    template<typename SampleType>
+    const DerivedParameters<SampleType>& updateDerivedParameters();
+
+    template<typename SampleType>
+    DerivedParameters<SampleType>& getDerivedParameters();
+
+    std::vector<std::pair<std::atomic<float>*, float ParameterSnapshot::*>> parameterBindings;
+    ParameterSnapshot params;
+    uint32_t parameterGeneration = 0;
+    RoutingPlan routing;
+    DerivedParameters<float> derivedParamsFloat;
+    DerivedParameters<double> derivedParamsDouble;
+    SlowLimitCoefficients slowLimitCoeffs;
+    FastLimitCoefficients fastLimitCoeffs;
+    SoftClipCoefficients softClipCoeffs;
+
+    ControlRateState controlRate;
+    int controlRateSamples = 480;    // ~10 ms at the base rate (set in prepareToPlay)
+
+    // Output tail for these release settings: latency plus the slowest release recovering 40 dB
+    double computeTailSeconds(double slowReleaseScaleMs, double fastReleaseMs) const;
+
+    // Silence gate: once the input has been silent for longer than the tail, the chain
+    // holds nothing but zeros and recovered envelopes, so blocks are written as silence
+    static constexpr double silenceThreshold = 1.0e-6;  // -120 dBFS at the output (scaled by the gains in front of it)
+    int silentInputSamples = 0;
+
+    // Per-channel processor state. Each struct holds only the hot per-sample
+    // scalars plus a view into delayMemory, and is cache-line aligned so one
+    // channel's state never shares a line with another channel or processor.
+
     // Lookahead buffer state for Hard Clip
-    struct HardClipState
+    struct alignas(64) HardClipState
     {
-        std::vector<double> lookaheadBuffer;
+        DelayLine lookaheadBuffer;
         int lookaheadWritePos{0};
-        // PolyBLEP state (for anti-aliasing only at discontinuities)
-        double lastSample{0.0};  // Previous input sample for crossing detection
+        int samplesSinceOver{0};  // Inputs since the last one above the threshold (sub-threshold fast path)
+        double countedThreshold{0.0};  // Threshold samplesSinceOver was last counted against
+        // ADAA history (used when clip anti-aliasing is enabled)
+        ADAA::State adaa;
         // Micro Clip Symmetry Restoration (DC blocker)
         double dcBlockerZ1{0.0};  // Previous input for DC blocker
         double dcBlockerZ2{0.0};  // Previous output for DC blocker
     };
-    HardClipState hardClipState[2];  // Per channel
+    HardClipState hardClipState[maxChannels];  // Per channel
 
     // Lookahead buffer state for Soft Clip
-    struct SoftClipState
+    struct alignas(64) SoftClipState
     {
-        std::vector<double> lookaheadBuffer;
+        DelayLine lookaheadBuffer;
         int lookaheadWritePos{0};
-        // ADAA state (Anti-Derivative Anti-Aliasing)
-        double x1{0.0};   // Previous input sample
-        double x2{0.0};   // Two samples ago (for 3rd order)
-        double F1{0.0};   // Antiderivative at x1
-        double F2{0.0};   // Antiderivative at x2 (for 3rd order)
+        // ADAA history (used when clip anti-aliasing is enabled)
+        ADAA::State adaa;
         // Micro Clip Symmetry Restoration (DC blocker)
         double dcBlockerZ1{0.0};  // Previous input for DC blocker
         double dcBlockerZ2{0.0};  // Previous output for DC blocker
     };
-    SoftClipState softClipState[2];  // Per channel
+    SoftClipState softClipState[maxChannels];  // Per channel
 
     // Limiter state for adaptive auto-release (Slow Limit)
-    struct SlowLimiterState
+    struct alignas(64) SlowLimiterState
     {
+        DelayLine lookaheadBuffer;
+        int lookaheadWritePos{0};
         double envelope{0.0};
         double adaptiveRelease{100.0};
         double rmsEnvelope{0.0};           // RMS tracking for crest factor
         double peakEnvelope{0.0};          // Peak tracking for crest factor
         double smoothedCrestFactor{1.0};   // Smoothed crest factor with exponential smoothing
-        std::vector<double> lookaheadBuffer;
-        int lookaheadWritePos{0};
         // Gain smoothing state (prevents control signal aliasing)
         double smoothedGain{1.0};          // Low-pass filtered gain reduction
+        double controlGain{1.0};           // Last control-rate target gain (LIMIT_CONTROL_RATE)
         // Micro Clip Symmetry Restoration (DC blocker)
         double dcBlockerZ1{0.0};  // Previous input for DC blocker
         double dcBlockerZ2{0.0};  // Previous output for DC blocker
     };
-    SlowLimiterState slowLimiterState[2];  // Per channel
+    SlowLimiterState slowLimiterState[maxChannels];  // Per channel
 
     // Limiter state for fast limiter (Hard Knee Fast Limiting)
-    struct FastLimiterState
+    struct alignas(64) FastLimiterState
     {
-        double envelope{0.0};
-        std::vector<double> lookaheadBuffer;
+        DelayLine lookaheadBuffer;
         int lookaheadWritePos{0};
+        double envelope{0.0};
         // Gain smoothing state (prevents control signal aliasing)
         double smoothedGain{1.0};          // Low-pass filtered gain reduction
+        double controlGain{1.0};           // Last control-rate target gain (LIMIT_CONTROL_RATE)
         // Micro Clip Symmetry Restoration (DC blocker)
         double dcBlockerZ1{0.0};  // Previous input for DC blocker
         double dcBlockerZ2{0.0};  // Previous output for DC blocker
     };
-    FastLimiterState fastLimiterState[2];  // Per channel
+    FastLimiterState fastLimiterState[maxChannels];  // Per channel
 
     // Protection limiter state (true-peak safety limiter at output)
-    struct ProtectionLimiterState
+    // Overshoot suppression is zero-latency, so there is no lookahead memory here
+    struct alignas(64) ProtectionLimiterState
     {
         double envelope{0.0};                    // Main gain reduction envelope
         double fastReleaseEnv{0.0};              // Fast release component
         double slowReleaseEnv{0.0};              // Slow release component
-        std::vector<double> lookaheadBuffer;     // 4ms lookahead buffer
-        int lookaheadWritePos{0};
-        // Oversampling buffers for true-peak detection (8x oversampling)
-        std::vector<double> oversampledBuffer;   // 8x oversampled signal
     };
-    ProtectionLimiterState protectionLimiterState[2];  // Per channel
+    ProtectionLimiterState protectionLimiterState[maxChannels];  // Per channel
 
     // Advanced True Peak Limiter state (with IRC - Intelligent Release Control)
-    struct AdvancedTPLState
+    struct alignas(64) AdvancedTPLState
     {
         // Lookahead buffer (1-3ms for peak prediction)
-        std::vector<double> lookaheadBuffer;
+        DelayLine lookaheadBuffer;
         int lookaheadWritePos{0};
 
         // Main GR envelope (smoothed)
@@ -404,53 +826,45 @@ private:
         double lowZ1{0.0}, lowZ2{0.0};
         double midZ1{0.0}, midZ2{0.0};
         double highZ1{0.0}, highZ2{0.0};
+    };
+    AdvancedTPLState advancedTPLState[maxChannels];  // Per channel
 
-        // Filter coefficients (set during prepareToPlay)
+    // IRC multiband filter coefficients (set during prepareToPlay, shared by both channels)
+    struct AdvancedTPLCoefficients
+    {
         double lowB0{1.0}, lowB1{0.0}, lowB2{0.0}, lowA1{0.0}, lowA2{0.0};
         double midB0{1.0}, midB1{0.0}, midB2{0.0}, midA1{0.0}, midA2{0.0};
         double highB0{1.0}, highB1{0.0}, highB2{0.0}, highA1{0.0}, highA2{0.0};
     };
-    AdvancedTPLState advancedTPLState[2];  // Per channel
+    AdvancedTPLCoefficients advancedTPLCoeffs;
 
-    // OSM Mode 0 delay compensation state (to match Mode 1 latency)
-    // When Mode 0 is active, this delay ensures constant plugin latency
-    struct OSMCompensationState
-    {
-        std::vector<double> delayBuffer;
-        int writePos{0};
-    };
-    OSMCompensationState osmCompensationState[2];  // Per channel
+    // Backing memory for every lookahead/delay line above (one allocation, sized in prepareToPlay)
+    DelayMemory delayMemory;
 
-    // Architecture A: Global oversampling manager (handles ALL 2-channel oversampling)
+    // Architecture A: Global oversampling manager for the XY blend (engine + OVERSAMPLING factor)
+    // Every bus channel's [wet, dry] pair goes through identical filters for phase coherence
     OversamplingManager osManager;
 
-    // 4-channel oversamplers for phase-coherent dry/wet processing
-    // Process [wetL, wetR, dryL, dryR] together through identical filters
-    // Balanced mode (8×)
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling4ChBalancedFloat;
-    std::unique_ptr<juce::dsp::Oversampling<double>> oversampling4ChBalancedDouble;
-    // Linear Phase mode (16×)
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling4ChLinearFloat;
-    std::unique_ptr<juce::dsp::Oversampling<double>> oversampling4ChLinearDouble;
-
-    // Delta mode 4-channel oversampler (for overshoot suppression delta mode)
-    // Uses 8× oversampling for [mainL, mainR, refL, refR] phase-coherent processing
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling4ChDeltaFloat;
-    std::unique_ptr<juce::dsp::Oversampling<double>> oversampling4ChDeltaDouble;
+    // Delta mode oversampler (for overshoot suppression delta mode)
+    // Uses 8× oversampling for [main..., ref...] phase-coherent processing (2 per bus channel)
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversamplingDeltaFloat;
+    std::unique_ptr<juce::dsp::Oversampling<double>> oversamplingDeltaDouble;
     // Delta mode 16× oversampler (for Linear Phase mode overshoot delta)
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling4ChDelta16xFloat;
-    std::unique_ptr<juce::dsp::Oversampling<double>> oversampling4ChDelta16xDouble;
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversamplingDelta16xFloat;
+    std::unique_ptr<juce::dsp::Oversampling<double>> oversamplingDelta16xDouble;
 
-    // 2-channel oversamplers for protection limiters (overshoot suppression, advanced TPL)
+    // Bus-wide oversamplers for protection limiters (overshoot suppression, advanced TPL)
     // Balanced mode (8×)
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling2ChBalancedFloat;
-    std::unique_ptr<juce::dsp::Oversampling<double>> oversampling2ChBalancedDouble;
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversamplingProtectionBalancedFloat;
+    std::unique_ptr<juce::dsp::Oversampling<double>> oversamplingProtectionBalancedDouble;
     // Linear Phase mode (16×)
-    std::unique_ptr<juce::dsp::Oversampling<float>> oversampling2ChLinearFloat;
-    std::unique_ptr<juce::dsp::Oversampling<double>> oversampling2ChLinearDouble;
+    std::unique_ptr<juce::dsp::Oversampling<float>> oversamplingProtectionLinearFloat;
+    std::unique_ptr<juce::dsp::Oversampling<double>> oversamplingProtectionLinearDouble;
 
     int lookaheadSamples{0};
     int advancedTPLLookaheadSamples{0};      // Lookahead for advanced TPL (1-3ms)
+    int outputLimiterMode{0};                // Engine and TPL lookahead of the block in the output
+    int outputLimiterLookahead{0};           // limiters (from its MicroBlockHandoff)
     int protectionLookaheadSamples{0};           // No longer used (overshoot suppression is zero-latency)
     int totalLatencySamples{0};                  // Total plugin latency REPORTED to DAW host
     int internalDryCompensationSamples{0};       // ACTUAL delay applied to dry signal for wet/dry phase alignment
@@ -464,10 +878,88 @@ private:
     // Dry signal delay compensation buffers (to match processing latency per mode)
     struct DryDelayState
     {
-        std::vector<double> delayBuffer;
+        DelayLine delayBuffer;
         int writePos{0};
     };
-    DryDelayState dryDelayState[2];  // Per channel
+    DryDelayState dryDelayState[maxChannels];  // Per channel
+
+    // Per-path rates inside the XY blend (HC/SC/SL/FL_OVERSAMPLING), see updateXYPathRates()
+    struct XYPathRate
+    {
+        int factorIndex{0};      // Path OS factor index (factor = 2^index, never above the common one)
+        int divisor{1};          // Common OS rate / path rate
+        int lookahead{0};        // Processor lookahead (samples at path rate)
+        int latency{0};          // Resampling round trip + lookahead (samples at common rate)
+        int alignDelay{0};       // Padding up to the common XY latency (samples at common rate)
+        DelayLine alignBuffer[maxChannels];
+        int alignWritePos[maxChannels]{};
+    };
+    XYPathRate xyPathRates[numXYPaths];
+    PathResampler xyPathResamplers[numXYPaths];
+    std::array<int, numXYPaths> xyPathChoices{};  // Choices the current layout was built for
+    int xyPathAlignment{0};  // Extra XY latency from per-path resampling (common-rate samples, whole base samples)
+
+    // ADAPTIVE_OS: while every XY path is in its linear region the oversampled engines skip
+    // the oversampler and run wet and dry through latency-matched delays instead (base
+    // rate). Leaving idle pre-rolls the chain from the delays' history and crossfades over
+    // one micro-block, before the louder input reaches the output.
+    struct AdaptiveOversamplingState
+    {
+        bool idle = false;
+        int quietSamples = 0;         // Consecutive base-rate samples the XY chain has been linear
+        int holdSamples = 0;          // Quiet time needed before idling (set in prepareToPlay)
+    };
+    AdaptiveOversamplingState adaptiveOs;
+    LatencyMatchedDelay adaptiveWetDelay, adaptiveDryDelay;
+
+    // PARALLEL_PATHS: shares the four XY paths of a block between the audio thread and up to
+    // three workers. Only blocks of at least minParallelPathSamples (OS rate) are shared out:
+    // a 64-sample base-rate micro-block is over before the workers could pick it up.
+    RealtimeWorkerPool xyWorkers;
+    static constexpr int minParallelPathSamples = 256;
+    std::atomic<float>* parallelPaths = nullptr;  // PARALLEL_PATHS, for updateWorkerPools()
+    bool workerPoolsPrepared = false;             // Between prepareToPlay and releaseResources
+
+    // PIPELINED_ENGINE: the input stage of one step (everything up to the mixed wet signal,
+    // at full oversampling) runs on the audio thread while one worker may take the output
+    // limiters of the previous step. Each step parks its micro-blocks in one of two banks in
+    // the scratch arena for the next one; the output stage then finishes them serially into
+    // a FIFO that delays the output by exactly one prepared host block.
+    struct PipelineState
+    {
+        int latency = 0;                      // Extra latency and longest step (0 = off)
+        int slicesPerBank = 0;                // Micro-blocks in one step
+        int inputBank = 0;                    // Bank the input stage fills; the other one drains
+        int numSlices[2] = {};
+        std::vector<MicroBlockHandoff> handoffs;  // [bank * slicesPerBank + slice]
+        int fifoRead = 0, fifoWrite = 0;
+        bool restart = true;                  // Start over from silence on the next block
+    };
+    PipelineState pipeline;
+    RealtimeWorkerPool pipelineWorkers;
+    int preparedBlockSize{0};                 // samplesPerBlock from prepareToPlay
+    std::atomic<float>* pipelinedEngine = nullptr;  // PIPELINED_ENGINE, read once per host block
+
+    // MONO DETECTION: when both channels are identical (wet and dry), or the side channel is
+    // silent in M/S, only the left side of the XY chain runs and the right output is copied
+    // from it (or zeroed). Mono starts once the condition has held for the tail, so both
+    // sides have converged. Leaving it copies the left processor state across and replays
+    // the right oversampler through what the left one was fed.
+    enum class MonoMode
+    {
+        Off,         // Both sides run
+        Identical,   // Right side would follow the left exactly
+        SilentSide   // M/S with a silent side: right wet side is zero, dry pair identical
+    };
+    struct MonoDetectionState
+    {
+        MonoMode active = MonoMode::Off;
+        MonoMode candidate = MonoMode::Off;
+        int candidateSamples = 0;  // Consecutive base-rate samples the candidate has held
+    };
+    MonoDetectionState monoDetection;
+    ChannelHistory monoInputHistory;  // Left [wet, dry] into the up filters (base rate)
+    ChannelHistory monoOsHistory;     // Left [wet, dry] into the down filters (OS rate)
 
     // Three-band filters for oscilloscope RGB visualization
     struct OscilloscopeBandFilters
@@ -495,44 +987,11 @@ private:
     std::atomic<float> agcInputRMS{0.0f};
     std::atomic<float> agcOutputRMS{0.0f};
     juce::SmoothedValue<float, juce::ValueSmoothingTypes::Multiplicative> smoothedAgcGain;
+    static constexpr double maxAgcGainDB = 12.0;  // AGC correction limit, either way
 
-    // Buffers for parallel processing (float)
-    juce::AudioBuffer<float> dryBufferFloat;
-    juce::AudioBuffer<float> tempBuffer1Float;
-    juce::AudioBuffer<float> tempBuffer2Float;
-    juce::AudioBuffer<float> tempBuffer3Float;
-    juce::AudioBuffer<float> tempBuffer4Float;
-    juce::AudioBuffer<float> combined4ChFloat;  // For phase-coherent dry/wet processing
-    juce::AudioBuffer<float> originalInputBufferFloat;  // Pristine input before any gains
-    juce::AudioBuffer<float> protectionDeltaCombined4ChFloat;  // Pre-allocated for overshoot delta mode
-
-    // === DRIVE VISUALIZER LAYER BUFFERS ===
-    // Temporary storage for per-layer contributions at base sample rate
-    // Populated during processBlock, read during display buffer write
-    juce::AudioBuffer<float> layerInputFloat;        // Input signal (after input gain)
-    juce::AudioBuffer<float> layerHardClipFloat;     // HC contribution (weighted)
-    juce::AudioBuffer<float> layerSoftClipFloat;     // SC contribution (weighted)
-    juce::AudioBuffer<float> layerSlowLimitFloat;    // SL contribution (weighted)
-    juce::AudioBuffer<float> layerFastLimitFloat;    // FL contribution (weighted)
-    juce::AudioBuffer<float> layerFinalOutputFloat;  // Final output (after output gain)
-
-    // Buffers for parallel processing (double)
-    juce::AudioBuffer<double> dryBufferDouble;
-    juce::AudioBuffer<double> tempBuffer1Double;
-    juce::AudioBuffer<double> tempBuffer2Double;
-    juce::AudioBuffer<double> tempBuffer3Double;
-    juce::AudioBuffer<double> tempBuffer4Double;
-    juce::AudioBuffer<double> combined4ChDouble;  // For phase-coherent dry/wet processing
-    juce::AudioBuffer<double> originalInputBufferDouble;  // Pristine input before any gains
-    juce::AudioBuffer<double> protectionDeltaCombined4ChDouble;  // Pre-allocated for overshoot delta mode
-
-    // === DRIVE VISUALIZER LAYER BUFFERS (DOUBLE PRECISION) ===
-    juce::AudioBuffer<double> layerInputDouble;
-    juce::AudioBuffer<double> layerHardClipDouble;
-    juce::AudioBuffer<double> layerSoftClipDouble;
-    juce::AudioBuffer<double> layerSlowLimitDouble;
-    juce::AudioBuffer<double> layerFastLimitDouble;
-    juce::AudioBuffer<double> layerFinalOutputDouble;
+    // Per-block scratch (dry copy, XY paths, limiter references):
+    // one aligned allocation for the active precision, sized in prepareToPlay
+    ScratchArena scratch;
 
     // Normalization state variables (use double precision for peak detection)
     double peakInputLevel{0.0};
@@ -546,11 +1005,15 @@ private:
     // Preset storage (A, B, C, D)
     juce::ValueTree presetSlots[4];
 
-    // Envelope shapers for pre-drive transient/sustain shaping (one per drive type)
+    // Envelope shapers for pre-drive transient/sustain shaping (one per drive type).
+    // All four listen to the same signal, so they share one transient detector and
+    // each only maps its transientness to its own attack/sustain gain.
+    TransientDetector xyTransientDetector;
     EnvelopeShaper hardClipShaper;
     EnvelopeShaper softClipShaper;
     EnvelopeShaper slowLimitShaper;
     EnvelopeShaper fastLimitShaper;
+    juce::AudioBuffer<float> envelopeScratch;  // [transientness, shaper gain] at the OS rate
 
     // === SAMPLE-ACCURATE PER-PROCESSOR ENVELOPE FOLLOWERS ===
     // For smooth GR visualization at base rate
@@ -0,0 +1,104 @@
+#include "RefreshScheduler.h"
+#include <algorithm>
+
+RefreshScheduler::RefreshScheduler(QuadBlendDriveAudioProcessor& p, juce::Component& hostComponent)
+    : processor(p),
+      host(hostComponent),
+      vblankAttachment(&hostComponent, [this](double timestampSec) { onVBlank(timestampSec); })
+{
+}
+
+void RefreshScheduler::addClient(Client& client, juce::Component& component, double rateHz)
+{
+    jassert(rateHz > 0.0);
+    removeClient(client);
+    clients.push_back({ &client, &component, 1000.0 / rateHz, 0.0 });
+}
+
+void RefreshScheduler::removeClient(Client& client)
+{
+    clients.erase(std::remove_if(clients.begin(), clients.end(),
+                                 [&client](const Entry& e) { return e.client == &client; }),
+                  clients.end());
+}
+
+void RefreshScheduler::onVBlank(double timestampSec)
+{
+    const double nowMs = timestampSec * 1000.0;
+    const double frameIntervalMs = lastVBlankMs > 0.0 ? nowMs - lastVBlankMs : 0.0;
+    lastVBlankMs = nowMs;
+
+    // Window minimised or not on screen: nothing to draw
+    if (!host.isShowing())
+        return;
+
+    if (auto* peer = host.getPeer())
+        if (peer->isMinimised())
+            return;
+
+    // Background host: halve rates on top of any load-based throttling
+    const int effectiveThrottle = throttleFactor * (juce::Process::isForegroundProcess() ? 1 : 2);
+
+    const double dispatchStart = juce::Time::getMillisecondCounterHiRes();
+    bool snapshotTaken = false;
+
+    for (auto& entry : clients)
+    {
+        if (nowMs - entry.lastRefreshMs < entry.intervalMs * effectiveThrottle - intervalToleranceMs)
+            continue;
+
+        // Hidden or collapsed components are skipped entirely
+        if (!entry.component->isShowing() || entry.component->getLocalBounds().isEmpty())
+            continue;
+
+        if (!snapshotTaken)
+        {
+            captureSnapshot(nowMs);
+            snapshotTaken = true;
+        }
+
+        entry.lastRefreshMs = nowMs;
+        entry.client->refresh(snapshot);
+    }
+
+    updateThrottle(frameIntervalMs, juce::Time::getMillisecondCounterHiRes() - dispatchStart);
+}
+
+void RefreshScheduler::captureSnapshot(double nowMs)
+{
+    snapshot.inputPeakL = processor.getInputPeakL();
+    snapshot.inputPeakR = processor.getInputPeakR();
+    snapshot.outputPeakL = processor.getOutputPeakL();
+    snapshot.outputPeakR = processor.getOutputPeakR();
+    snapshot.transferCurvePeak = processor.getCurrentPeakNormalized();
+
+    snapshot.hardClipGR = processor.currentHardClipGR.load();
+    snapshot.softClipGR = processor.currentSoftClipGR.load();
+    snapshot.slowLimitGR = processor.currentSlowLimitGR.load();
+    snapshot.fastLimitGR = processor.currentFastLimitGR.load();
+
+    snapshot.inputPeakDB = processor.currentPeakDB.load();
+    snapshot.normalizationGainDB = processor.normalizationGainDB.load();
+
+    snapshot.timeMs = nowMs;
+}
+
+void RefreshScheduler::updateThrottle(double frameIntervalMs, double dispatchMs)
+{
+    // Late vblanks mean the message thread is saturated (host busy, many editors open);
+    // an over-budget dispatch means our own drawing work is the problem. Either way back off.
+    // (A gap of over a second is the display resuming after being idle, not load.)
+    const bool lateFrame = frameIntervalMs > lateFrameMs && frameIntervalMs < 1000.0;
+    const bool overloaded = lateFrame || dispatchMs > dispatchBudgetMs;
+
+    if (overloaded)
+    {
+        throttleFactor = juce::jmin(maxThrottleFactor, throttleFactor + 1);
+        framesWithinBudget = 0;
+    }
+    else if (throttleFactor > 1 && ++framesWithinBudget >= recoveryFrames)
+    {
+        --throttleFactor;
+        framesWithinBudget = 0;
+    }
+}
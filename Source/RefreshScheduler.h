@@ -0,0 +1,97 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <vector>
+#include "PluginProcessor.h"
+
+//==============================================================================
+// Meter values captured once per display frame, so every component painting
+// in that frame sees the same consistent set of processor atomics
+//==============================================================================
+struct MeterSnapshot
+{
+    float inputPeakL = 0.0f;            // Input peak (linear, 0-2)
+    float inputPeakR = 0.0f;
+    float outputPeakL = 0.0f;           // Output peak (linear, 0-2)
+    float outputPeakR = 0.0f;
+    float transferCurvePeak = 0.0f;     // Normalized 0-1 peak for transfer curve meter
+
+    float hardClipGR = 0.0f;            // Per-processor gain reduction (dB)
+    float softClipGR = 0.0f;
+    float slowLimitGR = 0.0f;
+    float fastLimitGR = 0.0f;
+
+    double inputPeakDB = -120.0;        // Calibration: learned input peak
+    double normalizationGainDB = 0.0;   // Calibration: normalization gain applied
+
+    double timeMs = 0.0;                // Frame timestamp (ms)
+};
+
+//==============================================================================
+// Refresh Scheduler
+//
+// Single display-synced driver for all GUI animation, replacing per-component
+// timers. On each vertical blank it:
+// - pulls one MeterSnapshot from the processor
+// - dispatches to registered clients whose component is actually showing,
+//   each at its own target rate (aligned to the vblank)
+// - throttles all rates when the window is minimised/hidden, the host is not
+//   the foreground process, or frames arrive late / dispatch runs over budget
+//
+// Clients decide themselves which regions to repaint.
+//==============================================================================
+class RefreshScheduler
+{
+public:
+    class Client
+    {
+    public:
+        virtual ~Client() = default;
+
+        // Called on the message thread at (up to) the client's registered rate
+        virtual void refresh(const MeterSnapshot& snapshot) = 0;
+    };
+
+    RefreshScheduler(QuadBlendDriveAudioProcessor& p, juce::Component& host);
+
+    // Register a client; it is only refreshed while component.isShowing()
+    void addClient(Client& client, juce::Component& component, double rateHz);
+    void removeClient(Client& client);
+
+    const MeterSnapshot& getSnapshot() const { return snapshot; }
+    int getThrottleFactor() const { return throttleFactor; }
+
+private:
+    void onVBlank(double timestampSec);
+    void captureSnapshot(double nowMs);
+    void updateThrottle(double frameIntervalMs, double dispatchMs);
+
+    struct Entry
+    {
+        Client* client = nullptr;
+        juce::Component* component = nullptr;
+        double intervalMs = 0.0;
+        double lastRefreshMs = 0.0;
+    };
+
+    QuadBlendDriveAudioProcessor& processor;
+    juce::Component& host;
+
+    std::vector<Entry> clients;
+    MeterSnapshot snapshot;
+
+    // Throttling
+    double lastVBlankMs = 0.0;
+    int throttleFactor = 1;                 // Multiplies every client's refresh interval (1-4)
+    int framesWithinBudget = 0;             // Consecutive healthy frames (for recovery)
+    static constexpr int maxThrottleFactor = 4;
+    static constexpr double lateFrameMs = 50.0;        // Vblank gap that indicates a saturated message thread
+    static constexpr double dispatchBudgetMs = 6.0;    // Max GUI work per frame before backing off
+    static constexpr int recoveryFrames = 60;          // Healthy frames before stepping back up
+    static constexpr double intervalToleranceMs = 4.0; // Absorbs vblank jitter so 60 Hz clients don't drop frames
+
+    // Declared last: detached first on destruction, before anything it calls into
+    juce::VBlankAttachment vblankAttachment;
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(RefreshScheduler)
+};
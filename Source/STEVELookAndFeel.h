@@ -1,6 +1,7 @@
 #pragma once
 
 #include <juce_gui_basics/juce_gui_basics.h>
+#include <unordered_map>
 
 /**
  * @brief Professional mastering-grade look and feel for Emulsion
@@ -64,16 +65,239 @@ public:
                           float sliderPosProportional, float rotaryStartAngle,
                           float rotaryEndAngle, juce::Slider& slider) override
     {
-        const float radius = juce::jmin(width / 2.0f, height / 2.0f) - 8.0f;
-        const float centreX = x + width * 0.5f;
-        const float centreY = y + height * 0.5f;
-        const float angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
-
         // Get accent color - use slider's thumbColourId if set, otherwise default accentBlue
         juce::Colour arcColour = slider.isColourSpecified(juce::Slider::thumbColourId)
             ? slider.findColour(juce::Slider::thumbColourId)
             : juce::Colour(accentBlue);
 
+        // Quantise so a knob sweep reuses a bounded set of images (sub-pixel at any sane size)
+        const int valueStep = juce::roundToInt(juce::jlimit(0.0f, 1.0f, sliderPosProportional) * rotaryValueSteps);
+        const float quantisedPos = static_cast<float>(valueStep) / rotaryValueSteps;
+
+        const auto key = makeCacheKey(ControlType::rotarySlider, arcColour, valueStep,
+                                      juce::roundToInt(rotaryStartAngle * 1000.0f),
+                                      juce::roundToInt(rotaryEndAngle * 1000.0f));
+
+        drawCached(g, { x, y, width, height }, 2, key, [&](juce::Graphics& ig)
+        {
+            renderRotarySlider(ig, width, height, quantisedPos, rotaryStartAngle, rotaryEndAngle, arcColour);
+        });
+    }
+
+    void drawLinearSlider(juce::Graphics& g, int x, int y, int width, int height,
+                          float sliderPos, float minSliderPos, float maxSliderPos,
+                          juce::Slider::SliderStyle style, juce::Slider& slider) override
+    {
+        if (style == juce::Slider::LinearHorizontal || style == juce::Slider::LinearVertical)
+        {
+            // Get accent color - use slider's thumbColourId if set, otherwise default accentBlue
+            juce::Colour fillColour = slider.isColourSpecified(juce::Slider::thumbColourId)
+                ? slider.findColour(juce::Slider::thumbColourId)
+                : juce::Colour(accentBlue);
+
+            // Thumb position relative to the slider area, in quarter pixels
+            const bool isHorizontal = style == juce::Slider::LinearHorizontal;
+            const int posStep = juce::roundToInt((sliderPos - static_cast<float>(isHorizontal ? x : y)) * 4.0f);
+            const float localPos = static_cast<float>(posStep) * 0.25f;
+
+            const auto key = makeCacheKey(isHorizontal ? ControlType::linearHorizontal : ControlType::linearVertical,
+                                          fillColour, posStep);
+
+            // Thumb overhangs the track area by up to half its size
+            drawCached(g, { x, y, width, height }, 8, key, [&](juce::Graphics& ig)
+            {
+                renderLinearSlider(ig, width, height, localPos, isHorizontal, fillColour);
+            });
+        }
+        else
+        {
+            LookAndFeel_V4::drawLinearSlider(g, x, y, width, height, sliderPos, minSliderPos, maxSliderPos, style, slider);
+        }
+    }
+
+    void drawComboBox(juce::Graphics& g, int width, int height, bool,
+                      int buttonX, int buttonY, int buttonW, int buttonH,
+                      juce::ComboBox& box) override
+    {
+        auto bounds = juce::Rectangle<int>(0, 0, width, height).toFloat();
+
+        // Background
+        g.setColour(box.findColour(juce::ComboBox::backgroundColourId));
+        g.fillRoundedRectangle(bounds, 3.0f);
+
+        // Outline
+        g.setColour(box.findColour(juce::ComboBox::outlineColourId));
+        g.drawRoundedRectangle(bounds.reduced(0.5f), 3.0f, 1.0f);
+
+        // Arrow
+        auto arrowZone = juce::Rectangle<int>(buttonX, buttonY, buttonW, buttonH).toFloat();
+        juce::Path path;
+        path.startNewSubPath(arrowZone.getX() + 3.0f, arrowZone.getCentreY() - 2.0f);
+        path.lineTo(arrowZone.getCentreX(), arrowZone.getCentreY() + 2.0f);
+        path.lineTo(arrowZone.getRight() - 3.0f, arrowZone.getCentreY() - 2.0f);
+
+        g.setColour(box.findColour(juce::ComboBox::arrowColourId));
+        g.strokePath(path, juce::PathStrokeType(2.0f));
+    }
+
+    void drawButtonBackground(juce::Graphics& g, juce::Button& button, const juce::Colour& backgroundColour,
+                              bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown) override
+    {
+        const auto key = makeCacheKey(ControlType::buttonBackground, backgroundColour,
+                                      (shouldDrawButtonAsHighlighted ? 1 : 0) | (shouldDrawButtonAsDown ? 2 : 0));
+
+        drawCached(g, button.getLocalBounds(), 0, key, [&](juce::Graphics& ig)
+        {
+            renderButtonBackground(ig, button.getLocalBounds().toFloat().reduced(0.5f), backgroundColour,
+                                   shouldDrawButtonAsHighlighted, shouldDrawButtonAsDown);
+        });
+    }
+
+    void drawToggleButton(juce::Graphics& g, juce::ToggleButton& button,
+                          bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown) override
+    {
+        juce::ignoreUnused(shouldDrawButtonAsDown);
+
+        // Get the button's tick color - check if a custom color was set on this specific button
+        // If yes, use it; otherwise fall back to default accent blue
+        juce::Colour tickColour = button.isColourSpecified(juce::ToggleButton::tickColourId)
+            ? button.findColour(juce::ToggleButton::tickColourId)
+            : juce::Colour(accentBlue);
+
+        const auto buttonText = button.getButtonText();
+        const bool isOn = button.getToggleState();
+
+        const auto key = makeCacheKey(ControlType::toggleButton, tickColour,
+                                      (isOn ? 1 : 0) | (shouldDrawButtonAsHighlighted ? 2 : 0),
+                                      static_cast<int>(buttonText.hashCode()));
+
+        drawCached(g, button.getLocalBounds(), 0, key, [&](juce::Graphics& ig)
+        {
+            renderToggleButton(ig, button.getLocalBounds().toFloat(), buttonText, isOn,
+                               shouldDrawButtonAsHighlighted, tickColour);
+        });
+    }
+
+    juce::Label* createSliderTextBox(juce::Slider& slider) override
+    {
+        auto* label = LookAndFeel_V4::createSliderTextBox(slider);
+
+        label->setColour(juce::Label::textColourId, juce::Colour(textPrimary));
+        label->setColour(juce::Label::backgroundColourId, juce::Colour(backgroundPanel));
+        label->setColour(juce::Label::outlineColourId, juce::Colour(outlineSubtle));
+        label->setFont(juce::FontOptions(13.0f, juce::Font::plain));
+        label->setJustificationType(juce::Justification::centred);
+
+        return label;
+    }
+
+    // Helper method to get processor colors for GR visualization
+    static juce::Colour getProcessorColor(int processorIndex, bool multiColorMode = true)
+    {
+        if (multiColorMode)
+        {
+            switch (processorIndex)
+            {
+                case 0: return juce::Colour(0xffff5050);  // Hard Clip - red
+                case 1: return juce::Colour(0xffff963c);  // Soft Clip - orange
+                case 2: return juce::Colour(0xffffdc50);  // Slow Limit - yellow
+                case 3: return juce::Colour(0xff50a0ff);  // Fast Limit - blue
+                default: return juce::Colour(accentBlue);
+            }
+        }
+        else
+        {
+            return juce::Colour(accentBlue);  // Unified accent color
+        }
+    }
+
+private:
+    //==============================================================================
+    // Control image cache
+    //
+    // Each control is rendered once per (type, size, pixel scale, quantised value,
+    // colour, state) into an image at physical resolution; subsequent repaints of
+    // the same state are a single blit. The cache is dropped wholesale when it
+    // grows past its pixel budget (e.g. after resizing through many sizes).
+    //==============================================================================
+    enum class ControlType
+    {
+        rotarySlider,
+        linearHorizontal,
+        linearVertical,
+        buttonBackground,
+        toggleButton
+    };
+
+    static constexpr float rotaryValueSteps = 1024.0f;
+    static constexpr int64_t maxCachedPixels = 4 * 1024 * 1024;    // ~16 MB of ARGB
+
+    static uint64_t hashCombine(uint64_t seed, uint64_t value)
+    {
+        return seed ^ (value + 0x9e3779b97f4a7c15ull + (seed << 6) + (seed >> 2));
+    }
+
+    static uint64_t makeCacheKey(ControlType type, juce::Colour colour, int value, int extraA = 0, int extraB = 0)
+    {
+        uint64_t key = static_cast<uint64_t>(type);
+        key = hashCombine(key, colour.getARGB());
+        key = hashCombine(key, static_cast<uint32_t>(value));
+        key = hashCombine(key, static_cast<uint32_t>(extraA));
+        key = hashCombine(key, static_cast<uint32_t>(extraB));
+        return key;
+    }
+
+    // Blit the cached image for 'key' into 'area', rendering it first if needed.
+    // 'render' draws in area-local coordinates; 'padding' covers overhang outside the area.
+    template <typename RenderFunction>
+    void drawCached(juce::Graphics& g, juce::Rectangle<int> area, int padding, uint64_t key, RenderFunction&& render)
+    {
+        if (area.isEmpty())
+            return;
+
+        const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+        const auto imageArea = area.expanded(padding);
+
+        key = hashCombine(key, static_cast<uint32_t>(area.getWidth()));
+        key = hashCombine(key, static_cast<uint32_t>(area.getHeight()));
+        key = hashCombine(key, static_cast<uint32_t>(padding));
+        key = hashCombine(key, static_cast<uint32_t>(juce::roundToInt(scale * 100.0f)));
+
+        auto it = imageCache.find(key);
+        if (it == imageCache.end())
+        {
+            const int imageWidth = juce::roundToInt(static_cast<float>(imageArea.getWidth()) * scale);
+            const int imageHeight = juce::roundToInt(static_cast<float>(imageArea.getHeight()) * scale);
+
+            if (cachedPixels + static_cast<int64_t>(imageWidth) * imageHeight > maxCachedPixels)
+            {
+                imageCache.clear();
+                cachedPixels = 0;
+            }
+
+            juce::Image image(juce::Image::ARGB, juce::jmax(1, imageWidth), juce::jmax(1, imageHeight), true);
+            {
+                juce::Graphics ig(image);
+                ig.addTransform(juce::AffineTransform::translation(static_cast<float>(padding), static_cast<float>(padding))
+                                    .scaled(scale));
+                render(ig);
+            }
+
+            cachedPixels += static_cast<int64_t>(image.getWidth()) * image.getHeight();
+            it = imageCache.emplace(key, std::move(image)).first;
+        }
+
+        g.drawImage(it->second, imageArea.toFloat());
+    }
+
+    void renderRotarySlider(juce::Graphics& g, int width, int height, float sliderPosProportional,
+                            float rotaryStartAngle, float rotaryEndAngle, juce::Colour arcColour)
+    {
+        const float radius = juce::jmin(width / 2.0f, height / 2.0f) - 8.0f;
+        const float centreX = width * 0.5f;
+        const float centreY = height * 0.5f;
+        const float angle = rotaryStartAngle + sliderPosProportional * (rotaryEndAngle - rotaryStartAngle);
+
         // Outer ring (track)
         juce::Path trackPath;
         trackPath.addCentredArc(centreX, centreY, radius, radius,
@@ -137,104 +361,64 @@ public:
         }
     }
 
-    void drawLinearSlider(juce::Graphics& g, int x, int y, int width, int height,
-                          float sliderPos, float minSliderPos, float maxSliderPos,
-                          juce::Slider::SliderStyle style, juce::Slider& slider) override
-    {
-        if (style == juce::Slider::LinearHorizontal || style == juce::Slider::LinearVertical)
-        {
-            const bool isHorizontal = style == juce::Slider::LinearHorizontal;
-            const float trackThickness = 4.0f;
 
-            // Get accent color - use slider's thumbColourId if set, otherwise default accentBlue
-            juce::Colour fillColour = slider.isColourSpecified(juce::Slider::thumbColourId)
-                ? slider.findColour(juce::Slider::thumbColourId)
-                : juce::Colour(accentBlue);
-
-            juce::Rectangle<float> track;
-            if (isHorizontal)
-            {
-                track = juce::Rectangle<float>(static_cast<float>(x), static_cast<float>(y) + height * 0.5f - trackThickness * 0.5f,
-                                               static_cast<float>(width), trackThickness);
-            }
-            else
-            {
-                track = juce::Rectangle<float>(static_cast<float>(x) + width * 0.5f - trackThickness * 0.5f,
-                                               static_cast<float>(y), trackThickness, static_cast<float>(height));
-            }
-
-            // Track background
-            g.setColour(juce::Colour(0xff202020));
-            g.fillRoundedRectangle(track, 2.0f);
-
-            // Value fill
-            juce::Rectangle<float> fill;
-            if (isHorizontal)
-            {
-                fill = juce::Rectangle<float>(track.getX(), track.getY(),
-                                              sliderPos - track.getX(), track.getHeight());
-            }
-            else
-            {
-                fill = juce::Rectangle<float>(track.getX(), sliderPos,
-                                              track.getWidth(), track.getBottom() - sliderPos);
-            }
-
-            g.setColour(fillColour);
-            g.fillRoundedRectangle(fill, 2.0f);
+    void renderLinearSlider(juce::Graphics& g, int width, int height, float sliderPos,
+                            bool isHorizontal, juce::Colour fillColour)
+    {
+        const float trackThickness = 4.0f;
 
-            // Thumb
-            const float thumbSize = 14.0f;
-            juce::Point<float> thumbPos;
-            if (isHorizontal)
-                thumbPos = { sliderPos, track.getCentreY() };
-            else
-                thumbPos = { track.getCentreX(), sliderPos };
+        juce::Rectangle<float> track;
+        if (isHorizontal)
+        {
+            track = juce::Rectangle<float>(0.0f, height * 0.5f - trackThickness * 0.5f,
+                                           static_cast<float>(width), trackThickness);
+        }
+        else
+        {
+            track = juce::Rectangle<float>(width * 0.5f - trackThickness * 0.5f,
+                                           0.0f, trackThickness, static_cast<float>(height));
+        }
 
-            g.setColour(juce::Colour(textPrimary));
-            g.fillEllipse(thumbPos.x - thumbSize * 0.5f, thumbPos.y - thumbSize * 0.5f,
-                         thumbSize, thumbSize);
+        // Track background
+        g.setColour(juce::Colour(0xff202020));
+        g.fillRoundedRectangle(track, 2.0f);
 
-            g.setColour(juce::Colour(outline));
-            g.drawEllipse(thumbPos.x - thumbSize * 0.5f, thumbPos.y - thumbSize * 0.5f,
-                         thumbSize, thumbSize, 1.5f);
+        // Value fill
+        juce::Rectangle<float> fill;
+        if (isHorizontal)
+        {
+            fill = juce::Rectangle<float>(track.getX(), track.getY(),
+                                          sliderPos - track.getX(), track.getHeight());
         }
         else
         {
-            LookAndFeel_V4::drawLinearSlider(g, x, y, width, height, sliderPos, minSliderPos, maxSliderPos, style, slider);
+            fill = juce::Rectangle<float>(track.getX(), sliderPos,
+                                          track.getWidth(), track.getBottom() - sliderPos);
         }
-    }
 
-    void drawComboBox(juce::Graphics& g, int width, int height, bool,
-                      int buttonX, int buttonY, int buttonW, int buttonH,
-                      juce::ComboBox& box) override
-    {
-        auto bounds = juce::Rectangle<int>(0, 0, width, height).toFloat();
-
-        // Background
-        g.setColour(box.findColour(juce::ComboBox::backgroundColourId));
-        g.fillRoundedRectangle(bounds, 3.0f);
+        g.setColour(fillColour);
+        g.fillRoundedRectangle(fill, 2.0f);
 
-        // Outline
-        g.setColour(box.findColour(juce::ComboBox::outlineColourId));
-        g.drawRoundedRectangle(bounds.reduced(0.5f), 3.0f, 1.0f);
+        // Thumb
+        const float thumbSize = 14.0f;
+        juce::Point<float> thumbPos;
+        if (isHorizontal)
+            thumbPos = { sliderPos, track.getCentreY() };
+        else
+            thumbPos = { track.getCentreX(), sliderPos };
 
-        // Arrow
-        auto arrowZone = juce::Rectangle<int>(buttonX, buttonY, buttonW, buttonH).toFloat();
-        juce::Path path;
-        path.startNewSubPath(arrowZone.getX() + 3.0f, arrowZone.getCentreY() - 2.0f);
-        path.lineTo(arrowZone.getCentreX(), arrowZone.getCentreY() + 2.0f);
-        path.lineTo(arrowZone.getRight() - 3.0f, arrowZone.getCentreY() - 2.0f);
+        g.setColour(juce::Colour(textPrimary));
+        g.fillEllipse(thumbPos.x - thumbSize * 0.5f, thumbPos.y - thumbSize * 0.5f,
+                     thumbSize, thumbSize);
 
-        g.setColour(box.findColour(juce::ComboBox::arrowColourId));
-        g.strokePath(path, juce::PathStrokeType(2.0f));
+        g.setColour(juce::Colour(outline));
+        g.drawEllipse(thumbPos.x - thumbSize * 0.5f, thumbPos.y - thumbSize * 0.5f,
+                     thumbSize, thumbSize, 1.5f);
     }
 
-    void drawButtonBackground(juce::Graphics& g, juce::Button& button, const juce::Colour& backgroundColour,
-                              bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown) override
+    void renderButtonBackground(juce::Graphics& g, juce::Rectangle<float> bounds, juce::Colour backgroundColour,
+                                bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown)
     {
-        auto bounds = button.getLocalBounds().toFloat().reduced(0.5f);
-
         juce::Colour baseColour = backgroundColour;
 
         if (shouldDrawButtonAsDown)
@@ -249,23 +433,9 @@ public:
         g.drawRoundedRectangle(bounds, 4.0f, 1.0f);
     }
 
-    void drawToggleButton(juce::Graphics& g, juce::ToggleButton& button,
-                          bool shouldDrawButtonAsHighlighted, bool shouldDrawButtonAsDown) override
+    void renderToggleButton(juce::Graphics& g, juce::Rectangle<float> bounds, const juce::String& buttonText,
+                            bool isOn, bool shouldDrawButtonAsHighlighted, juce::Colour tickColour)
     {
-        juce::ignoreUnused(shouldDrawButtonAsDown);
-        auto bounds = button.getLocalBounds().toFloat();
-        auto buttonText = button.getButtonText();
-
-        // Get the button's tick color - check if a custom color was set on this specific button
-        // If yes, use it; otherwise fall back to default accent blue
-        juce::Colour tickColour = button.isColourSpecified(juce::ToggleButton::tickColourId)
-            ? button.findColour(juce::ToggleButton::tickColourId)
-            : juce::Colour(accentBlue);
-
-        juce::Colour offColour = button.isColourSpecified(juce::ToggleButton::tickDisabledColourId)
-            ? button.findColour(juce::ToggleButton::tickDisabledColourId)
-            : juce::Colour(backgroundPanel);
-
         // Check if this is a single-letter M or S button (mute/solo style)
         bool isMuteOrSoloButton = (buttonText == "M" || buttonText == "S");
 
@@ -275,7 +445,7 @@ public:
             auto buttonBounds = bounds.reduced(1.0f);
 
             // Background - clearly different between ON and OFF states
-            if (button.getToggleState())
+            if (isOn)
             {
                 // ON: Fully filled with the tick color
                 g.setColour(tickColour);
@@ -296,7 +466,7 @@ public:
             }
 
             // Outline - more prominent when OFF to show button boundary
-            if (button.getToggleState())
+            if (isOn)
                 g.setColour(tickColour.brighter(0.2f));
             else if (shouldDrawButtonAsHighlighted)
                 g.setColour(tickColour.withAlpha(0.6f));
@@ -305,7 +475,7 @@ public:
             g.drawRoundedRectangle(buttonBounds, 3.0f, 1.0f);
 
             // Text - white/bright on active, dimmed on inactive
-            if (button.getToggleState())
+            if (isOn)
                 g.setColour(juce::Colours::white);
             else
                 g.setColour(juce::Colour(0xff808080));  // Gray when OFF
@@ -323,7 +493,7 @@ public:
                                               tickSize, tickSize);
 
             // Background - use tick color when on for filled button effect
-            if (button.getToggleState())
+            if (isOn)
             {
                 g.setColour(tickColour.withAlpha(0.2f));
                 g.fillRoundedRectangle(tickBounds, 3.0f);
@@ -335,7 +505,7 @@ public:
             }
 
             // Outline - use tick color when on or highlighted
-            if (button.getToggleState())
+            if (isOn)
                 g.setColour(tickColour);
             else if (shouldDrawButtonAsHighlighted)
                 g.setColour(tickColour.withAlpha(0.6f));
@@ -344,7 +514,7 @@ public:
             g.drawRoundedRectangle(tickBounds, 3.0f, 1.0f);
 
             // Checkmark - use button's tick color
-            if (button.getToggleState())
+            if (isOn)
             {
                 g.setColour(tickColour);
                 juce::Path tick;
@@ -355,7 +525,7 @@ public:
             }
 
             // Label - use tick color when on
-            g.setColour(button.getToggleState() ? tickColour : juce::Colour(textPrimary));
+            g.setColour(isOn ? tickColour : juce::Colour(textPrimary));
             g.drawFittedText(buttonText,
                             juce::Rectangle<int>(static_cast<int>(tickBounds.getRight() + 6.0f),
                                                 static_cast<int>(bounds.getY()),
@@ -365,36 +535,6 @@ public:
         }
     }
 
-    juce::Label* createSliderTextBox(juce::Slider& slider) override
-    {
-        auto* label = LookAndFeel_V4::createSliderTextBox(slider);
-
-        label->setColour(juce::Label::textColourId, juce::Colour(textPrimary));
-        label->setColour(juce::Label::backgroundColourId, juce::Colour(backgroundPanel));
-        label->setColour(juce::Label::outlineColourId, juce::Colour(outlineSubtle));
-        label->setFont(juce::FontOptions(13.0f, juce::Font::plain));
-        label->setJustificationType(juce::Justification::centred);
-
-        return label;
-    }
-
-    // Helper method to get processor colors for GR visualization
-    static juce::Colour getProcessorColor(int processorIndex, bool multiColorMode = true)
-    {
-        if (multiColorMode)
-        {
-            switch (processorIndex)
-            {
-                case 0: return juce::Colour(0xffff5050);  // Hard Clip - red
-                case 1: return juce::Colour(0xffff963c);  // Soft Clip - orange
-                case 2: return juce::Colour(0xffffdc50);  // Slow Limit - yellow
-                case 3: return juce::Colour(0xff50a0ff);  // Fast Limit - blue
-                default: return juce::Colour(accentBlue);
-            }
-        }
-        else
-        {
-            return juce::Colour(accentBlue);  // Unified accent color
-        }
-    }
+    std::unordered_map<uint64_t, juce::Image> imageCache;
+    int64_t cachedPixels = 0;
 };
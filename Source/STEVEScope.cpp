@@ -4,16 +4,77 @@
 STEVEScope::STEVEScope(QuadBlendDriveAudioProcessor& p)
     : processor(p)
 {
-    startTimerHz(30);  // 30fps for smooth animation
+    // Refreshed at 30fps by the editor's RefreshScheduler
 }
 
 STEVEScope::~STEVEScope()
 {
-    stopTimer();
 }
 
 void STEVEScope::paint(juce::Graphics& g)
 {
+    // Layers are rendered at the physical pixel density of the target context
+    updateLayers(g.getInternalContext().getPhysicalPixelScaleFactor());
+
+    // Composite: cached background (incl. grid, threshold, border), then the scrolling waveform/GR layer
+    if (backgroundLayer.isValid())
+        g.drawImage(backgroundLayer, getLocalBounds().toFloat());
+
+    if (waveformLayer.isValid())
+        g.drawImage(waveformLayer, graphBounds);
+
+    paintPlayhead(g, graphBounds);
+}
+
+void STEVEScope::invalidateLayers()
+{
+    backgroundLayerValid = false;
+    waveformLayerValid = false;
+    repaint();
+}
+
+void STEVEScope::updateLayers(float scale)
+{
+    const int width = juce::roundToInt(static_cast<float>(getWidth()) * scale);
+    const int height = juce::roundToInt(static_cast<float>(getHeight()) * scale);
+    const int graphWidth = juce::roundToInt(graphBounds.getWidth() * scale);
+    const int graphHeight = juce::roundToInt(graphBounds.getHeight() * scale);
+
+    if (width <= 0 || height <= 0 || graphWidth <= 0 || graphHeight <= 0)
+        return;
+
+    if (scale != layerScale || backgroundLayer.getWidth() != width || backgroundLayer.getHeight() != height)
+    {
+        layerScale = scale;
+        backgroundLayer = juce::Image(juce::Image::ARGB, width, height, true);
+        waveformLayer = juce::Image(juce::Image::ARGB, graphWidth, graphHeight, true);
+        backgroundLayerValid = false;
+        waveformLayerValid = false;
+    }
+
+    if (!backgroundLayerValid)
+        renderBackgroundLayer();
+
+    if (!waveformLayerValid)
+    {
+        layerNumSegments = getVisibleSegmentCount();
+        layerThresholdDb = getThresholdDb();
+        lastSegmentsWritten = processor.decimatedSegmentsWritten;
+        pendingScrollPixels = 0.0f;
+
+        waveformLayer.clear(waveformLayer.getBounds());
+        renderWaveformColumns(0, waveformLayer.getWidth());
+        waveformLayerValid = true;
+    }
+}
+
+void STEVEScope::renderBackgroundLayer()
+{
+    backgroundLayer.clear(backgroundLayer.getBounds());
+
+    juce::Graphics g(backgroundLayer);
+    g.addTransform(juce::AffineTransform::scale(layerScale));
+
     auto bounds = getLocalBounds().toFloat();
 
     // Background
@@ -23,19 +84,93 @@ void STEVEScope::paint(juce::Graphics& g)
     // Settings button (gear icon in upper right) - no title bar to avoid overlap with ADVANCED button
     paintSettingsButton(g);
 
-    // Graph area - use full height since no title bar
-    graphBounds = bounds.reduced(8.0f, 8.0f);
-
-    // Draw components
+    // Grid, threshold line and labels
+    layerThresholdDb = getThresholdDb();
     paintGrid(g, graphBounds);
-    paintWaveform(g, graphBounds);
-    if (showGRTraces)
-        paintGRTraces(g, graphBounds);
-    paintPlayhead(g, graphBounds);
 
     // Border
     g.setColour(juce::Colour(0xff404040));
-    g.drawRoundedRectangle(getLocalBounds().toFloat().reduced(0.5f), 4.0f, 1.0f);
+    g.drawRoundedRectangle(bounds.reduced(0.5f), 4.0f, 1.0f);
+
+    backgroundLayerValid = true;
+}
+
+void STEVEScope::renderWaveformColumns(int firstColumn, int endColumn)
+{
+    if (!processor.decimatedDisplayReady.load() || !waveformLayer.isValid())
+        return;
+
+    firstColumn = juce::jmax(0, firstColumn);
+    endColumn = juce::jmin(waveformLayer.getWidth(), endColumn);
+    if (firstColumn >= endColumn)
+        return;
+
+    juce::Graphics g(waveformLayer);
+    g.reduceClipRegion(firstColumn, 0, endColumn - firstColumn, waveformLayer.getHeight());
+
+    paintWaveform(g, firstColumn, endColumn);
+    if (showGRTraces)
+        paintGRTraces(g, firstColumn, endColumn);
+}
+
+void STEVEScope::scrollWaveformLayer(int segmentsAdvanced)
+{
+    const int layerWidth = waveformLayer.getWidth();
+    const int layerHeight = waveformLayer.getHeight();
+
+    if (segmentsAdvanced >= layerNumSegments)
+    {
+        waveformLayerValid = false;
+        return;
+    }
+
+    pendingScrollPixels += static_cast<float>(segmentsAdvanced) * static_cast<float>(layerWidth)
+                         / static_cast<float>(layerNumSegments);
+    const int shift = static_cast<int>(pendingScrollPixels);
+    pendingScrollPixels -= static_cast<float>(shift);
+
+    if (shift >= layerWidth)
+    {
+        waveformLayerValid = false;
+        return;
+    }
+
+    if (shift > 0)
+    {
+        waveformLayer.moveImageSection(0, 0, shift, 0, layerWidth - shift, layerHeight);
+        waveformLayer.clear({ layerWidth - shift, 0, shift, layerHeight });
+    }
+
+    // Newly exposed columns, plus the previous newest column which may have been partial
+    const int firstColumn = layerWidth - shift - 1;
+    waveformLayer.clear({ juce::jmax(0, firstColumn), 0, 1, layerHeight });
+    renderWaveformColumns(firstColumn, layerWidth);
+}
+
+void STEVEScope::redrawFrozenSegments(int firstSegment, int lastSegment)
+{
+    const int layerWidth = waveformLayer.getWidth();
+    const int firstColumn = (firstSegment * layerWidth) / layerNumSegments;
+    const int endColumn = ((lastSegment + 1) * layerWidth + layerNumSegments - 1) / layerNumSegments;
+
+    waveformLayer.clear({ firstColumn, 0, endColumn - firstColumn, waveformLayer.getHeight() });
+    renderWaveformColumns(firstColumn, endColumn);
+}
+
+int STEVEScope::getVisibleSegmentCount() const
+{
+    // Zoom based on time base: the decimated buffer spans 4096ms
+    const int totalSegments = QuadBlendDriveAudioProcessor::decimatedDisplaySize;
+    constexpr float bufferDurationMs = 4096.0f;
+    float timeBaseDurationMs = getTimeBaseDurationSeconds() * 1000.0f;
+    float zoomRatio = juce::jlimit(0.1f, 1.0f, timeBaseDurationMs / bufferDurationMs);
+    int numSegments = static_cast<int>(totalSegments * zoomRatio);
+    return juce::jlimit(32, totalSegments, numSegments);
+}
+
+float STEVEScope::getThresholdDb() const
+{
+    return processor.apvts.getRawParameterValue("THRESHOLD")->load();
 }
 
 void STEVEScope::paintGrid(juce::Graphics& g, juce::Rectangle<float> bounds)
@@ -105,7 +240,7 @@ void STEVEScope::paintGrid(juce::Graphics& g, juce::Rectangle<float> bounds)
     }
 
     // Threshold line
-    float thresholdDb = processor.apvts.getRawParameterValue("THRESHOLD")->load();
+    float thresholdDb = layerThresholdDb;
     float threshNorm = (thresholdDb + 60.0f) / 66.0f;  // -60 to +6 range
     threshNorm = juce::jlimit(0.0f, 1.0f, threshNorm);
     float threshY = bounds.getBottom() - threshNorm * bounds.getHeight();
@@ -120,11 +255,8 @@ void STEVEScope::paintGrid(juce::Graphics& g, juce::Rectangle<float> bounds)
     g.drawText(threshLabel, bounds.getX() + 4.0f, threshY - 12.0f, 50.0f, 12.0f, juce::Justification::left);
 }
 
-void STEVEScope::paintWaveform(juce::Graphics& g, juce::Rectangle<float> bounds)
+STEVEScope::ColumnData STEVEScope::getColumnData(int column, int numColumns) const
 {
-    const float centerY = bounds.getCentreY();
-    const float halfHeight = bounds.getHeight() * 0.4f;  // 80% of height for waveform
-
     // Helper lambda to apply scale (linear or log)
     auto applyScale = [this](float value) -> float
     {
@@ -145,25 +277,6 @@ void STEVEScope::paintWaveform(juce::Graphics& g, juce::Rectangle<float> bounds)
         return (value >= 0.0f) ? normalized : -normalized;
     };
 
-    // ============ COMMON RENDERING ============
-    if (!processor.decimatedDisplayReady.load())
-        return;
-
-    // Always read from decimatedDisplay - the live data source
-    const auto& decimated = processor.decimatedDisplay;
-    const int totalSegments = QuadBlendDriveAudioProcessor::decimatedDisplaySize;
-
-    // Calculate zoom based on time base
-    constexpr float bufferDurationMs = 4096.0f;
-    float timeBaseDurationMs = getTimeBaseDurationSeconds() * 1000.0f;
-
-    float zoomRatio = juce::jlimit(0.1f, 1.0f, timeBaseDurationMs / bufferDurationMs);
-    int numSegments = static_cast<int>(totalSegments * zoomRatio);
-    numSegments = juce::jlimit(32, totalSegments, numSegments);
-
-    int startSegment = totalSegments - numSegments;
-    const float segmentWidth = bounds.getWidth() / static_cast<float>(numSegments);
-
     // Helper lambda to get waveform value based on channel mode
     auto getWaveformValues = [this](const QuadBlendDriveAudioProcessor::DecimatedSegment& seg, float& outMin, float& outMax)
     {
@@ -206,88 +319,86 @@ void STEVEScope::paintWaveform(juce::Graphics& g, juce::Rectangle<float> bounds)
     // Helper to get the segment data for a display position
     // In scroll mode: read from live decimatedDisplay buffer (linear, newest on right)
     // In playhead mode: read from frozenDisplay buffer (data frozen as playhead passed)
+    const int numSegments = layerNumSegments;
+    const int startSegment = QuadBlendDriveAudioProcessor::decimatedDisplaySize - numSegments;
     auto getSegment = [&](int displayIdx) -> const QuadBlendDriveAudioProcessor::DecimatedSegment&
     {
         if (scrollEnabled)
-        {
-            // Scroll mode: direct linear mapping from live buffer
-            return decimated[startSegment + displayIdx];
-        }
-        else
-        {
-            // Playhead mode: read from frozen buffer
-            // The frozenDisplay contains data that was captured as the playhead swept past
-            int idx = juce::jlimit(0, frozenBufferSize - 1, displayIdx);
-            return frozenDisplay[idx];
-        }
+            return processor.decimatedDisplay[startSegment + displayIdx];
+
+        int idx = juce::jlimit(0, frozenBufferSize - 1, displayIdx);
+        return frozenDisplay[idx];
     };
 
-    // Build waveform path (min/max envelope)
-    juce::Path waveformPath;
+    // Segments covered by this pixel column (at least one when zoomed in past 1 segment/pixel)
+    const int firstSeg = juce::jlimit(0, numSegments - 1, (column * numSegments) / numColumns);
+    const int endSeg = juce::jlimit(firstSeg + 1, numSegments, ((column + 1) * numSegments) / numColumns);
 
-    // First pass: top envelope (max values)
-    for (int i = 0; i < numSegments; ++i)
+    ColumnData data;
+    for (int i = firstSeg; i < endSeg; ++i)
     {
         const auto& seg = getSegment(i);
-        float waveMin, waveMax;
-        getWaveformValues(seg, waveMin, waveMax);
-        waveMax = applyScale(waveMax);
-
-        float x = bounds.getX() + i * segmentWidth;
-        float y = centerY - waveMax * halfHeight;
-        y = juce::jlimit(bounds.getY(), bounds.getBottom(), y);
 
-        if (i == 0)
-            waveformPath.startNewSubPath(x, y);
-        else
-            waveformPath.lineTo(x, y);
-    }
-
-    // Second pass: bottom envelope (min values, reversed)
-    for (int i = numSegments - 1; i >= 0; --i)
-    {
-        const auto& seg = getSegment(i);
         float waveMin, waveMax;
         getWaveformValues(seg, waveMin, waveMax);
         waveMin = applyScale(waveMin);
+        waveMax = applyScale(waveMax);
 
-        float x = bounds.getX() + i * segmentWidth;
-        float y = centerY - waveMin * halfHeight;
-        y = juce::jlimit(bounds.getY(), bounds.getBottom(), y);
-        waveformPath.lineTo(x, y);
+        data.waveMin = (i == firstSeg) ? waveMin : juce::jmin(data.waveMin, waveMin);
+        data.waveMax = (i == firstSeg) ? waveMax : juce::jmax(data.waveMax, waveMax);
+        data.low += seg.avgLow;
+        data.mid += seg.avgMid;
+        data.high += seg.avgHigh;
+
+        // GR uses max (most reduction)
+        data.grTotal = juce::jmax(data.grTotal, std::abs(seg.grMax));
+        data.grProcessor[0] = juce::jmax(data.grProcessor[0], std::abs(seg.hardClipGRMax));
+        data.grProcessor[1] = juce::jmax(data.grProcessor[1], std::abs(seg.softClipGRMax));
+        data.grProcessor[2] = juce::jmax(data.grProcessor[2], std::abs(seg.slowLimitGRMax));
+        data.grProcessor[3] = juce::jmax(data.grProcessor[3], std::abs(seg.fastLimitGRMax));
     }
 
-    waveformPath.closeSubPath();
+    const float count = static_cast<float>(endSeg - firstSeg);
+    data.low /= count;
+    data.mid /= count;
+    data.high /= count;
 
-    // Draw filled waveform with frequency-based coloring if enabled
-    if (showFrequencyBands)
-    {
-        // Per-segment frequency coloring - original approach with full brightness
-        // Draw at pixel resolution for smoothness
-        const int pixelWidth = static_cast<int>(bounds.getWidth());
-        const int drawSteps = juce::jmax(pixelWidth, numSegments * 2);
-        const float stepWidth = bounds.getWidth() / static_cast<float>(drawSteps);
+    return data;
+}
 
-        for (int step = 0; step < drawSteps; ++step)
-        {
-            // Map step to segment index
-            int segIdx = (step * numSegments) / drawSteps;
-            segIdx = juce::jlimit(0, numSegments - 1, segIdx);
+void STEVEScope::paintWaveform(juce::Graphics& g, int firstColumn, int endColumn)
+{
+    // Draws into the waveform layer (physical pixels, one column per pixel)
+    const int numColumns = waveformLayer.getWidth();
+    const float layerHeight = static_cast<float>(waveformLayer.getHeight());
+    const float centerY = layerHeight * 0.5f;
+    const float halfHeight = layerHeight * 0.4f;  // 80% of height for waveform
 
-            const auto& seg = getSegment(segIdx);
+    auto toY = [&](float value)
+    {
+        return juce::jlimit(0.0f, layerHeight, centerY - value * halfHeight);
+    };
 
-            float waveMin, waveMax;
-            getWaveformValues(seg, waveMin, waveMax);
-            waveMax = applyScale(waveMax);
-            waveMin = applyScale(waveMin);
+    float prevTopY = 0.0f, prevBottomY = 0.0f;
+    if (!showFrequencyBands && firstColumn > 0)
+    {
+        const auto prev = getColumnData(firstColumn - 1, numColumns);
+        prevTopY = toY(prev.waveMax);
+        prevBottomY = toY(prev.waveMin);
+    }
 
-            float x = bounds.getX() + step * stepWidth;
+    for (int column = firstColumn; column < endColumn; ++column)
+    {
+        const auto data = getColumnData(column, numColumns);
+        const float x = static_cast<float>(column);
 
+        if (showFrequencyBands)
+        {
             // RGB from frequency bands - use higher color scale for full brightness
             float colorScale = 6.0f;  // Boosted for visibility
-            uint8_t red = static_cast<uint8_t>(juce::jlimit(0.0f, 255.0f, seg.avgLow * colorScale * 255.0f));
-            uint8_t green = static_cast<uint8_t>(juce::jlimit(0.0f, 255.0f, seg.avgMid * colorScale * 255.0f));
-            uint8_t blue = static_cast<uint8_t>(juce::jlimit(0.0f, 255.0f, seg.avgHigh * colorScale * 255.0f));
+            uint8_t red = static_cast<uint8_t>(juce::jlimit(0.0f, 255.0f, data.low * colorScale * 255.0f));
+            uint8_t green = static_cast<uint8_t>(juce::jlimit(0.0f, 255.0f, data.mid * colorScale * 255.0f));
+            uint8_t blue = static_cast<uint8_t>(juce::jlimit(0.0f, 255.0f, data.high * colorScale * 255.0f));
 
             // Ensure minimum brightness - boost all channels if too dark
             uint8_t maxChannel = juce::jmax(red, juce::jmax(green, blue));
@@ -303,168 +414,109 @@ void STEVEScope::paintWaveform(juce::Graphics& g, juce::Rectangle<float> bounds)
                 red = green = blue = 60;  // Silent - dim grey
             }
 
-            juce::Colour segmentColor(red, green, blue);
-            g.setColour(segmentColor);
+            g.setColour(juce::Colour(red, green, blue));
 
             // Draw positive half: from center up to max peak
-            if (waveMax > 0.0f)
+            if (data.waveMax > 0.0f)
             {
-                float peakY = centerY - waveMax * halfHeight;
-                peakY = juce::jlimit(bounds.getY(), centerY, peakY);
+                float peakY = juce::jmin(centerY, toY(data.waveMax));
                 float height = centerY - peakY;
                 if (height > 0.5f)
-                    g.fillRect(x, peakY, stepWidth + 0.5f, height);
+                    g.fillRect(x, peakY, 1.0f, height);
             }
 
             // Draw negative half: from center down to min trough
-            if (waveMin < 0.0f)
+            if (data.waveMin < 0.0f)
             {
-                float troughY = centerY - waveMin * halfHeight;
-                troughY = juce::jlimit(centerY, bounds.getBottom(), troughY);
+                float troughY = juce::jmax(centerY, toY(data.waveMin));
                 float height = troughY - centerY;
                 if (height > 0.5f)
-                    g.fillRect(x, centerY, stepWidth + 0.5f, height);
+                    g.fillRect(x, centerY, 1.0f, height);
             }
         }
-    }
-    else
-    {
-        // Solid green waveform
-        g.setColour(juce::Colour(WAVEFORM_COLOR).withAlpha(0.6f));
-        g.fillPath(waveformPath);
+        else
+        {
+            // Solid green waveform: min/max fill with an outlined envelope
+            const float topY = toY(data.waveMax);
+            const float bottomY = toY(data.waveMin);
 
-        g.setColour(juce::Colour(WAVEFORM_COLOR));
-        g.strokePath(waveformPath, juce::PathStrokeType(1.5f));
+            g.setColour(juce::Colour(WAVEFORM_COLOR).withAlpha(0.6f));
+            g.fillRect(x, topY, 1.0f, juce::jmax(0.0f, bottomY - topY));
+
+            if (column > 0)
+            {
+                g.setColour(juce::Colour(WAVEFORM_COLOR));
+                g.drawLine(x - 0.5f, prevTopY, x + 0.5f, topY, 1.5f * layerScale);
+                g.drawLine(x - 0.5f, prevBottomY, x + 0.5f, bottomY, 1.5f * layerScale);
+            }
+
+            prevTopY = topY;
+            prevBottomY = bottomY;
+        }
     }
 }
 
-void STEVEScope::paintGRTraces(juce::Graphics& g, juce::Rectangle<float> bounds)
+void STEVEScope::paintGRTraces(juce::Graphics& g, int firstColumn, int endColumn)
 {
+    // Draws into the waveform layer (physical pixels, one column per pixel)
+    const int numColumns = waveformLayer.getWidth();
+    const float layerHeight = static_cast<float>(waveformLayer.getHeight());
+
     // GR display range
     const float maxGRdB = 24.0f;  // Max GR depth to display
-    const float grScale = bounds.getHeight() * 0.3f / maxGRdB;  // 30% of height for GR
+    const float grScale = layerHeight * 0.3f / maxGRdB;  // 30% of height for GR
 
-    // Get threshold position for GR baseline
-    float thresholdDb = processor.apvts.getRawParameterValue("THRESHOLD")->load();
-    float threshNorm = (thresholdDb + 60.0f) / 66.0f;
+    // Threshold position for GR baseline
+    float threshNorm = (layerThresholdDb + 60.0f) / 66.0f;
     threshNorm = juce::jlimit(0.0f, 1.0f, threshNorm);
-    float baselineY = bounds.getBottom() - threshNorm * bounds.getHeight();
+    const float baselineY = layerHeight - threshNorm * layerHeight;
 
-    // ============ COMMON RENDERING ============
-    if (!processor.decimatedDisplayReady.load())
-        return;
+    // GR hangs down from threshold
+    auto toY = [&](float grDb)
+    {
+        return juce::jmin(baselineY + juce::jmin(grDb, maxGRdB) * grScale, layerHeight);
+    };
 
-    // Read from live decimatedDisplay for scroll mode
-    const auto& decimated = processor.decimatedDisplay;
-    const int totalSegments = QuadBlendDriveAudioProcessor::decimatedDisplaySize;
+    const float strokeWidth = 1.5f * layerScale;
 
-    // Calculate zoom based on time base
-    constexpr float bufferDurationMs = 4096.0f;
-    float timeBaseDurationMs = getTimeBaseDurationSeconds() * 1000.0f;
-    float zoomRatio = juce::jlimit(0.1f, 1.0f, timeBaseDurationMs / bufferDurationMs);
-    int numSegments = static_cast<int>(totalSegments * zoomRatio);
-    numSegments = juce::jlimit(32, totalSegments, numSegments);
-    int startSegment = totalSegments - numSegments;
+    ColumnData prev;
+    bool hasPrev = firstColumn > 0;
+    if (hasPrev)
+        prev = getColumnData(firstColumn - 1, numColumns);
 
-    const float segmentWidth = bounds.getWidth() / static_cast<float>(numSegments);
-
-    // Helper to get the segment data for a display position
-    // In scroll mode: read from live decimatedDisplay buffer (linear, newest on right)
-    // In playhead mode: read from frozenDisplay buffer (data frozen as playhead passed)
-    auto getSegment = [&](int displayIdx) -> const QuadBlendDriveAudioProcessor::DecimatedSegment&
+    for (int column = firstColumn; column < endColumn; ++column)
     {
-        if (scrollEnabled)
-        {
-            // Scroll mode: direct linear mapping from live buffer
-            return decimated[startSegment + displayIdx];
-        }
-        else
-        {
-            // Playhead mode: read from frozen buffer
-            int idx = juce::jlimit(0, frozenBufferSize - 1, displayIdx);
-            return frozenDisplay[idx];
-        }
-    };
+        const auto data = getColumnData(column, numColumns);
+        const float x = static_cast<float>(column);
 
-    if (useMultiColorGR)
-    {
-        // Draw per-processor GR traces
-        struct ProcessorTrace {
-            uint32_t color;
-            float (QuadBlendDriveAudioProcessor::DecimatedSegment::*grMin);
-            float (QuadBlendDriveAudioProcessor::DecimatedSegment::*grMax);
-        };
-
-        ProcessorTrace traces[] = {
-            { HC_COLOR, &QuadBlendDriveAudioProcessor::DecimatedSegment::hardClipGRMin, &QuadBlendDriveAudioProcessor::DecimatedSegment::hardClipGRMax },
-            { SC_COLOR, &QuadBlendDriveAudioProcessor::DecimatedSegment::softClipGRMin, &QuadBlendDriveAudioProcessor::DecimatedSegment::softClipGRMax },
-            { SL_COLOR, &QuadBlendDriveAudioProcessor::DecimatedSegment::slowLimitGRMin, &QuadBlendDriveAudioProcessor::DecimatedSegment::slowLimitGRMax },
-            { FL_COLOR, &QuadBlendDriveAudioProcessor::DecimatedSegment::fastLimitGRMin, &QuadBlendDriveAudioProcessor::DecimatedSegment::fastLimitGRMax }
-        };
-
-        for (const auto& trace : traces)
+        if (useMultiColorGR)
         {
-            juce::Path grPath;
-            bool pathStarted = false;
+            // Per-processor GR traces
+            const uint32_t colors[] = { HC_COLOR, SC_COLOR, SL_COLOR, FL_COLOR };
 
-            for (int i = 0; i < numSegments; ++i)
+            if (hasPrev)
             {
-                const auto& seg = getSegment(i);
-                float x = bounds.getX() + i * segmentWidth;
-                float grDb = std::abs(seg.*trace.grMax);  // Use max (most reduction)
-                grDb = juce::jmin(grDb, maxGRdB);
-
-                float grY = baselineY + grDb * grScale;  // GR hangs down from threshold
-                grY = juce::jmin(grY, bounds.getBottom());
-
-                if (!pathStarted)
-                {
-                    grPath.startNewSubPath(x, grY);
-                    pathStarted = true;
-                }
-                else
+                for (int p = 0; p < 4; ++p)
                 {
-                    grPath.lineTo(x, grY);
+                    g.setColour(juce::Colour(colors[p]).withAlpha(0.6f));
+                    g.drawLine(x - 0.5f, toY(prev.grProcessor[p]), x + 0.5f, toY(data.grProcessor[p]), strokeWidth);
                 }
             }
-
-            // Stroke the GR trace
-            g.setColour(juce::Colour(trace.color).withAlpha(0.6f));
-            g.strokePath(grPath, juce::PathStrokeType(1.5f));
         }
-    }
-    else
-    {
-        // Unified GR trace (combined reduction)
-        juce::Path grPath;
-        grPath.startNewSubPath(bounds.getX(), baselineY);
-
-        for (int i = 0; i < numSegments; ++i)
+        else
         {
-            const auto& seg = getSegment(i);
-            float x = bounds.getX() + i * segmentWidth;
+            // Unified GR trace (combined reduction): semi-transparent fill plus outline
+            const float grY = toY(data.grTotal);
 
-            // Use total GR from the segment
-            float grDb = std::abs(seg.grMax);
-            grDb = juce::jmin(grDb, maxGRdB);
+            g.setColour(juce::Colour(UNIFIED_GR_COLOR).withAlpha(0.3f));
+            g.fillRect(x, baselineY, 1.0f, grY - baselineY);
 
-            float grY = baselineY + grDb * grScale;
-            grY = juce::jmin(grY, bounds.getBottom());
-
-            grPath.lineTo(x, grY);
+            g.setColour(juce::Colour(UNIFIED_GR_COLOR).withAlpha(0.8f));
+            g.drawLine(x - 0.5f, hasPrev ? toY(prev.grTotal) : baselineY, x + 0.5f, grY, strokeWidth);
         }
 
-        // Close path back to baseline
-        grPath.lineTo(bounds.getRight(), baselineY);
-        grPath.closeSubPath();
-
-        // Fill with semi-transparent
-        g.setColour(juce::Colour(UNIFIED_GR_COLOR).withAlpha(0.3f));
-        g.fillPath(grPath);
-
-        // Stroke outline
-        g.setColour(juce::Colour(UNIFIED_GR_COLOR).withAlpha(0.8f));
-        g.strokePath(grPath, juce::PathStrokeType(1.5f));
+        prev = data;
+        hasPrev = true;
     }
 }
 
@@ -483,14 +535,19 @@ void STEVEScope::paintPlayhead(juce::Graphics& g, juce::Rectangle<float> bounds)
 
 void STEVEScope::resized()
 {
-    graphBounds = getLocalBounds().toFloat().reduced(8.0f).withTrimmedTop(20.0f);
+    // Graph area - use full height since no title bar
+    graphBounds = getLocalBounds().toFloat().reduced(8.0f, 8.0f);
 
     // Position settings button in upper right corner
     auto bounds = getLocalBounds().toFloat();
     settingsButtonBounds = juce::Rectangle<float>(bounds.getRight() - 24.0f, bounds.getY() + 2.0f, 20.0f, 16.0f);
+
+    // Layers are reallocated at the new size on the next paint
+    layerScale = 0.0f;
+    invalidateLayers();
 }
 
-void STEVEScope::timerCallback()
+void STEVEScope::refresh(const MeterSnapshot&)
 {
     // Update decimated display cache from high-resolution ring buffer
     processor.updateDecimatedDisplay();
@@ -498,18 +555,20 @@ void STEVEScope::timerCallback()
     // Update display frames based on current tempo and time base
     updateDisplayFrames();
 
+    // Zoom (time base / tempo) or threshold moved: grid and GR baseline must be redrawn
+    const int numSegments = getVisibleSegmentCount();
+    const float thresholdDb = getThresholdDb();
+    if (numSegments != layerNumSegments || thresholdDb != layerThresholdDb)
+    {
+        backgroundLayerValid = false;
+        waveformLayerValid = false;
+    }
+
     if (!scrollEnabled)
     {
         // PLAYHEAD MODE: Sync to DAW transport PPQ position
         // The playhead position is derived from DAW's beat position
-
-        // Calculate zoom settings
         const int totalSegments = QuadBlendDriveAudioProcessor::decimatedDisplaySize;
-        constexpr float bufferDurationMs = 4096.0f;
-        float timeBaseDurationMs = getTimeBaseDurationSeconds() * 1000.0f;
-        float zoomRatio = juce::jlimit(0.1f, 1.0f, timeBaseDurationMs / bufferDurationMs);
-        int numSegments = static_cast<int>(totalSegments * zoomRatio);
-        numSegments = juce::jlimit(32, totalSegments, numSegments);
 
         // Get playhead position from DAW PPQ (beat position)
         // PPQ = pulses per quarter note, essentially beat position
@@ -545,6 +604,7 @@ void STEVEScope::timerCallback()
             lastSegment = playheadSegment;  // First frame or wrap reset
 
         // Copy segments from last position to current position
+        int dirtyFirst = playheadSegment, dirtyLast = playheadSegment;
         if (playheadSegment >= lastSegment)
         {
             // Normal forward sweep
@@ -555,6 +615,7 @@ void STEVEScope::timerCallback()
                 sourceIdx = juce::jlimit(0, totalSegments - 1, sourceIdx);
                 frozenDisplay[i] = decimated[sourceIdx];
             }
+            dirtyFirst = lastSegment;
         }
         else if (!wrapped)
         {
@@ -568,14 +629,41 @@ void STEVEScope::timerCallback()
         lastPlayheadDisplaySegment = playheadSegment;
         currentNumSegments = numSegments;
         currentStartSegment = startSegment;
+
+        // Only the swept columns of the waveform layer change
+        if (waveformLayerValid)
+            redrawFrozenSegments(dirtyFirst, dirtyLast);
+
+        // Playhead cursor moves every frame
+        if (backgroundLayerValid)
+            repaint(graphBounds.toNearestInt().expanded(1));
+        else
+            repaint();
+        return;
     }
-    else
+
+    // SCROLL MODE: Just advance frame counter (for animations if any)
+    displayCursorPos = (displayCursorPos + 1) % displayFrames;
+
+    // Shift the waveform layer by however far the data moved since the last frame
+    const auto segmentsWritten = processor.decimatedSegmentsWritten;
+    const auto segmentsAdvanced = segmentsWritten - lastSegmentsWritten;
+    lastSegmentsWritten = segmentsWritten;
+
+    if (!backgroundLayerValid)
     {
-        // SCROLL MODE: Just advance frame counter (for animations if any)
-        displayCursorPos = (displayCursorPos + 1) % displayFrames;
+        repaint();
     }
-
-    repaint();
+    else if (!waveformLayerValid)
+    {
+        repaint(graphBounds.toNearestInt());
+    }
+    else if (segmentsAdvanced > 0)
+    {
+        scrollWaveformLayer(static_cast<int>(juce::jmin<uint64_t>(segmentsAdvanced, static_cast<uint64_t>(numSegments))));
+        repaint(graphBounds.toNearestInt());
+    }
+    // Nothing new (transport stopped / display frozen): no repaint needed
 }
 
 void STEVEScope::updateFrozenDisplay()
@@ -594,18 +682,9 @@ void STEVEScope::updateFrozenDisplay()
     if (!processor.decimatedDisplayReady.load())
         return;
 
-    const int totalSegments = QuadBlendDriveAudioProcessor::decimatedDisplaySize;
-
-    // Calculate zoom based on time base
-    constexpr float bufferDurationMs = 4096.0f;
-    float timeBaseDurationMs = getTimeBaseDurationSeconds() * 1000.0f;
-    float zoomRatio = juce::jlimit(0.1f, 1.0f, timeBaseDurationMs / bufferDurationMs);
-    int numSegments = static_cast<int>(totalSegments * zoomRatio);
-    numSegments = juce::jlimit(32, totalSegments, numSegments);
-
     // Store current zoom settings for rendering
-    currentNumSegments = numSegments;
-    currentStartSegment = totalSegments - numSegments;
+    currentNumSegments = getVisibleSegmentCount();
+    currentStartSegment = QuadBlendDriveAudioProcessor::decimatedDisplaySize - currentNumSegments;
 }
 
 void STEVEScope::paintSettingsButton(juce::Graphics& g)
@@ -823,7 +902,7 @@ void STEVEScope::showSettingsMenu()
                 default:
                     break;
             }
-            repaint();
+            invalidateLayers();
         });
 }
 
@@ -847,7 +926,7 @@ void STEVEScope::mouseDown(const juce::MouseEvent& e)
     if (e.mods.isShiftDown())
     {
         showFrequencyBands = !showFrequencyBands;
-        repaint();
+        invalidateLayers();
     }
 }
 
@@ -2,6 +2,7 @@
 
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "PluginProcessor.h"
+#include "RefreshScheduler.h"
 
 /**
  * EmulsionScope - Mega Scope-inspired waveform and GR visualization
@@ -14,7 +15,7 @@
  * - RGB frequency band coloring option
  * - Settings button with popup menu for visualization options
  */
-class STEVEScope : public juce::Component, private juce::Timer
+class STEVEScope : public juce::Component, public RefreshScheduler::Client
 {
 public:
     STEVEScope(QuadBlendDriveAudioProcessor& p);
@@ -24,18 +25,20 @@ public:
     void resized() override;
     void mouseDown(const juce::MouseEvent& e) override;
 
+    // Per-frame update from the editor's RefreshScheduler (30fps)
+    void refresh(const MeterSnapshot& snapshot) override;
+
     // Visualization settings
-    void setMultiColorGR(bool multiColor) { useMultiColorGR = multiColor; repaint(); }
+    void setMultiColorGR(bool multiColor) { useMultiColorGR = multiColor; invalidateLayers(); }
     bool isMultiColorGR() const { return useMultiColorGR; }
-    void setShowFrequencyBands(bool show) { showFrequencyBands = show; repaint(); }
+    void setShowFrequencyBands(bool show) { showFrequencyBands = show; invalidateLayers(); }
     bool isShowingFrequencyBands() const { return showFrequencyBands; }
-    void setShowGRTraces(bool show) { showGRTraces = show; repaint(); }
+    void setShowGRTraces(bool show) { showGRTraces = show; invalidateLayers(); }
     bool isShowingGRTraces() const { return showGRTraces; }
 
 private:
-    void timerCallback() override;
-    void paintWaveform(juce::Graphics& g, juce::Rectangle<float> bounds);
-    void paintGRTraces(juce::Graphics& g, juce::Rectangle<float> bounds);
+    void paintWaveform(juce::Graphics& g, int firstColumn, int endColumn);
+    void paintGRTraces(juce::Graphics& g, int firstColumn, int endColumn);
     void paintPlayhead(juce::Graphics& g, juce::Rectangle<float> bounds);
     void paintGrid(juce::Graphics& g, juce::Rectangle<float> bounds);
     void paintSettingsButton(juce::Graphics& g);
@@ -44,6 +47,42 @@ private:
     // Helper to get processor color
     juce::Colour getProcessorColor(int index) const;
 
+    // === LAYER CACHE ===
+    // The static background (grid, threshold, labels, border) and the scrolling
+    // waveform + GR traces live in offscreen images that paint() only composites.
+    // The waveform layer is shifted left as data arrives and only the newly
+    // exposed pixel columns are drawn.
+    void invalidateLayers();
+    void updateLayers(float scale);
+    void renderBackgroundLayer();
+    void renderWaveformColumns(int firstColumn, int endColumn);
+    void scrollWaveformLayer(int segmentsAdvanced);
+    void redrawFrozenSegments(int firstSegment, int lastSegment);
+
+    // Waveform/GR values aggregated over the segments that fall into one pixel column
+    struct ColumnData
+    {
+        float waveMin = 0.0f, waveMax = 0.0f;
+        float low = 0.0f, mid = 0.0f, high = 0.0f;
+        float grTotal = 0.0f;
+        float grProcessor[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    };
+    ColumnData getColumnData(int column, int numColumns) const;
+
+    // Number of decimated segments visible for the current time base and tempo
+    int getVisibleSegmentCount() const;
+    float getThresholdDb() const;
+
+    juce::Image backgroundLayer;
+    juce::Image waveformLayer;
+    float layerScale = 0.0f;               // Physical pixels per logical pixel the layers were built for
+    bool backgroundLayerValid = false;
+    bool waveformLayerValid = false;
+    float layerThresholdDb = 0.0f;         // Threshold the layers were rendered with
+    int layerNumSegments = 0;              // Zoom the layers were rendered with
+    uint64_t lastSegmentsWritten = 0;      // processor.decimatedSegmentsWritten at last scroll
+    float pendingScrollPixels = 0.0f;      // Sub-pixel scroll carried to the next frame
+
     QuadBlendDriveAudioProcessor& processor;
 
     // Display settings
@@ -4,8 +4,7 @@
 StereoMeter::StereoMeter(QuadBlendDriveAudioProcessor& p, bool isInput)
     : processor(p), isInputMeter(isInput)
 {
-    // Update at 60fps
-    startTimerHz(60);
+    // Refreshed at 60fps by the editor's RefreshScheduler
 }
 
 void StereoMeter::paint(juce::Graphics& g)
@@ -16,9 +15,9 @@ void StereoMeter::paint(juce::Graphics& g)
     g.setColour(juce::Colour(0xFF1A1A1A));
     g.fillRoundedRectangle(bounds, 2.0f);
 
-    // Get peak levels (normalized 0-1)
-    float peakL = isInputMeter ? processor.getInputPeakL() : processor.getOutputPeakL();
-    float peakR = isInputMeter ? processor.getInputPeakR() : processor.getOutputPeakR();
+    // Peak levels from the latest meter snapshot (normalized 0-1)
+    float peakL = levelL;
+    float peakR = levelR;
 
     // Convert to dB
     float peakL_dB = juce::Decibels::gainToDecibels(peakL, -96.0f);
@@ -30,7 +29,6 @@ void StereoMeter::paint(juce::Graphics& g)
     float maxPeak_dB = juce::jmax(peakHoldL_dB, peakHoldR_dB);
 
     // Reserve space for numerical readout at top
-    const float textHeight = 16.0f;
     auto textArea = bounds.removeFromTop(textHeight);
 
     // Draw numerical readout (shows held peak)
@@ -171,13 +169,18 @@ void StereoMeter::paint(juce::Graphics& g)
 void StereoMeter::resized()
 {
     // No special layout needed - paint handles everything
+    // Force the next refresh to repaint at the new size
+    drawnBarL = drawnBarR = drawnHoldL = drawnHoldR = -1;
+    drawnReadout = std::numeric_limits<int>::min();
 }
 
-void StereoMeter::timerCallback()
+void StereoMeter::refresh(const MeterSnapshot& snapshot)
 {
     // Get current peak levels
-    float peakL = isInputMeter ? processor.getInputPeakL() : processor.getOutputPeakL();
-    float peakR = isInputMeter ? processor.getInputPeakR() : processor.getOutputPeakR();
+    float peakL = isInputMeter ? snapshot.inputPeakL : snapshot.outputPeakL;
+    float peakR = isInputMeter ? snapshot.inputPeakR : snapshot.outputPeakR;
+    levelL = peakL;
+    levelR = peakR;
 
     // Update peak hold for left channel
     juce::int64 currentTime = juce::Time::currentTimeMillis();
@@ -202,8 +205,37 @@ void StereoMeter::timerCallback()
         peakHoldR = peakR;  // Reset to current level after hold time expires
     }
 
-    // Trigger repaint for smooth animation
-    repaint();
+    // Repaint only the regions whose drawn state actually changed
+    const int barL = levelToPixels(levelL), barR = levelToPixels(levelR);
+    const int holdL = levelToPixels(peakHoldL), holdR = levelToPixels(peakHoldR);
+    const float maxHold_dB = juce::Decibels::gainToDecibels(juce::jmax(peakHoldL, peakHoldR), -96.0f);
+    const int readout = juce::roundToInt(maxHold_dB * 10.0f);  // Readout shows 0.1 dB
+
+    if (readout != drawnReadout)
+    {
+        drawnReadout = readout;
+        repaint(getLocalBounds().removeFromTop(static_cast<int>(textHeight) + 1));
+    }
+
+    if (barL != drawnBarL || barR != drawnBarR || holdL != drawnHoldL || holdR != drawnHoldR)
+    {
+        drawnBarL = barL;
+        drawnBarR = barR;
+        drawnHoldL = holdL;
+        drawnHoldR = holdR;
+        repaint(getLocalBounds().withTrimmedTop(static_cast<int>(textHeight)));
+    }
+}
+
+int StereoMeter::levelToPixels(float level) const
+{
+    // Same -60..+6 dB mapping as paint()
+    const float barHeight = static_cast<float>(getHeight()) - textHeight - 4.0f;
+    const float levelDB = juce::Decibels::gainToDecibels(level, -96.0f);
+    if (levelDB <= -60.0f)
+        return 0;
+
+    return juce::roundToInt(juce::jlimit(0.0f, 1.0f, (levelDB + 60.0f) / 66.0f) * barHeight * 2.0f);  // Half-pixel resolution
 }
 
 juce::Colour StereoMeter::getColorForLevel(float level)
@@ -3,6 +3,7 @@
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <juce_gui_basics/juce_gui_basics.h>
 #include "PluginProcessor.h"
+#include "RefreshScheduler.h"
 
 /**
  * Stereo Meter Component
@@ -14,7 +15,7 @@
  *
  * Peak follower: Instant attack, ~50ms release
  */
-class StereoMeter : public juce::Component, public juce::Timer
+class StereoMeter : public juce::Component, public RefreshScheduler::Client
 {
 public:
     StereoMeter(QuadBlendDriveAudioProcessor& p, bool isInputMeter);
@@ -22,12 +23,24 @@ public:
     void paint(juce::Graphics& g) override;
     void resized() override;
 
-private:
-    void timerCallback() override;
+    // Peak hold update from the per-frame meter snapshot (repaints only what moved)
+    void refresh(const MeterSnapshot& snapshot) override;
 
+private:
     QuadBlendDriveAudioProcessor& processor;
     bool isInputMeter;  // true = input meter, false = output meter
 
+    // Levels from the latest snapshot (what paint() draws)
+    float levelL{0.0f};
+    float levelR{0.0f};
+
+    // Last drawn state, used to skip repaints when nothing visible changed
+    int drawnBarL{-1}, drawnBarR{-1};
+    int drawnHoldL{-1}, drawnHoldR{-1};
+    int drawnReadout{std::numeric_limits<int>::min()};
+
+    static constexpr float textHeight = 16.0f;  // Numerical readout area at top
+
     // Peak hold tracking
     float peakHoldL{0.0f};
     float peakHoldR{0.0f};
@@ -42,4 +55,7 @@ private:
 
     // Get color for given level (0-1 normalized)
     static juce::Colour getColorForLevel(float level);
+
+    // Pixel height of a level within the bar area (for change detection)
+    int levelToPixels(float level) const;
 };
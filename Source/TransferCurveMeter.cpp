@@ -5,8 +5,7 @@
 TransferCurveMeter::TransferCurveMeter(QuadBlendDriveAudioProcessor& p)
     : processor(p)
 {
-    // Update at 60fps
-    startTimerHz(60);
+    // Refreshed at 60fps by the editor's RefreshScheduler
 }
 
 float TransferCurveMeter::dbToNormalized(float dB) const
@@ -19,35 +18,49 @@ float TransferCurveMeter::normalizedToDb(float norm) const
     return displayMinDB + norm * (displayMaxDB - displayMinDB);
 }
 
+TransferCurveMeter::~TransferCurveMeter()
+{
+}
+
 void TransferCurveMeter::paint(juce::Graphics& g)
 {
     // Use square bounds calculated in resized()
     auto bounds = curveBounds;
-
-    // Dark background
-    g.setColour(juce::Colour(BACKGROUND_COLOR));
-    g.fillRoundedRectangle(bounds, 4.0f);
+    if (bounds.isEmpty())
+        return;
+
+    // Static layers at the physical pixel density of the target context
+    const float scale = g.getInternalContext().getPhysicalPixelScaleFactor();
+    if (scale != layerScale || !gridLayer.isValid())
+        renderGridLayer(scale);
+
+    // First paint at this size/scale: build the curve synchronously, later
+    // parameter changes are rebuilt on the background thread
+    const auto params = readCurveParams();
+    const size_t key = makeLayerKey(params, scale);
+    if (!curveLayers.unlitCurve.isValid())
+    {
+        buildCurveLayers(curveLayers, params, bounds, scale);
+        curveLayers.key = key;
+    }
+    else if (curveLayers.key != key && requestedKey != key)
+    {
+        requestedKey = key;
+        curveBuilder.request(params, key, bounds, scale);
+    }
 
     // Get threshold value from processor
     float thresholdDB = processor.apvts.getRawParameterValue("THRESHOLD")->load();
     float threshNorm = dbToNormalized(thresholdDB);
     threshNorm = juce::jlimit(0.0f, 1.0f, threshNorm);
 
-    // Generate composite transfer curve
-    TransferCurveData curve;
-    generateCompositeCurve(curve,
-        processor.getXY_X(),
-        processor.getXY_Y(),
-        processor.getDriveHC(),
-        processor.getDriveSC(),
-        processor.getDriveSL(),
-        processor.getDriveFL(),
-        processor.getSoloIndex());
-
-    // Get current peak level (normalized 0-1)
-    float peak = processor.getCurrentPeakNormalized();
+    // Current peak level from the meter snapshot (normalized 0-1)
+    float peak = displayPeak;
     int peakIndex = juce::jlimit(0, 143, static_cast<int>(peak * 143.0f));
 
+    // Background, grid, dB labels, unity line and border
+    g.drawImage(gridLayer, getLocalBounds().toFloat());
+
     // Draw threshold reference line (horizontal at threshold level on output axis)
     float threshY = bounds.getBottom() - threshNorm * bounds.getHeight();
     g.setColour(juce::Colour(WARNING_AMBER).withAlpha(isHoveringThreshold || isDraggingThreshold ? 0.9f : 0.5f));
@@ -60,6 +73,60 @@ void TransferCurveMeter::paint(juce::Graphics& g)
         g.fillRoundedRectangle(bounds.getRight() - 4.0f, threshY - 4.0f, 8.0f, 8.0f, 2.0f);
     }
 
+    // Draw white curve (unlit portion)
+    const auto layerBounds = bounds.expanded(2.0f);
+    g.drawImage(curveLayers.unlitCurve, layerBounds);
+
+    // Draw green curve (lit portion up to current signal level)
+    {
+        juce::Graphics::ScopedSaveState save(g);
+        const float litRight = bounds.getX() + (static_cast<float>(peakIndex) / 143.0f) * bounds.getWidth();
+        g.reduceClipRegion(juce::Rectangle<float>(layerBounds.getX(), layerBounds.getY(),
+                                                  litRight - layerBounds.getX() + 1.0f,
+                                                  layerBounds.getHeight()).toNearestInt());
+        g.drawImage(curveLayers.litCurve, layerBounds);
+    }
+
+    // Draw input level indicator (vertical line showing current input)
+    if (peak > 0.001f)
+    {
+        float inputX = bounds.getX() + peak * bounds.getWidth();
+        g.setColour(juce::Colour(ACCENT_BLUE).withAlpha(0.7f));
+        g.drawVerticalLine(static_cast<int>(inputX), bounds.getY(), bounds.getBottom());
+
+        // Draw intersection point (where input meets curve)
+        float outputY = bounds.getBottom() - curveLayers.curve.y[peakIndex] * bounds.getHeight();
+        g.setColour(juce::Colour(ACCENT_BLUE));
+        g.fillEllipse(inputX - 4.0f, outputY - 4.0f, 8.0f, 8.0f);
+    }
+
+    // Threshold label
+    g.setColour(juce::Colour(WARNING_AMBER).withAlpha(0.8f));
+    g.setFont(11.0f);
+    juce::String threshLabel = juce::String(thresholdDB, 1) + " dB";
+    g.drawText(threshLabel, static_cast<int>(bounds.getX() + 4), static_cast<int>(threshY - 14), 50, 12, juce::Justification::left);
+}
+
+void TransferCurveMeter::renderGridLayer(float scale)
+{
+    layerScale = scale;
+    gridLayer = {};
+
+    const int width = juce::roundToInt(static_cast<float>(getWidth()) * scale);
+    const int height = juce::roundToInt(static_cast<float>(getHeight()) * scale);
+    if (width <= 0 || height <= 0)
+        return;
+
+    gridLayer = juce::Image(juce::Image::ARGB, width, height, true);
+    juce::Graphics g(gridLayer);
+    g.addTransform(juce::AffineTransform::scale(scale));
+
+    auto bounds = curveBounds;
+
+    // Dark background
+    g.setColour(juce::Colour(BACKGROUND_COLOR));
+    g.fillRoundedRectangle(bounds, 4.0f);
+
     // Draw grid lines with dB labels
     g.setColour(juce::Colours::white.withAlpha(GRID_ALPHA));
     const float gridDBs[] = { -48.0f, -36.0f, -24.0f, -12.0f, -6.0f, 0.0f };
@@ -84,62 +151,100 @@ void TransferCurveMeter::paint(juce::Graphics& g)
         g.drawText(label, static_cast<int>(bounds.getRight() + 2), static_cast<int>(labelY - 6), 20, 12, juce::Justification::left);
     }
 
-    // Build curve paths
-    juce::Path whitePath, greenPath;
+    // Unity line (45 degree diagonal)
+    g.setColour(juce::Colours::white.withAlpha(0.1f));
+    g.drawLine(bounds.getX(), bounds.getBottom(), bounds.getRight(), bounds.getY(), 1.0f);
+
+    // Border
+    g.setColour(juce::Colour(0xff404040));
+    g.drawRoundedRectangle(bounds, 4.0f, 1.0f);
+}
 
+void TransferCurveMeter::buildCurveLayers(CurveLayers& layers, const CurveParams& params,
+                                          juce::Rectangle<float> bounds, float scale)
+{
+    // Generate composite transfer curve
+    generateCompositeCurve(layers.curve,
+        params.X, params.Y,
+        params.driveHC, params.driveSC, params.driveSL, params.driveFL,
+        params.soloIndex);
+
+    // Stroke images cover the curve bounds plus a margin for the stroke width
+    const auto layerBounds = bounds.expanded(2.0f);
+    const int width = juce::roundToInt(layerBounds.getWidth() * scale);
+    const int height = juce::roundToInt(layerBounds.getHeight() * scale);
+    if (width <= 0 || height <= 0)
+        return;
+
+    // Build curve path in image coordinates
+    juce::Path curvePath;
     for (int i = 0; i < 144; ++i)
     {
-        float x = bounds.getX() + (static_cast<float>(i) / 143.0f) * bounds.getWidth();
-        float y = bounds.getBottom() - curve.y[i] * bounds.getHeight();
+        float x = (bounds.getX() - layerBounds.getX()) + (static_cast<float>(i) / 143.0f) * bounds.getWidth();
+        float y = (bounds.getBottom() - layerBounds.getY()) - layers.curve.y[i] * bounds.getHeight();
 
         if (i == 0)
-        {
-            whitePath.startNewSubPath(x, y);
-            if (i <= peakIndex)
-                greenPath.startNewSubPath(x, y);
-        }
+            curvePath.startNewSubPath(x, y);
         else
-        {
-            whitePath.lineTo(x, y);
-            if (i <= peakIndex)
-                greenPath.lineTo(x, y);
-        }
+            curvePath.lineTo(x, y);
     }
 
-    // Draw white curve (unlit portion)
-    g.setColour(juce::Colours::white.withAlpha(WHITE_ALPHA));
-    g.strokePath(whitePath, juce::PathStrokeType(1.5f));
-
-    // Draw green curve (lit portion up to current signal level)
-    g.setColour(juce::Colour(GREEN_COLOR));
-    g.strokePath(greenPath, juce::PathStrokeType(2.0f));
+    const auto transform = juce::AffineTransform::scale(scale);
 
-    // Draw input level indicator (vertical line showing current input)
-    if (peak > 0.001f)
+    layers.unlitCurve = juce::Image(juce::Image::ARGB, width, height, true);
     {
-        float inputX = bounds.getX() + peak * bounds.getWidth();
-        g.setColour(juce::Colour(ACCENT_BLUE).withAlpha(0.7f));
-        g.drawVerticalLine(static_cast<int>(inputX), bounds.getY(), bounds.getBottom());
+        juce::Graphics g(layers.unlitCurve);
+        g.setColour(juce::Colours::white.withAlpha(WHITE_ALPHA));
+        g.strokePath(curvePath, juce::PathStrokeType(1.5f), transform);
+    }
 
-        // Draw intersection point (where input meets curve)
-        float outputY = bounds.getBottom() - curve.y[peakIndex] * bounds.getHeight();
-        g.setColour(juce::Colour(ACCENT_BLUE));
-        g.fillEllipse(inputX - 4.0f, outputY - 4.0f, 8.0f, 8.0f);
+    layers.litCurve = juce::Image(juce::Image::ARGB, width, height, true);
+    {
+        juce::Graphics g(layers.litCurve);
+        g.setColour(juce::Colour(GREEN_COLOR));
+        g.strokePath(curvePath, juce::PathStrokeType(2.0f), transform);
     }
+}
 
-    // Unity line (45 degree diagonal)
-    g.setColour(juce::Colours::white.withAlpha(0.1f));
-    g.drawLine(bounds.getX(), bounds.getBottom(), bounds.getRight(), bounds.getY(), 1.0f);
+size_t TransferCurveMeter::CurveParams::hash() const
+{
+    // Quantize so float noise from host automation doesn't defeat the cache
+    auto q = [](float v) { return static_cast<size_t>(static_cast<int64_t>(std::round(v * 1000.0f))); };
 
-    // Border
-    g.setColour(juce::Colour(0xff404040));
-    g.drawRoundedRectangle(bounds, 4.0f, 1.0f);
+    size_t h = 0;
+    for (size_t v : { q(X), q(Y), q(driveHC), q(driveSC), q(driveSL), q(driveFL), static_cast<size_t>(soloIndex + 1) })
+        h = h * 1000003u ^ v;
+    return h;
+}
 
-    // Threshold label
-    g.setColour(juce::Colour(WARNING_AMBER).withAlpha(0.8f));
-    g.setFont(11.0f);
-    juce::String threshLabel = juce::String(thresholdDB, 1) + " dB";
-    g.drawText(threshLabel, static_cast<int>(bounds.getX() + 4), static_cast<int>(threshY - 14), 50, 12, juce::Justification::left);
+TransferCurveMeter::CurveParams TransferCurveMeter::readCurveParams() const
+{
+    CurveParams params;
+    params.X = processor.getXY_X();
+    params.Y = processor.getXY_Y();
+    params.driveHC = processor.getDriveHC();
+    params.driveSC = processor.getDriveSC();
+    params.driveSL = processor.getDriveSL();
+    params.driveFL = processor.getDriveFL();
+    params.soloIndex = processor.getSoloIndex();
+    return params;
+}
+
+size_t TransferCurveMeter::makeLayerKey(const CurveParams& params, float scale) const
+{
+    size_t h = params.hash();
+    for (int v : { juce::roundToInt(curveBounds.getX()), juce::roundToInt(curveBounds.getY()),
+                   juce::roundToInt(curveBounds.getWidth()), juce::roundToInt(scale * 100.0f) })
+        h = h * 1000003u ^ static_cast<size_t>(v);
+    return h;
+}
+
+juce::Rectangle<int> TransferCurveMeter::getPeakArea(float peak) const
+{
+    // Lit curve edge, input line and peak dot all sit at the peak's x position
+    const float x = curveBounds.getX() + peak * curveBounds.getWidth();
+    return juce::Rectangle<float>(x - 6.0f, curveBounds.getY() - 6.0f, 12.0f, curveBounds.getHeight() + 12.0f)
+               .getSmallestIntegerContainer();
 }
 
 void TransferCurveMeter::resized()
@@ -149,6 +254,10 @@ void TransferCurveMeter::resized()
     bounds.removeFromRight(25.0f);  // Room for dB labels
     int size = juce::jmin(static_cast<int>(bounds.getWidth()), static_cast<int>(bounds.getHeight()));
     curveBounds = bounds.withSizeKeepingCentre(static_cast<float>(size), static_cast<float>(size));
+
+    // Cached layers are rebuilt at the new size on the next paint
+    gridLayer = {};
+    curveLayers = {};
 }
 
 void TransferCurveMeter::mouseDown(const juce::MouseEvent& e)
@@ -204,10 +313,125 @@ void TransferCurveMeter::mouseMove(const juce::MouseEvent& e)
     }
 }
 
-void TransferCurveMeter::timerCallback()
+void TransferCurveMeter::refresh(const MeterSnapshot& snapshot)
 {
-    // Trigger repaint for smooth animation
-    repaint();
+    displayPeak = snapshot.transferCurvePeak;
+
+    // A rebuilt curve is ready: swap it in and redraw everything
+    if (curveBuilder.fetchResult(curveLayers))
+    {
+        drawnPeak = displayPeak;
+        repaint();
+        return;
+    }
+
+    // Curve parameters moved: rebuild in the background (old curve stays up meanwhile)
+    const size_t key = makeLayerKey(readCurveParams(), layerScale);
+    if (curveLayers.key != key && requestedKey != key && layerScale > 0.0f)
+    {
+        requestedKey = key;
+        curveBuilder.request(readCurveParams(), key, curveBounds, layerScale);
+    }
+
+    // Threshold moved (automation, link): overlay line and label
+    const float thresholdDB = processor.apvts.getRawParameterValue("THRESHOLD")->load();
+    if (thresholdDB != drawnThresholdDB)
+    {
+        drawnThresholdDB = thresholdDB;
+        repaint();
+    }
+
+    // Per frame only the moving peak (lit span, input line, dot) is redrawn
+    if (displayPeak != drawnPeak)
+    {
+        const float lo = juce::jmin(displayPeak, juce::jmax(drawnPeak, 0.0f));
+        const float hi = juce::jmax(displayPeak, drawnPeak);
+        repaint(getPeakArea(lo).getUnion(getPeakArea(hi)));
+        drawnPeak = displayPeak;
+    }
+}
+
+//==============================================================================
+TransferCurveMeter::CurveBuilder::CurveBuilder()
+    : juce::Thread("Transfer Curve Builder")
+{
+}
+
+TransferCurveMeter::CurveBuilder::~CurveBuilder()
+{
+    signalThreadShouldExit();
+    notify();
+    stopThread(1000);
+}
+
+void TransferCurveMeter::CurveBuilder::request(const CurveParams& params, size_t key,
+                                               juce::Rectangle<float> bounds, float scale)
+{
+    {
+        const juce::ScopedLock sl(lock);
+        pendingParams = params;
+        pendingKey = key;
+        pendingBounds = bounds;
+        pendingScale = scale;
+        hasPending = true;
+    }
+
+    if (!isThreadRunning())
+        startThread(juce::Thread::Priority::low);
+
+    notify();
+}
+
+bool TransferCurveMeter::CurveBuilder::fetchResult(CurveLayers& out)
+{
+    const juce::ScopedLock sl(lock);
+    if (!hasResult)
+        return false;
+
+    out = std::move(result);
+    hasResult = false;
+    return true;
+}
+
+void TransferCurveMeter::CurveBuilder::run()
+{
+    while (!threadShouldExit())
+    {
+        CurveParams params;
+        size_t key = 0;
+        juce::Rectangle<float> bounds;
+        float scale = 1.0f;
+
+        {
+            const juce::ScopedLock sl(lock);
+            if (hasPending)
+            {
+                params = pendingParams;
+                key = pendingKey;
+                bounds = pendingBounds;
+                scale = pendingScale;
+                hasPending = false;
+            }
+        }
+
+        if (key == 0)
+        {
+            wait(-1);
+            continue;
+        }
+
+        CurveLayers layers;
+        buildCurveLayers(layers, params, bounds, scale);
+        layers.key = key;
+
+        // Drop the result if a newer request arrived while building
+        const juce::ScopedLock sl(lock);
+        if (!hasPending)
+        {
+            result = std::move(layers);
+            hasResult = true;
+        }
+    }
 }
 
 void TransferCurveMeter::generateCompositeCurve(TransferCurveData& data,
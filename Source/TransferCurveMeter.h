@@ -4,6 +4,7 @@
 #include <juce_gui_basics/juce_gui_basics.h>
 #include <array>
 #include "PluginProcessor.h"
+#include "RefreshScheduler.h"
 
 /**
  * Transfer Curve Meter
@@ -21,7 +22,7 @@
  * - Bottom-left: Soft Clip
  * - Bottom-right: Slow Limit
  */
-class TransferCurveMeter : public juce::Component, public juce::Timer
+class TransferCurveMeter : public juce::Component, public RefreshScheduler::Client
 {
 public:
     TransferCurveMeter(QuadBlendDriveAudioProcessor& p);
@@ -33,8 +34,12 @@ public:
     void mouseUp(const juce::MouseEvent& e) override;
     void mouseMove(const juce::MouseEvent& e) override;
 
+    // Per-frame update from the editor's RefreshScheduler (60fps)
+    void refresh(const MeterSnapshot& snapshot) override;
+
+    ~TransferCurveMeter() override;
+
 private:
-    void timerCallback() override;
 
     // Transfer curve data (144 points)
     struct TransferCurveData
@@ -42,12 +47,64 @@ private:
         std::array<float, 144> y;
     };
 
+    // Everything the curve shape depends on (threshold is drawn as an overlay, not part of the curve)
+    struct CurveParams
+    {
+        float X = 0.5f, Y = 0.5f;
+        float driveHC = 0.0f, driveSC = 0.0f, driveSL = 0.0f, driveFL = 0.0f;
+        int soloIndex = -1;
+
+        size_t hash() const;
+    };
+
+    // Memoised curve plus its pre-rendered strokes, valid for one (params, size, scale) key
+    struct CurveLayers
+    {
+        size_t key = 0;
+        TransferCurveData curve {};
+        juce::Image unlitCurve;  // White curve (full length)
+        juce::Image litCurve;    // Green curve (full length, clipped to the peak when drawn)
+    };
+
+    // Background thread that rebuilds CurveLayers when curve parameters move,
+    // so the message thread only composites images
+    class CurveBuilder : private juce::Thread
+    {
+    public:
+        CurveBuilder();
+        ~CurveBuilder() override;
+
+        void request(const CurveParams& params, size_t key, juce::Rectangle<float> bounds, float scale);
+        bool fetchResult(CurveLayers& out);  // True if a new result replaced 'out'
+
+    private:
+        void run() override;
+
+        juce::CriticalSection lock;
+        CurveParams pendingParams;
+        size_t pendingKey = 0;
+        juce::Rectangle<float> pendingBounds;
+        float pendingScale = 1.0f;
+        bool hasPending = false;
+        CurveLayers result;
+        bool hasResult = false;
+    };
+
+    CurveParams readCurveParams() const;
+    size_t makeLayerKey(const CurveParams& params, float scale) const;
+
+    // Build curve + stroke images (thread-safe: only touches its arguments)
+    static void buildCurveLayers(CurveLayers& layers, const CurveParams& params,
+                                 juce::Rectangle<float> bounds, float scale);
+    void renderGridLayer(float scale);
+    juce::Rectangle<int> getPeakArea(float peak) const;
+
     // Generate composite curve based on XY position and drive settings
-    void generateCompositeCurve(TransferCurveData& data,
-                                float X, float Y,
-                                float driveHC, float driveSC,
-                                float driveSL, float driveFL,
-                                int soloIndex);
+    static void generateCompositeCurve(TransferCurveData& data,
+                                       float X, float Y,
+                                       float driveHC, float driveSC,
+                                       float driveSL, float driveFL,
+                                       int soloIndex);
 
     // Individual transfer functions (normalized 0-1 range)
     static float hardClip(float x, float drive);
@@ -62,6 +119,20 @@ private:
 
     QuadBlendDriveAudioProcessor& processor;
 
+    // Peak level from the latest meter snapshot (normalized 0-1)
+    float displayPeak = 0.0f;
+    float drawnPeak = -1.0f;
+    float drawnThresholdDB = 0.0f;
+
+    // === CACHED LAYERS ===
+    // Grid/labels (rebuilt on resize), curve strokes (rebuilt in the background on
+    // parameter change); per frame only the lit portion and peak dot are redrawn
+    juce::Image gridLayer;
+    float layerScale = 0.0f;
+    CurveLayers curveLayers;
+    size_t requestedKey = 0;
+    CurveBuilder curveBuilder;
+
     // Square bounds for transfer curve (maintained in resized())
     juce::Rectangle<float> curveBounds;
 
@@ -0,0 +1,214 @@
+/**
+ * @file ADAATests.cpp
+ * @brief Unit tests for the anti-derivative anti-aliasing clip shapes
+ */
+
+#include "../Source/DSP/ADAA.h"
+#include <juce_core/juce_core.h>
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Test result tracking
+struct TestResult
+{
+    int passed = 0;
+    int failed = 0;
+
+    void report(const std::string& testName, bool success, const std::string& message = "")
+    {
+        if (success)
+        {
+            std::cout << "[PASS] " << testName << std::endl;
+            passed++;
+        }
+        else
+        {
+            std::cout << "[FAIL] " << testName;
+            if (!message.empty())
+                std::cout << " - " << message;
+            std::cout << std::endl;
+            failed++;
+        }
+    }
+
+    void printSummary()
+    {
+        std::cout << "\n=======================================" << std::endl;
+        std::cout << "TEST SUMMARY" << std::endl;
+        std::cout << "=======================================" << std::endl;
+        std::cout << "Total Tests: " << (passed + failed) << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        std::cout << "Pass Rate: " << (passed * 100.0f / (passed + failed)) << "%" << std::endl;
+        std::cout << "=======================================" << std::endl;
+
+        if (failed == 0)
+            std::cout << "\n✓ ALL TESTS PASSED!\n" << std::endl;
+    }
+};
+
+constexpr double twoPi = 6.283185307179586;
+
+// Ratio (dB) of energy outside the harmonic bins to energy in them, for a clipped
+// sine whose harmonics above Nyquist fold onto non-harmonic bins
+template <typename Shape, int Order>
+double measureAliasingDB()
+{
+    constexpr int N = 4800;             // 10 Hz bins at 48 kHz
+    constexpr int fundamentalBin = 299; // 2990 Hz
+    constexpr int settle = 64;
+
+    ADAA::State state;
+    std::vector<double> y(N);
+    for (int i = 0; i < N + settle; ++i)
+    {
+        const double x = 3.0 * std::sin(twoPi * fundamentalBin * i / N);
+        const double out = ADAA::process<Shape, Order>(state, x);
+        if (i >= settle)
+            y[static_cast<size_t>(i - settle)] = out;
+    }
+
+    double harmonic = 0.0, aliased = 0.0;
+    for (int bin = 1; bin < N / 2; ++bin)
+    {
+        double re = 0.0, im = 0.0;
+        for (int n = 0; n < N; ++n)
+        {
+            const double w = 0.5 - 0.5 * std::cos(twoPi * n / N);  // Hann
+            re += w * y[static_cast<size_t>(n)] * std::cos(twoPi * bin * n / N);
+            im -= w * y[static_cast<size_t>(n)] * std::sin(twoPi * bin * n / N);
+        }
+
+        const int nearest = ((bin + fundamentalBin / 2) / fundamentalBin) * fundamentalBin;
+        const bool isHarmonic = nearest > 0 && std::abs(bin - nearest) <= 2;
+        (isHarmonic ? harmonic : aliased) += re * re + im * im;
+    }
+
+    return 10.0 * std::log10(aliased / harmonic);
+}
+
+// Test 1: Antiderivatives differentiate back to the shape
+template <typename Shape>
+void testAntiderivatives(TestResult& results, const std::string& name)
+{
+    constexpr double h = 1.0e-5;
+    double maxErrorF1 = 0.0, maxErrorF2 = 0.0;
+
+    for (double x = -8.0; x <= 8.0; x += 0.01)
+    {
+        const double dF1 = (Shape::F1(x + h) - Shape::F1(x - h)) / (2.0 * h);
+        const double dF2 = (Shape::F2(x + h) - Shape::F2(x - h)) / (2.0 * h);
+        maxErrorF1 = std::max(maxErrorF1, std::abs(dF1 - Shape::f(x)));
+        maxErrorF2 = std::max(maxErrorF2, std::abs(dF2 - Shape::F1(x)));
+    }
+
+    results.report(name + " antiderivatives are consistent",
+                   maxErrorF1 < 1.0e-4 && maxErrorF2 < 1.0e-6,
+                   "F1' error " + std::to_string(maxErrorF1) + ", F2' error " + std::to_string(maxErrorF2));
+}
+
+// Test 2: Constant input hits the ill-conditioned fallbacks and must equal f(x)
+template <typename Shape>
+void testConstantInput(TestResult& results, const std::string& name)
+{
+    bool ok = true;
+    for (double level : { -2.5, -0.3, 0.0, 0.7, 4.0 })
+    {
+        ADAA::State first, second;
+        double y1 = 0.0, y2 = 0.0;
+        for (int i = 0; i < 8; ++i)
+        {
+            y1 = ADAA::processFirstOrder<Shape>(first, level);
+            y2 = ADAA::processSecondOrder<Shape>(second, level);
+        }
+        ok = ok && std::abs(y1 - Shape::f(level)) < 1.0e-9 && std::abs(y2 - Shape::f(level)) < 1.0e-9;
+    }
+
+    results.report(name + " constant input passes through the shape", ok);
+}
+
+// Test 3: Slow signals come out as the plain shape, delayed by half / one sample
+template <typename Shape>
+void testDelayedShape(TestResult& results, const std::string& name, double tolerance)
+{
+    ADAA::State first, second;
+    double maxError1 = 0.0, maxError2 = 0.0;
+    const double w = twoPi * 50.0 / 48000.0;
+
+    for (int i = 0; i < 4800; ++i)
+    {
+        const double x = 3.0 * std::sin(w * i);
+        const double y1 = ADAA::processFirstOrder<Shape>(first, x);
+        const double y2 = ADAA::processSecondOrder<Shape>(second, x);
+        if (i < 4)
+            continue;
+
+        maxError1 = std::max(maxError1, std::abs(y1 - Shape::f(3.0 * std::sin(w * (i - 0.5)))));
+        maxError2 = std::max(maxError2, std::abs(y2 - Shape::f(3.0 * std::sin(w * (i - 1.0)))));
+    }
+
+    results.report(name + " tracks the delayed shape on slow signals",
+                   maxError1 < tolerance && maxError2 < tolerance,
+                   "1st " + std::to_string(maxError1) + ", 2nd " + std::to_string(maxError2));
+}
+
+// Test 4: Aliasing drops with each order at 1x
+template <typename Shape>
+void testAliasReduction(TestResult& results, const std::string& name)
+{
+    const double off = measureAliasingDB<Shape, ADAA::Off>();
+    const double first = measureAliasingDB<Shape, ADAA::FirstOrder>();
+    const double second = measureAliasingDB<Shape, ADAA::SecondOrder>();
+
+    results.report(name + " ADAA reduces aliasing",
+                   first < off - 5.0 && second < first - 5.0,
+                   "Off " + std::to_string(off) + " dB, 1st " + std::to_string(first)
+                       + " dB, 2nd " + std::to_string(second) + " dB");
+}
+
+// Test 5: Extreme and near-equal inputs stay finite
+template <typename Shape>
+void testFinite(TestResult& results, const std::string& name)
+{
+    ADAA::State first, second;
+    bool finite = true;
+    const double inputs[] = { 0.0, 1.0e-12, -1.0e-12, 1.0e6, -1.0e6, 1.0e6 + 1.0e-9, 0.5, 0.5 + 1.0e-10, 0.5, -40.0, 40.0 };
+
+    for (double x : inputs)
+    {
+        finite = finite && std::isfinite(ADAA::processFirstOrder<Shape>(first, x));
+        finite = finite && std::isfinite(ADAA::processSecondOrder<Shape>(second, x));
+    }
+
+    results.report(name + " stays finite on extreme inputs", finite);
+}
+
+template <typename Shape>
+void runShapeTests(TestResult& results, const std::string& name, double delayTolerance)
+{
+    testAntiderivatives<Shape>(results, name);
+    testConstantInput<Shape>(results, name);
+    testDelayedShape<Shape>(results, name, delayTolerance);
+    testAliasReduction<Shape>(results, name);
+    testFinite<Shape>(results, name);
+}
+
+int main()
+{
+    std::cout << "\n=======================================" << std::endl;
+    std::cout << "STEVE Clip ADAA - Unit Tests" << std::endl;
+    std::cout << "=======================================" << std::endl;
+
+    TestResult results;
+
+    // The hard clip's corners get rounded over a sample or two, so allow more there
+    runShapeTests<ADAA::HardClip>(results, "Hard clip", 5.0e-3);
+    runShapeTests<ADAA::Tanh>(results, "Tanh", 1.0e-4);
+
+    // Print summary
+    results.printSummary();
+
+    return (results.failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,118 @@
+#include "../Source/PluginProcessor.h"
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <cmath>
+#include <iostream>
+#include <memory>
+
+// Block Size Benchmark for Emulsion
+// Measures processing cost per second of audio at small host buffer sizes
+// (live rigs run 16-64 samples), so per-block overhead shows up as a rising
+// cost-per-second as the buffer shrinks
+
+class BlockSizeBenchmark
+{
+public:
+    static constexpr double sampleRate = 48000.0;
+    static constexpr double secondsOfAudio = 2.0;
+    static constexpr int repeats = 3;  // Best of N, to keep scheduler noise out of the comparison
+
+    void runAll()
+    {
+        std::cout << "========================================" << std::endl;
+        std::cout << "BLOCK SIZE BENCHMARK" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        const char* modeNames[] = { "Zero Latency", "Balanced", "Linear Phase" };
+        const int blockSizes[] = { 16, 32, 64, 512, 2048 };
+
+        for (int mode = 0; mode < 3; ++mode)
+        {
+            std::cout << "\n" << modeNames[mode] << std::endl;
+
+            double reference = 0.0;
+            for (int blockSize : blockSizes)
+            {
+                const double msPerSecond = measure(mode, blockSize);
+                if (blockSize == 512)
+                    reference = msPerSecond;
+
+                std::cout << "  " << blockSize << " samples: " << msPerSecond << " ms CPU per second of audio" << std::endl;
+            }
+
+            std::cout << "  (512-sample reference: " << reference << " ms)" << std::endl;
+        }
+    }
+
+private:
+    static double measure(int mode, int blockSize)
+    {
+        // Heap-allocated: the processor's state is too large for the default stack
+        auto processorPtr = std::make_unique<QuadBlendDriveAudioProcessor>();
+        auto& processor = *processorPtr;
+        processor.setPlayConfigDetails(2, 2, sampleRate, blockSize);
+
+        if (auto* param = processor.apvts.getParameter("PROCESSING_MODE"))
+            param->setValueNotifyingHost(param->convertTo0to1(static_cast<float>(mode)));
+
+        // Centre of the XY pad with a few dB of drive: all four processors active
+        if (auto* param = processor.apvts.getParameter("INPUT_GAIN"))
+            param->setValueNotifyingHost(param->convertTo0to1(6.0f));
+
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        juce::AudioBuffer<float> buffer(2, blockSize);
+        juce::MidiBuffer midi;
+
+        const int totalBlocks = static_cast<int>(sampleRate * secondsOfAudio) / blockSize;
+        double phase = 0.0;
+        const double phaseInc = juce::MathConstants<double>::twoPi * 440.0 / sampleRate;
+
+        auto fillBlock = [&]()
+        {
+            for (int i = 0; i < blockSize; ++i)
+            {
+                const float s = 0.8f * static_cast<float>(std::sin(phase));
+                buffer.setSample(0, i, s);
+                buffer.setSample(1, i, s);
+                phase += phaseInc;
+            }
+        };
+
+        // Warm-up: settle smoothers and mode switch
+        for (int b = 0; b < 64; ++b)
+        {
+            fillBlock();
+            processor.processBlock(buffer, midi);
+        }
+
+        double bestMs = 0.0;
+        for (int r = 0; r < repeats; ++r)
+        {
+            double processingMs = 0.0;
+            for (int b = 0; b < totalBlocks; ++b)
+            {
+                fillBlock();
+                const double start = juce::Time::getMillisecondCounterHiRes();
+                processor.processBlock(buffer, midi);
+                processingMs += juce::Time::getMillisecondCounterHiRes() - start;
+            }
+
+            if (r == 0 || processingMs < bestMs)
+                bestMs = processingMs;
+        }
+
+        processor.releaseResources();
+        return bestMs / secondsOfAudio;
+    }
+};
+
+int main(int argc, char* argv[])
+{
+    juce::ignoreUnused(argc, argv);
+    juce::ScopedJuceInitialiser_GUI scopedJuce;
+
+    BlockSizeBenchmark benchmark;
+    benchmark.runAll();
+
+    return 0;
+}
@@ -0,0 +1,152 @@
+/**
+ * @file ChannelHistoryTests.cpp
+ * @brief Unit tests for the mono detection replay history
+ */
+
+#include "../Source/DSP/ChannelHistory.h"
+#include <iostream>
+#include <algorithm>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Test result tracking
+struct TestResult
+{
+    int passed = 0;
+    int failed = 0;
+
+    void report(const std::string& testName, bool success, const std::string& message = "")
+    {
+        if (success)
+        {
+            std::cout << "[PASS] " << testName << std::endl;
+            passed++;
+        }
+        else
+        {
+            std::cout << "[FAIL] " << testName;
+            if (!message.empty())
+                std::cout << " - " << message;
+            std::cout << std::endl;
+            failed++;
+        }
+    }
+
+    void printSummary()
+    {
+        std::cout << "\n=======================================" << std::endl;
+        std::cout << "TEST SUMMARY" << std::endl;
+        std::cout << "=======================================" << std::endl;
+        std::cout << "Total Tests: " << (passed + failed) << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        std::cout << "Pass Rate: " << (passed * 100.0f / (passed + failed)) << "%" << std::endl;
+        std::cout << "=======================================" << std::endl;
+
+        if (failed == 0)
+            std::cout << "\n✓ ALL TESTS PASSED!\n" << std::endl;
+    }
+};
+
+constexpr int numChannels = ChannelHistory::numChannels;
+
+double testSample(int channel, int n)
+{
+    return 0.001 * n + channel;
+}
+
+// Push samples first .. first + size - 1 of the test ramp into both channels
+void pushRamp(ChannelHistory& history, int first, int size)
+{
+    std::vector<float> block[numChannels];
+    const float* pointers[numChannels];
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        for (int i = 0; i < size; ++i)
+            block[ch].push_back(static_cast<float>(testSample(ch, first + i)));
+        pointers[ch] = block[ch].data();
+    }
+
+    history.push(pointers, size);
+}
+
+// Largest difference between a copy and the ramp samples it should hold
+double copyError(const ChannelHistory& history, int channel, int samplesAgo, int size, int firstExpected)
+{
+    std::vector<float> copied(static_cast<size_t>(size));
+    history.copy(channel, copied.data(), samplesAgo, size);
+
+    double maxError = 0.0;
+    for (int i = 0; i < size; ++i)
+        maxError = std::max(maxError, std::abs(static_cast<double>(copied[static_cast<size_t>(i)])
+                                               - static_cast<double>(static_cast<float>(testSample(channel, firstExpected + i)))));
+    return maxError;
+}
+
+// Test 1: Stored count grows with each push and stops at the capacity
+void testNumStored(TestResult& results)
+{
+    ChannelHistory history;
+    history.prepare(100);
+
+    pushRamp(history, 0, 40);
+    const bool partial = history.getNumStored() == 40;
+    pushRamp(history, 40, 40);
+    pushRamp(history, 80, 40);
+    const bool full = history.getNumStored() == 100;
+    history.reset();
+
+    results.report("Stored count follows pushes up to the capacity",
+                   partial && full && history.getNumStored() == 0,
+                   std::to_string(history.getNumStored()));
+}
+
+// Test 2: Copies return exactly what was pushed, across the ring's wrap point
+void testCopyAcrossWrap(TestResult& results)
+{
+    ChannelHistory history;
+    history.prepare(100);
+
+    for (int n = 0; n < 7 * 37; n += 37)
+        pushRamp(history, n, 37);  // Samples 0 .. 258; the last 100 are 159 .. 258
+
+    double maxError = 0.0;
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        maxError = std::max(maxError, copyError(history, ch, 100, 64, 159));
+        maxError = std::max(maxError, copyError(history, ch, 36, 36, 223));
+    }
+
+    results.report("Copies are exact across the wrap point", maxError == 0.0,
+                   "max error " + std::to_string(maxError));
+}
+
+// Test 3: The oldest sample kept is exactly one capacity back
+void testOldestSample(TestResult& results)
+{
+    ChannelHistory history;
+    history.prepare(64);
+    for (int n = 0; n < 640; n += 64)
+        pushRamp(history, n, 64);
+
+    results.report("Whole capacity is readable", copyError(history, 1, 64, 64, 576) == 0.0);
+}
+
+int main()
+{
+    std::cout << "\n=======================================" << std::endl;
+    std::cout << "STEVE Channel History - Unit Tests" << std::endl;
+    std::cout << "=======================================" << std::endl;
+
+    TestResult results;
+
+    testNumStored(results);
+    testCopyAcrossWrap(results);
+    testOldestSample(results);
+
+    // Print summary
+    results.printSummary();
+
+    return (results.failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,112 @@
+#include "../Source/PluginProcessor.h"
+#include <juce_audio_processors/juce_audio_processors.h>
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <algorithm>
+#include <iostream>
+#include <memory>
+#include <vector>
+
+// Editor Construction Benchmark for Emulsion
+// Measures how long it takes to open editor windows, as when comparing
+// mixes across many plugin instances at once
+
+class EditorBenchmark
+{
+public:
+    static constexpr int numInstances = 20;
+    static constexpr int editorWidth = 1000;
+    static constexpr int editorHeight = 610;
+
+    EditorBenchmark()
+    {
+        for (int i = 0; i < numInstances; ++i)
+        {
+            auto processor = std::make_unique<QuadBlendDriveAudioProcessor>();
+            processor->setPlayConfigDetails(2, 2, sampleRate, blockSize);
+            processor->prepareToPlay(sampleRate, blockSize);
+            processors.push_back(std::move(processor));
+        }
+    }
+
+    ~EditorBenchmark()
+    {
+        for (auto& processor : processors)
+            processor->releaseResources();
+    }
+
+    void runAll()
+    {
+        std::cout << "========================================" << std::endl;
+        std::cout << "EDITOR CONSTRUCTION BENCHMARK" << std::endl;
+        std::cout << "========================================" << std::endl;
+
+        // Warm-up: first construction pays for font loading and static caches
+        openEditor(*processors.front());
+
+        std::vector<double> constructMs, firstPaintMs;
+        std::vector<std::unique_ptr<juce::AudioProcessorEditor>> editors;
+
+        const double totalStart = juce::Time::getMillisecondCounterHiRes();
+
+        // All editors stay open, like a session with many instance windows
+        for (auto& processor : processors)
+        {
+            const double start = juce::Time::getMillisecondCounterHiRes();
+            std::unique_ptr<juce::AudioProcessorEditor> editor(processor->createEditor());
+            const double constructed = juce::Time::getMillisecondCounterHiRes();
+
+            editor->setSize(editorWidth, editorHeight);
+            auto snapshot = editor->createComponentSnapshot(editor->getLocalBounds());
+            const double painted = juce::Time::getMillisecondCounterHiRes();
+
+            constructMs.push_back(constructed - start);
+            firstPaintMs.push_back(painted - constructed);
+            editors.push_back(std::move(editor));
+        }
+
+        const double totalMs = juce::Time::getMillisecondCounterHiRes() - totalStart;
+
+        report("Construction", constructMs);
+        report("First paint", firstPaintMs);
+        std::cout << "Total (" << numInstances << " editors): " << totalMs << " ms" << std::endl;
+
+        editors.clear();
+    }
+
+private:
+    static void openEditor(QuadBlendDriveAudioProcessor& processor)
+    {
+        std::unique_ptr<juce::AudioProcessorEditor> editor(processor.createEditor());
+        editor->setSize(editorWidth, editorHeight);
+        editor->createComponentSnapshot(editor->getLocalBounds());
+    }
+
+    static void report(const juce::String& name, std::vector<double> timesMs)
+    {
+        std::sort(timesMs.begin(), timesMs.end());
+
+        double sum = 0.0;
+        for (double t : timesMs)
+            sum += t;
+
+        std::cout << name << ": mean " << sum / static_cast<double>(timesMs.size())
+                  << " ms, median " << timesMs[timesMs.size() / 2]
+                  << " ms, max " << timesMs.back() << " ms" << std::endl;
+    }
+
+    static constexpr double sampleRate = 48000.0;
+    static constexpr int blockSize = 512;
+
+    std::vector<std::unique_ptr<QuadBlendDriveAudioProcessor>> processors;
+};
+
+int main(int argc, char* argv[])
+{
+    juce::ignoreUnused(argc, argv);
+    juce::ScopedJuceInitialiser_GUI scopedJuce;
+
+    EditorBenchmark benchmark;
+    benchmark.runAll();
+
+    return 0;
+}
@@ -1,14 +1,16 @@
 /**
  * @file EnvelopeTests.cpp
- * @brief Unit tests for EnvelopeFollower and EnvelopeShaper classes
+ * @brief Unit tests for EnvelopeFollower, TransientDetector and EnvelopeShaper classes
  */
 
 #include "../Source/DSP/EnvelopeFollower.h"
 #include "../Source/DSP/EnvelopeShaper.h"
+#include "../Source/DSP/TransientDetector.h"
 #include <juce_audio_processors/juce_audio_processors.h>
 #include <iostream>
 #include <cmath>
 #include <cassert>
+#include <vector>
 
 // Test result tracking
 struct TestResult
@@ -288,6 +290,104 @@ void testParameterSmoothing(TestResult& results)
                    "Gain transition: " + std::to_string(gain1) + " → " + std::to_string(gain2));
 }
 
+// Bursty test signal: 5ms hits over a quiet sustained tone
+static std::vector<float> makeBursts(int numSamples, double sampleRate)
+{
+    std::vector<float> signal(static_cast<size_t>(numSamples));
+    const int period = static_cast<int>(sampleRate * 0.1);
+    const int hit = static_cast<int>(sampleRate * 0.005);
+    for (int i = 0; i < numSamples; ++i)
+    {
+        const float level = (i % period) < hit ? 0.9f : 0.1f;
+        signal[static_cast<size_t>(i)] = level * std::sin(2.0f * 3.14159265f * 220.0f * i / static_cast<float>(sampleRate));
+    }
+    return signal;
+}
+
+// Test 8: Block processing matches sample-by-sample processing
+void testBlockProcessing(TestResult& results)
+{
+    const double sampleRate = 48000.0;
+    const auto input = makeBursts(9600, sampleRate);
+
+    EnvelopeFollower single, block;
+    single.setSampleRate(sampleRate);
+    block.setSampleRate(sampleRate);
+
+    std::vector<float> output(input.size());
+    for (size_t start = 0; start < input.size(); start += 64)
+        block.process(input.data() + start, output.data() + start, 64);
+
+    bool identical = true;
+    for (size_t i = 0; i < input.size(); ++i)
+        identical = identical && output[i] == single.process(input[i]);
+
+    results.report("EnvelopeFollower block process matches per-sample", identical);
+}
+
+// Test 9: Shapers fed by one shared detector match shapers running their own
+void testSharedDetector(TestResult& results)
+{
+    const double sampleRate = 384000.0;
+    const auto input = makeBursts(38400, sampleRate);
+
+    EnvelopeShaper ownA, ownB, sharedA, sharedB;
+    TransientDetector detector;
+    for (auto* shaper : { &ownA, &ownB, &sharedA, &sharedB })
+        shaper->prepare(sampleRate);
+    detector.prepare(sampleRate);
+
+    ownA.setAttackEmphasis(6.0f);
+    sharedA.setAttackEmphasis(6.0f);
+    ownB.setSustainEmphasis(-9.0f);
+    sharedB.setSustainEmphasis(-9.0f);
+
+    // Block sizes straddle the 15ms emphasis ramp, so both code paths of process() run
+    std::vector<float> transientness(512), gainA(512), gainB(512);
+    bool identical = true;
+    for (size_t start = 0; start + 512 <= input.size(); start += 512)
+    {
+        detector.process(input.data() + start, transientness.data(), 512);
+        sharedA.process(transientness.data(), gainA.data(), 512);
+        sharedB.process(transientness.data(), gainB.data(), 512);
+
+        for (size_t i = 0; i < 512; ++i)
+        {
+            identical = identical && gainA[i] == ownA.processEnvelope(input[start + i]);
+            identical = identical && gainB[i] == ownB.processEnvelope(input[start + i]);
+        }
+    }
+
+    results.report("Shared detector + block mapping matches per-shaper detection", identical);
+}
+
+// Test 10: Base-rate detection tracks full-rate detection closely
+void testDecimatedDetector(TestResult& results)
+{
+    const double sampleRate = 384000.0;  // 8x of 48 kHz
+    const auto input = makeBursts(76800, sampleRate);
+
+    TransientDetector full, decimated;
+    full.prepare(sampleRate);
+    decimated.prepare(sampleRate);
+    decimated.setDecimation(8);
+
+    std::vector<float> a(input.size()), b(input.size());
+    full.process(input.data(), a.data(), static_cast<int>(input.size()));
+    decimated.process(input.data(), b.data(), static_cast<int>(input.size()));
+
+    float maxDifference = 0.0f;
+    bool inRange = true;
+    for (size_t i = input.size() / 2; i < input.size(); ++i)
+    {
+        maxDifference = std::max(maxDifference, std::abs(a[i] - b[i]));
+        inRange = inRange && b[i] >= 0.0f && b[i] <= 1.0f;
+    }
+
+    results.report("Base-rate detection stays within 0.1 of full rate", inRange && maxDifference < 0.1f,
+                   "max difference " + std::to_string(maxDifference));
+}
+
 int main()
 {
     std::cout << "\n=======================================" << std::endl;
@@ -304,6 +404,9 @@ int main()
     testExtremeGains(results);
     testParameterClamping(results);
     testParameterSmoothing(results);
+    testBlockProcessing(results);
+    testSharedDetector(results);
+    testDecimatedDetector(results);
 
     // Print summary
     results.printSummary();
@@ -49,9 +49,8 @@ public:
         }
     }
 
-    static void generatePinkNoise(juce::AudioBuffer<float>& buffer)
+    static void generatePinkNoise(juce::AudioBuffer<float>& buffer, juce::Random random = {})
     {
-        juce::Random random;
 
         for (int ch = 0; ch < buffer.getNumChannels(); ++ch)
         {
@@ -104,6 +103,31 @@ public:
         return 20.0 * std::log10(maxDiff);
     }
 
+    // RMS of the difference between two buffers in dB
+    static double computeRmsDifferenceDB(const juce::AudioBuffer<float>& buffer1,
+                                         const juce::AudioBuffer<float>& buffer2)
+    {
+        double sumSquares = 0.0;
+
+        for (int ch = 0; ch < buffer1.getNumChannels(); ++ch)
+        {
+            const auto* data1 = buffer1.getReadPointer(ch);
+            const auto* data2 = buffer2.getReadPointer(ch);
+
+            for (int i = 0; i < buffer1.getNumSamples(); ++i)
+            {
+                const double diff = static_cast<double>(data1[i]) - static_cast<double>(data2[i]);
+                sumSquares += diff * diff;
+            }
+        }
+
+        const double meanSquare = sumSquares / (buffer1.getNumChannels() * buffer1.getNumSamples());
+        if (meanSquare < 1e-20)
+            return -200.0;
+
+        return 10.0 * std::log10(meanSquare);
+    }
+
     // Check if two buffers are bit-identical
     static bool areBitIdentical(const juce::AudioBuffer<float>& buffer1,
                                const juce::AudioBuffer<float>& buffer2)
@@ -306,6 +330,366 @@ public:
         return pass;
     }
 
+    // TEST 4: Per-path rate alignment
+    // Below threshold every XY path is the identity, so moving one path to a lower rate
+    // must only add the latency it reports. A path misaligned against the others
+    // comb-filters the blend, which shows up most at high frequencies.
+    std::vector<float> renderSine(int hcOversampling, double frequency, int numBlocks, int& latency)
+    {
+        resetToDefaults();
+        setParameter("PROCESSING_MODE", 1.0f);  // Balanced, 8x common rate
+        for (const auto* mute : { "HC_MUTE", "SC_MUTE", "SL_MUTE", "FL_MUTE" })
+            setParameter(mute, 0.0f);
+        setParameter("HC_OVERSAMPLING", static_cast<float>(hcOversampling));
+        processor.releaseResources();
+        processor.prepareToPlay(sampleRate, blockSize);
+        latency = processor.getLatencySamples();
+
+        juce::AudioBuffer<float> block(2, blockSize);
+        juce::MidiBuffer midi;
+        std::vector<float> output;
+        int n = 0;
+        for (int b = 0; b < numBlocks; ++b)
+        {
+            for (int i = 0; i < blockSize; ++i, ++n)
+                for (int ch = 0; ch < 2; ++ch)
+                    block.setSample(ch, i, static_cast<float>(0.1 * std::sin(2.0 * juce::MathConstants<double>::pi * frequency * n / sampleRate)));
+
+            processor.processBlock(block, midi);
+            output.insert(output.end(), block.getReadPointer(0), block.getReadPointer(0) + blockSize);
+        }
+        return output;
+    }
+
+    bool testPathRateAlignment()
+    {
+        std::cout << "\n=== TEST 4: Per-Path Rate Alignment ===" << std::endl;
+
+        bool pass = true;
+        for (const int hcOversampling : { 1, 2, 3 })  // Hard clip at 1x, 2x, 4x under 8x
+        {
+            int commonLatency = 0, pathLatency = 0;
+            const auto common = renderSine(0, 9876.5, 100, commonLatency);
+            const auto reduced = renderSine(hcOversampling, 9876.5, 100, pathLatency);
+            const int offset = pathLatency - commonLatency;
+
+            double maxDiff = 0.0;
+            for (size_t i = common.size() / 2; i + static_cast<size_t>(offset) < reduced.size(); ++i)
+                maxDiff = std::max(maxDiff, std::abs(static_cast<double>(reduced[i + static_cast<size_t>(offset)]) - common[i]));
+
+            const double maxDiffDB = 20.0 * std::log10(maxDiff / 0.1 + 1.0e-20);  // Relative to the sine
+            std::cout << "HC_OVERSAMPLING " << hcOversampling << ": +" << offset
+                      << " samples, max difference " << maxDiffDB << " dB" << std::endl;
+            pass = pass && offset >= 0 && maxDiffDB < -50.0;
+        }
+
+        std::cout << "Result: " << (pass ? "PASS" : "FAIL") << std::endl;
+        return pass;
+    }
+
+    // TEST 5: Hard clip fast path across a loud-to-quiet edge
+    // Once the input stays under the threshold the hard clipper passes its lookahead line
+    // straight through. If the threshold drops (or ADAA is switched off) shortly after the
+    // input went quiet, the lookahead line still holds loud samples, and they must come out clipped.
+    float renderClipEdge(bool toggleAntiAliasing)
+    {
+        resetToDefaults();
+        setParameter("PROCESSING_MODE", 1.0f);
+        for (const auto* mute : { "HC_MUTE", "SC_MUTE", "SL_MUTE", "FL_MUTE" })
+            setParameter(mute, 0.0f);
+        setParameter("HC_SOLO", 1.0f);
+        processor.releaseResources();
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        // Host blocks shorter than the 1 ms lookahead, so the change lands while the line is still loud
+        constexpr int edgeBlockSize = 32;
+        juce::AudioBuffer<float> block(2, edgeBlockSize);
+        juce::MidiBuffer midi;
+        std::vector<float> output;
+        int n = 0;
+        auto run = [&](float amplitude, int numBlocks)
+        {
+            for (int b = 0; b < numBlocks; ++b)
+            {
+                for (int i = 0; i < edgeBlockSize; ++i, ++n)
+                    for (int ch = 0; ch < 2; ++ch)
+                        block.setSample(ch, i, static_cast<float>(amplitude * std::sin(2.0 * juce::MathConstants<double>::pi * 1000.0 * n / sampleRate)));
+
+                processor.processBlock(block, midi);
+                output.insert(output.end(), block.getReadPointer(0), block.getReadPointer(0) + edgeBlockSize);
+            }
+        };
+
+        if (toggleAntiAliasing)
+        {
+            // Quiet without ADAA, then loud with it; switch it off one block into the quiet
+            setParameter("THRESHOLD", -12.0f);
+            run(0.05f, 800);
+            setParameter("CLIP_ANTIALIAS", 1.0f);
+            run(0.5f, 200);
+            run(0.05f, 1);
+            setParameter("CLIP_ANTIALIAS", 0.0f);
+        }
+        else
+        {
+            // Loud but under a 0 dB threshold; drop it to -12 dB one block into the quiet
+            setParameter("THRESHOLD", 0.0f);
+            run(0.5f, 800);
+            run(0.05f, 1);
+            setParameter("THRESHOLD", -12.0f);
+        }
+
+        // What leaves the chain after the change: its first samples had already passed the
+        // clipper (they are in the downsampling filter), so skip them
+        const size_t change = output.size();
+        run(0.05f, 16);
+
+        float edgePeak = 0.0f;
+        for (size_t i = change + 32; i < output.size(); ++i)
+            edgePeak = std::max(edgePeak, std::abs(output[i]));
+
+        setParameter("HC_SOLO", 0.0f);
+        setParameter("CLIP_ANTIALIAS", 0.0f);
+        return edgePeak;
+    }
+
+    bool testClipFastPathEdge()
+    {
+        std::cout << "\n=== TEST 5: Hard Clip Fast Path Edge ===" << std::endl;
+
+        const float threshold = juce::Decibels::decibelsToGain(-12.0f);
+        const float thresholdDrop = renderClipEdge(false);
+        const float antiAliasingOff = renderClipEdge(true);
+
+        std::cout << "Threshold drop: edge peak " << thresholdDrop << std::endl;
+        std::cout << "ADAA switched off: edge peak " << antiAliasingOff << std::endl;
+
+        // Clipped at -12 dB, with some headroom for the downsampling filter's ringing
+        const bool pass = thresholdDrop < threshold * 1.2f && antiAliasingOff < threshold * 1.2f;
+        std::cout << "Result: " << (pass ? "PASS" : "FAIL") << std::endl;
+        return pass;
+    }
+
+    // TEST 6: Scope cache after more than a whole display ring
+    // The scope stops decimating while it is hidden, but the audio thread keeps writing. When it
+    // is shown again after more than one ring, none of the segments from before may survive.
+    bool testDisplayRingLap()
+    {
+        std::cout << "\n=== TEST 6: Display Cache After A Ring Lap ===" << std::endl;
+
+        resetToDefaults();
+        for (const auto* mute : { "HC_MUTE", "SC_MUTE", "SL_MUTE", "FL_MUTE" })
+            setParameter(mute, 0.0f);
+        processor.releaseResources();
+        processor.prepareToPlay(sampleRate, blockSize);
+        processor.editorOpen.store(true);
+
+        juce::AudioBuffer<float> block(2, blockSize);
+        juce::MidiBuffer midi;
+        auto run = [&](float level, int numSamples)
+        {
+            for (int done = 0; done < numSamples; done += blockSize)
+            {
+                for (int ch = 0; ch < 2; ++ch)
+                    juce::FloatVectorOperations::fill(block.getWritePointer(ch), level, blockSize);
+                processor.processBlock(block, midi);
+            }
+        };
+
+        // Quiet first, seen by the scope...
+        run(0.05f, 8 * blockSize);
+        processor.updateDecimatedDisplay();
+
+        // ...then more than one ring of a louder level it does not look at
+        run(0.5f, QuadBlendDriveAudioProcessor::displayBufferSize + 8 * blockSize);
+        processor.updateDecimatedDisplay();
+
+        float lowestSegment = 1.0f;
+        for (const auto& segment : processor.decimatedDisplay)
+            lowestSegment = std::min(lowestSegment, segment.waveformMaxL);
+
+        processor.editorOpen.store(false);
+
+        std::cout << "Lowest segment peak: " << lowestSegment << std::endl;
+        const bool pass = lowestSegment > 0.25f;
+        std::cout << "Result: " << (pass ? "PASS" : "FAIL") << std::endl;
+        return pass;
+    }
+
+    // TEST 7: Silence gate with every gain stage at maximum
+    // Input far below -120 dBFS can still come out clearly audible after +72 dB of gain
+    // (input, path trims, output), so the gate must not mistake it for silence.
+    bool testSilenceGateWithGain()
+    {
+        std::cout << "\n=== TEST 7: Silence Gate At Maximum Gain ===" << std::endl;
+
+        resetToDefaults();
+        for (const auto* mute : { "HC_MUTE", "SC_MUTE", "SL_MUTE", "FL_MUTE" })
+            setParameter(mute, 0.0f);
+        const juce::StringArray gains { "INPUT_GAIN", "OUTPUT_GAIN", "HC_TRIM", "SC_TRIM", "SL_TRIM", "FL_TRIM" };
+        for (const auto& gain : gains)
+            setParameter(gain, 24.0f);
+        processor.releaseResources();
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        // A -125 dBFS sine for six seconds, longer than the tail the gate waits for (~4 s)
+        const float level = juce::Decibels::decibelsToGain(-125.0f, -200.0f);
+        juce::AudioBuffer<float> block(2, blockSize);
+        juce::MidiBuffer midi;
+        float lastPeak = 0.0f;
+        int n = 0;
+        for (int b = 0; b < static_cast<int>(6.0 * sampleRate) / blockSize; ++b)
+        {
+            for (int i = 0; i < blockSize; ++i, ++n)
+                for (int ch = 0; ch < 2; ++ch)
+                    block.setSample(ch, i, level * static_cast<float>(std::sin(2.0 * juce::MathConstants<double>::pi * 1000.0 * n / sampleRate)));
+
+            processor.processBlock(block, midi);
+            lastPeak = block.getMagnitude(0, 0, blockSize);
+        }
+
+        for (const auto& gain : gains)
+            setParameter(gain, 0.0f);
+
+        const float lastPeakDB = juce::Decibels::gainToDecibels(lastPeak, -200.0f);
+        std::cout << "Output after 6 s: " << lastPeakDB << " dBFS" << std::endl;
+
+        // +72 dB on -125 dBFS: about -53 dBFS, certainly not silence
+        const bool pass = lastPeakDB > -60.0f;
+        std::cout << "Result: " << (pass ? "PASS" : "FAIL") << std::endl;
+        return pass;
+    }
+
+    // TEST 8: Channel link groups on an immersive bus
+    // A loud height channel must only duck the bed when CHANNEL_LINK_GROUPS links them together.
+    float renderBedUnderLoudHeight(float linkGroups)
+    {
+        resetToDefaults();
+        for (const auto* mute : { "HC_MUTE", "SC_MUTE", "SL_MUTE", "FL_MUTE" })
+            setParameter(mute, 0.0f);
+        setParameter("SL_SOLO", 1.0f);  // The slow limiter on its own, where the link acts
+        setParameter("THRESHOLD", -6.0f);
+        setParameter("CHANNEL_LINK", 100.0f);
+        setParameter("CHANNEL_LINK_GROUPS", linkGroups);
+
+        const auto layout = juce::AudioChannelSet::create7point1point4();
+        processor.releaseResources();
+        processor.setChannelLayoutOfBus(true, 0, layout);
+        processor.setChannelLayoutOfBus(false, 0, layout);
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        const int bed = layout.getChannelIndexForType(juce::AudioChannelSet::left);
+        const int height = layout.getChannelIndexForType(juce::AudioChannelSet::topFrontLeft);
+
+        // -20 dBFS in the bed, well under the threshold; 0 dBFS in one height channel
+        juce::AudioBuffer<float> block(layout.size(), blockSize);
+        juce::MidiBuffer midi;
+        float bedPeak = 0.0f;
+        int n = 0;
+        for (int b = 0; b < 40; ++b)
+        {
+            block.clear();
+            for (int i = 0; i < blockSize; ++i, ++n)
+            {
+                const float sine = static_cast<float>(std::sin(2.0 * juce::MathConstants<double>::pi * 1000.0 * n / sampleRate));
+                block.setSample(bed, i, 0.1f * sine);
+                block.setSample(height, i, sine);
+            }
+
+            processor.processBlock(block, midi);
+            bedPeak = block.getMagnitude(bed, 0, blockSize);
+        }
+
+        setParameter("CHANNEL_LINK_GROUPS", 0.0f);
+        setParameter("SL_SOLO", 0.0f);
+        processor.releaseResources();
+        processor.setChannelLayoutOfBus(true, 0, juce::AudioChannelSet::stereo());
+        processor.setChannelLayoutOfBus(false, 0, juce::AudioChannelSet::stereo());
+        processor.prepareToPlay(sampleRate, blockSize);
+        return juce::Decibels::gainToDecibels(bedPeak, -200.0f);
+    }
+
+    bool testChannelLinkGroups()
+    {
+        std::cout << "\n=== TEST 8: Channel Link Groups (7.1.4) ===" << std::endl;
+
+        const float all = renderBedUnderLoudHeight(0.0f);
+        const float bedAndHeights = renderBedUnderLoudHeight(1.0f);
+        const float stereoPairs = renderBedUnderLoudHeight(2.0f);
+
+        std::cout << "Bed peak, All: " << all << " dBFS" << std::endl;
+        std::cout << "Bed peak, Bed + Heights: " << bedAndHeights << " dBFS" << std::endl;
+        std::cout << "Bed peak, Stereo Pairs: " << stereoPairs << " dBFS" << std::endl;
+
+        // Linked to the height channel the bed is pulled down with it; in its own group it
+        // passes at its -20 dBFS
+        const bool pass = all < -23.0f && std::abs(bedAndHeights + 20.0f) < 1.0f && std::abs(stereoPairs + 20.0f) < 1.0f;
+        std::cout << "Result: " << (pass ? "PASS" : "FAIL") << std::endl;
+        return pass;
+    }
+
+    // TEST 9: Control-rate detection against full rate
+    // LIMIT_CONTROL_RATE and ENVELOPE_CONTROL_RATE trade accuracy for CPU; they must change the
+    // output (the branch runs) but stay within their documented distance of full-rate processing.
+    juce::AudioBuffer<float> renderControlRate(const juce::AudioBuffer<float>& input, const char* controlRate)
+    {
+        resetToDefaults();
+        for (const auto* mute : { "HC_MUTE", "SC_MUTE", "SL_MUTE", "FL_MUTE" })
+            setParameter(mute, 0.0f);
+        setParameter("PROCESSING_MODE", 1.0f);  // Balanced: 8x, so the control rate decimates
+        setParameter("THRESHOLD", -12.0f);
+        for (const auto* emphasis : { "HC_ATTACK", "SC_ATTACK", "SL_ATTACK", "FL_ATTACK" })
+            setParameter(emphasis, 6.0f);
+        if (controlRate != nullptr)
+            setParameter(controlRate, 1.0f);
+        processor.releaseResources();
+        processor.prepareToPlay(sampleRate, blockSize);
+
+        juce::AudioBuffer<float> output(input);
+        juce::MidiBuffer midi;
+        for (int start = 0; start + blockSize <= output.getNumSamples(); start += blockSize)
+        {
+            juce::AudioBuffer<float> block(output.getArrayOfWritePointers(), output.getNumChannels(), start, blockSize);
+            processor.processBlock(block, midi);
+        }
+
+        for (const auto* emphasis : { "HC_ATTACK", "SC_ATTACK", "SL_ATTACK", "FL_ATTACK" })
+            setParameter(emphasis, 0.0f);
+        setParameter("LIMIT_CONTROL_RATE", 0.0f);
+        setParameter("ENVELOPE_CONTROL_RATE", 0.0f);
+        return output;
+    }
+
+    bool testControlRateDeviation()
+    {
+        std::cout << "\n=== TEST 9: Control Rate vs Full Rate ===" << std::endl;
+
+        // Pink noise 12 dB hotter than usual, so both limiters work throughout; seeded, so
+        // every run measures the same material
+        juce::AudioBuffer<float> input(2, 48000);
+        generatePinkNoise(input, juce::Random(1));
+        input.applyGain(juce::Decibels::decibelsToGain(12.0f));
+
+        const auto fullRate = renderControlRate(input, nullptr);
+        const auto limiterRate = renderControlRate(input, "LIMIT_CONTROL_RATE");
+        const auto envelopeRate = renderControlRate(input, "ENVELOPE_CONTROL_RATE");
+
+        const double limiterPeakDB = computeMaxDifferenceDB(fullRate, limiterRate);
+        const double limiterRmsDB = computeRmsDifferenceDB(fullRate, limiterRate);
+        const double envelopePeakDB = computeMaxDifferenceDB(fullRate, envelopeRate);
+        const double envelopeRmsDB = computeRmsDifferenceDB(fullRate, envelopeRate);
+
+        std::cout << "Limiter control rate: max difference " << limiterPeakDB << " dB, RMS " << limiterRmsDB << " dB" << std::endl;
+        std::cout << "Envelope control rate: max difference " << envelopePeakDB << " dB, RMS " << envelopeRmsDB << " dB" << std::endl;
+
+        // Measured about -17/-39 dB (limiter) and -36/-58 dB (envelope) on this material; the
+        // bounds leave a few dB of room. Bit-identical output would mean the branch never ran.
+        const bool pass = limiterPeakDB > -200.0 && limiterPeakDB < -12.0 && limiterRmsDB < -34.0
+                       && envelopePeakDB > -200.0 && envelopePeakDB < -30.0 && envelopeRmsDB < -52.0;
+        std::cout << "Result: " << (pass ? "PASS" : "FAIL") << std::endl;
+        return pass;
+    }
+
     // Run all tests
     void runAllTests()
     {
@@ -370,6 +754,36 @@ public:
                 passedTests++;
         }
 
+        // TEST 4: Path rate alignment (signal independent)
+        totalTests++;
+        if (testPathRateAlignment())
+            passedTests++;
+
+        // TEST 5: Hard clip fast path edge (signal independent)
+        totalTests++;
+        if (testClipFastPathEdge())
+            passedTests++;
+
+        // TEST 6: Display cache after a ring lap (signal independent)
+        totalTests++;
+        if (testDisplayRingLap())
+            passedTests++;
+
+        // TEST 7: Silence gate at maximum gain (signal independent)
+        totalTests++;
+        if (testSilenceGateWithGain())
+            passedTests++;
+
+        // TEST 8: Channel link groups (signal independent)
+        totalTests++;
+        if (testChannelLinkGroups())
+            passedTests++;
+
+        // TEST 9: Control-rate detection vs full rate (signal independent)
+        totalTests++;
+        if (testControlRateDeviation())
+            passedTests++;
+
         // Print summary
         std::cout << "\n=======================================" << std::endl;
         std::cout << "TEST SUMMARY" << std::endl;
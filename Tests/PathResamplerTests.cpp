@@ -0,0 +1,202 @@
+/**
+ * @file PathResamplerTests.cpp
+ * @brief Unit tests for the per-path halfband decimator/interpolator
+ */
+
+#include "../Source/DSP/PathResampler.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Test result tracking
+struct TestResult
+{
+    int passed = 0;
+    int failed = 0;
+
+    void report(const std::string& testName, bool success, const std::string& message = "")
+    {
+        if (success)
+        {
+            std::cout << "[PASS] " << testName << std::endl;
+            passed++;
+        }
+        else
+        {
+            std::cout << "[FAIL] " << testName;
+            if (!message.empty())
+                std::cout << " - " << message;
+            std::cout << std::endl;
+            failed++;
+        }
+    }
+
+    void printSummary()
+    {
+        std::cout << "\n=======================================" << std::endl;
+        std::cout << "TEST SUMMARY" << std::endl;
+        std::cout << "=======================================" << std::endl;
+        std::cout << "Total Tests: " << (passed + failed) << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        std::cout << "Pass Rate: " << (passed * 100.0f / (passed + failed)) << "%" << std::endl;
+        std::cout << "=======================================" << std::endl;
+
+        if (failed == 0)
+            std::cout << "\n✓ ALL TESTS PASSED!\n" << std::endl;
+    }
+};
+
+constexpr double twoPi = 6.283185307179586;
+constexpr int baseBlockSize = 64;  // Matches the processor's micro-block
+
+// Stereo sine at a base-rate normalised frequency, sampled at the common rate,
+// run through decimate/interpolate in micro-blocks
+std::vector<double> roundTrip(PathResampler& resampler, int commonIndex, int pathIndex,
+                              double baseFrequency, int numBlocks, int blockSize = baseBlockSize)
+{
+    const int factor = 1 << commonIndex;
+    const int commonBlock = blockSize * factor;
+    juce::AudioBuffer<double> buffer(2, commonBlock);
+    std::vector<double> output;
+
+    int n = 0;
+    for (int block = 0; block < numBlocks; ++block)
+    {
+        for (int i = 0; i < commonBlock; ++i, ++n)
+        {
+            const double x = 0.5 * std::sin(twoPi * baseFrequency * n / factor);
+            buffer.setSample(0, i, x);
+            buffer.setSample(1, i, -x);
+        }
+
+        const int pathSamples = resampler.decimate(buffer, commonBlock, commonIndex, pathIndex);
+        resampler.interpolate(buffer, pathSamples, commonIndex, pathIndex);
+
+        for (int i = 0; i < commonBlock; ++i)
+            output.push_back(buffer.getSample(0, i));
+    }
+
+    return output;
+}
+
+// Test 1: Running at the common rate is an exact passthrough
+void testCommonRateIsIdentity(TestResult& results)
+{
+    PathResampler resampler;
+    resampler.prepare(baseBlockSize * 16);
+
+    const auto output = roundTrip(resampler, 4, 4, 0.01, 4);
+    double maxError = 0.0;
+    for (size_t n = 0; n < output.size(); ++n)
+        maxError = std::max(maxError, std::abs(output[n] - 0.5 * std::sin(twoPi * 0.01 * n / 16.0)));
+
+    results.report("Common rate passes through untouched",
+                   maxError == 0.0 && resampler.getLatency(4, 4) == 0,
+                   "max error " + std::to_string(maxError));
+}
+
+// Test 2: The round trip is a pure delay of getLatency() samples for in-band signals
+void testRoundTripIsDelay(TestResult& results)
+{
+    for (int commonIndex = 1; commonIndex <= 5; ++commonIndex)
+    {
+        for (int pathIndex = 0; pathIndex < commonIndex; ++pathIndex)
+        {
+            PathResampler resampler;
+            resampler.prepare(baseBlockSize << commonIndex);
+
+            const int factor = 1 << commonIndex;
+            const double frequency = 1000.0 / 48000.0;
+            const auto output = roundTrip(resampler, commonIndex, pathIndex, frequency, 40);
+            const int latency = resampler.getLatency(commonIndex, pathIndex);
+
+            double maxError = 0.0;
+            for (size_t n = output.size() / 2; n < output.size(); ++n)
+            {
+                const double expected = 0.5 * std::sin(twoPi * frequency * (static_cast<double>(n) - latency) / factor);
+                maxError = std::max(maxError, std::abs(output[n] - expected));
+            }
+
+            results.report("Round trip " + std::to_string(factor) + "x -> " + std::to_string(1 << pathIndex)
+                               + "x is a " + std::to_string(latency) + " sample delay",
+                           latency > 0 && maxError < 1.0e-3,
+                           "max error " + std::to_string(maxError));
+        }
+    }
+}
+
+// Test 3: Block boundaries are seamless (same output for different micro-block sizes)
+void testBlockSizeIndependence(TestResult& results)
+{
+    PathResampler a, b;
+    a.prepare(baseBlockSize * 16);
+    b.prepare(baseBlockSize * 16);
+
+    const auto large = roundTrip(a, 4, 1, 0.013, 12);
+    const auto small = roundTrip(b, 4, 1, 0.013, 48, baseBlockSize / 4);
+
+    double maxError = 0.0;
+    for (size_t n = 0; n < large.size(); ++n)
+        maxError = std::max(maxError, std::abs(large[n] - small[n]));
+
+    results.report("Output does not depend on block size", maxError < 1.0e-12,
+                   "max difference " + std::to_string(maxError));
+}
+
+// Test 4: Content above the path's Nyquist is rejected rather than folded back
+void testStopband(TestResult& results)
+{
+    PathResampler resampler;
+    resampler.prepare(baseBlockSize * 2);
+
+    // 0.75x the base rate at 2x common: above the 1x path's Nyquist
+    const auto output = roundTrip(resampler, 1, 0, 0.75, 40);
+    double peak = 0.0;
+    for (size_t n = output.size() / 2; n < output.size(); ++n)
+        peak = std::max(peak, std::abs(output[n]));
+
+    const double rejectionDB = 20.0 * std::log10(peak / 0.5 + 1.0e-20);
+    results.report("Stopband rejects out-of-band content", rejectionDB < -60.0,
+                   std::to_string(rejectionDB) + " dB");
+}
+
+// Test 5: reset() clears the history
+void testReset(TestResult& results)
+{
+    PathResampler resampler;
+    resampler.prepare(baseBlockSize * 8);
+    roundTrip(resampler, 3, 0, 0.02, 4);
+    resampler.reset();
+
+    juce::AudioBuffer<double> silence(2, baseBlockSize * 8);
+    silence.clear();
+    const int pathSamples = resampler.decimate(silence, silence.getNumSamples(), 3, 0);
+    resampler.interpolate(silence, pathSamples, 3, 0);
+
+    results.report("Reset clears filter history",
+                   silence.getMagnitude(0, 0, silence.getNumSamples()) == 0.0
+                       && silence.getMagnitude(1, 0, silence.getNumSamples()) == 0.0);
+}
+
+int main()
+{
+    std::cout << "\n=======================================" << std::endl;
+    std::cout << "STEVE Path Resampler - Unit Tests" << std::endl;
+    std::cout << "=======================================" << std::endl;
+
+    TestResult results;
+
+    testCommonRateIsIdentity(results);
+    testRoundTripIsDelay(results);
+    testBlockSizeIndependence(results);
+    testStopband(results);
+    testReset(results);
+
+    // Print summary
+    results.printSummary();
+
+    return (results.failed == 0) ? 0 : 1;
+}
@@ -0,0 +1,149 @@
+/**
+ * @file SharedDSPResourcesTests.cpp
+ * @brief Unit tests for the process-wide DSP table cache
+ */
+
+#include "../Source/DSP/PathResampler.h"
+#include "../Source/DSP/SharedDSPResources.h"
+#include <juce_audio_basics/juce_audio_basics.h>
+#include <iostream>
+#include <cmath>
+#include <string>
+#include <vector>
+
+// Test result tracking
+struct TestResult
+{
+    int passed = 0;
+    int failed = 0;
+
+    void report(const std::string& testName, bool success, const std::string& message = "")
+    {
+        if (success)
+        {
+            std::cout << "[PASS] " << testName << std::endl;
+            passed++;
+        }
+        else
+        {
+            std::cout << "[FAIL] " << testName;
+            if (!message.empty())
+                std::cout << " - " << message;
+            std::cout << std::endl;
+            failed++;
+        }
+    }
+
+    void printSummary()
+    {
+        std::cout << "\n=======================================" << std::endl;
+        std::cout << "TEST SUMMARY" << std::endl;
+        std::cout << "=======================================" << std::endl;
+        std::cout << "Total Tests: " << (passed + failed) << std::endl;
+        std::cout << "Passed: " << passed << std::endl;
+        std::cout << "Failed: " << failed << std::endl;
+        std::cout << "Pass Rate: " << (passed * 100.0f / (passed + failed)) << "%" << std::endl;
+        std::cout << "=======================================" << std::endl;
+
+        if (failed == 0)
+            std::cout << "\n✓ ALL TESTS PASSED!\n" << std::endl;
+    }
+};
+
+using Table = std::vector<double>;
+
+SharedDSPResources::Key decimatorKey(int factor)
+{
+    return { SharedDSPResources::Type::HalfbandDecimator, factor, 0.0, sizeof(double) };
+}
+
+// Test 1: Every caller of a key gets the same table, designed once
+void testSharedOnce(TestResult& results)
+{
+    int designs = 0;
+    auto create = [&designs] { ++designs; return Table(31, 0.5); };
+
+    const auto a = SharedDSPResources::get<Table>(decimatorKey(4), create);
+    const auto b = SharedDSPResources::get<Table>(decimatorKey(4), create);
+    const auto other = SharedDSPResources::get<Table>(decimatorKey(8), create);
+
+    results.report("Same key shares one table", a == b && designs == 2 && a != other && a->size() == 31,
+                   std::to_string(designs) + " designs");
+}
+
+// Test 2: A table is freed with its last holder and designed again on the next request
+void testReleasedWithLastHolder(TestResult& results)
+{
+    int designs = 0;
+    auto create = [&designs] { ++designs; return Table(7, 1.0); };
+    const int before = SharedDSPResources::getNumLiveTables();
+
+    std::weak_ptr<const Table> watcher;
+    {
+        const auto held = SharedDSPResources::get<Table>(decimatorKey(32), create);
+        watcher = held;
+        results.report("Live while held", SharedDSPResources::getNumLiveTables() == before + 1);
+    }
+
+    const bool freed = watcher.expired() && SharedDSPResources::getNumLiveTables() == before;
+    const auto again = SharedDSPResources::get<Table>(decimatorKey(32), create);
+
+    results.report("Freed with its last holder, then redesigned", freed && designs == 2 && again->size() == 7);
+}
+
+// Test 3: Resamplers (one set per plugin instance) share one set of halfband designs,
+// and process exactly as a resampler with tables of its own would
+void testResamplersShareDesigns(TestResult& results)
+{
+    const int before = SharedDSPResources::getNumLiveTables();
+    std::vector<double> outputs[2];
+    int liveWithBoth = 0;
+    {
+        PathResampler first, second;
+        first.prepare(1024);
+        const int liveWithOne = SharedDSPResources::getNumLiveTables();
+        second.prepare(1024);
+        liveWithBoth = SharedDSPResources::getNumLiveTables();
+
+        results.report("Second resampler designs nothing new",
+                       liveWithOne == before + 2 * PathResampler::maxStages && liveWithBoth == liveWithOne);
+
+        // Both carry their own filter history, so the same input gives the same output
+        PathResampler* resamplers[] = { &first, &second };
+        for (int r = 0; r < 2; ++r)
+        {
+            juce::AudioBuffer<double> buffer(2, 1024);
+            for (int block = 0, n = 0; block < 4; ++block)
+            {
+                for (int i = 0; i < 1024; ++i, ++n)
+                    for (int ch = 0; ch < 2; ++ch)
+                        buffer.setSample(ch, i, 0.5 * std::sin(0.003 * n + ch));
+
+                const int pathSamples = resamplers[r]->decimate(buffer, 1024, 4, 1);
+                resamplers[r]->interpolate(buffer, pathSamples, 4, 1);
+                outputs[r].insert(outputs[r].end(), buffer.getReadPointer(1), buffer.getReadPointer(1) + 1024);
+            }
+        }
+    }
+
+    results.report("Shared tables, independent state",
+                   outputs[0] == outputs[1] && SharedDSPResources::getNumLiveTables() == before);
+}
+
+int main()
+{
+    std::cout << "\n=======================================" << std::endl;
+    std::cout << "STEVE Shared DSP Resources - Unit Tests" << std::endl;
+    std::cout << "=======================================" << std::endl;
+
+    TestResult results;
+
+    testSharedOnce(results);
+    testReleasedWithLastHolder(results);
+    testResamplersShareDesigns(results);
+
+    // Print summary
+    results.printSummary();
+
+    return (results.failed == 0) ? 0 : 1;
+}